@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,10 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
 namespace L0 {
 
 BuiltinFunctionsLibImpl::BuiltinData::~BuiltinData() {
@@ -29,6 +33,12 @@ std::unique_lock<BuiltinFunctionsLib::MutexType> BuiltinFunctionsLib::obtainUniq
 }
 
 void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
+    auto builtinData = loadBuiltinKernel(func);
+    std::lock_guard<std::mutex> lock(this->builtinsMutex);
+    builtins[static_cast<uint32_t>(func)] = std::move(builtinData);
+}
+
+std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltinKernel(Builtin func) {
     const char *kernelName = nullptr;
     NEO::EBuiltInOps::Type builtin;
 
@@ -149,11 +159,16 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         UNRECOVERABLE_IF(true);
     };
 
-    auto builtId = static_cast<uint32_t>(func);
-    builtins[builtId] = loadBuiltIn(builtin, kernelName);
+    return loadBuiltIn(builtin, kernelName);
 }
 
 void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
+    auto builtinData = loadBuiltinImageKernel(func);
+    std::lock_guard<std::mutex> lock(this->builtinsMutex);
+    imageBuiltins[static_cast<uint32_t>(func)] = std::move(builtinData);
+}
+
+std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltinImageKernel(ImageBuiltin func) {
     const char *builtinName = nullptr;
     NEO::EBuiltInOps::Type builtin;
 
@@ -297,11 +312,13 @@ void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
     default:
         UNRECOVERABLE_IF(true);
     };
-    auto builtId = static_cast<uint32_t>(func);
-    imageBuiltins[builtId] = loadBuiltIn(builtin, builtinName);
+    return loadBuiltIn(builtin, builtinName);
 }
 
 BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib) : device(device), builtInsLib(builtInsLib) {
+    this->modules.resize(NEO::EBuiltInOps::count);
+    this->moduleMutexes = std::vector<std::mutex>(NEO::EBuiltInOps::count);
+
     if (initBuiltinsAsyncEnabled(device)) {
         this->initAsyncComplete = false;
 
@@ -322,12 +339,19 @@ BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *
         std::thread initAsyncThread(initFunc);
         initAsyncThread.detach();
     }
+
+    if (NEO::debugManager.flags.EnableBuiltinsWarmUp.get() == 1) {
+        this->startWarmUp();
+    }
 }
 
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
 
     this->ensureInitCompletion();
+    if (this->warmUpEnabled) {
+        return getOrLoadBuiltin(builtins[builtId], [this, func]() { return this->loadBuiltinKernel(func); });
+    }
     if (builtins[builtId].get() == nullptr) {
         initBuiltinKernel(func);
     }
@@ -339,6 +363,9 @@ Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     auto builtId = static_cast<uint32_t>(func);
 
     this->ensureInitCompletion();
+    if (this->warmUpEnabled) {
+        return getOrLoadBuiltin(imageBuiltins[builtId], [this, func]() { return this->loadBuiltinImageKernel(func); });
+    }
     if (imageBuiltins[builtId].get() == nullptr) {
         initBuiltinImageKernel(func);
     }
@@ -346,6 +373,138 @@ Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     return imageBuiltins[builtId]->func.get();
 }
 
+/*
+ * Builtin not yet published by warm-up is loaded on calling thread, so API calls never wait for the whole warm-up.
+ * Module of the builtin is created only once, whichever thread gets to it first.
+ */
+Kernel *BuiltinFunctionsLibImpl::getOrLoadBuiltin(std::unique_ptr<BuiltinData> &builtin, const std::function<std::unique_ptr<BuiltinData>()> &load) {
+    {
+        std::lock_guard<std::mutex> lock(this->builtinsMutex);
+        if (builtin.get() != nullptr) {
+            return builtin->func.get();
+        }
+    }
+
+    publishBuiltin(builtin, load());
+
+    std::lock_guard<std::mutex> lock(this->builtinsMutex);
+    return builtin->func.get();
+}
+
+void BuiltinFunctionsLibImpl::publishBuiltin(std::unique_ptr<BuiltinData> &builtin, std::unique_ptr<BuiltinData> &&builtinData) {
+    std::lock_guard<std::mutex> lock(this->builtinsMutex);
+    if (builtin.get() == nullptr) {
+        builtin = std::move(builtinData);
+    }
+}
+
+std::vector<BuiltinFunctionsLibImpl::WarmUpEntry> BuiltinFunctionsLibImpl::getWarmUpEntries() const {
+    using namespace BuiltinTypeHelper;
+    const auto &compilerProductHelper = this->device->getCompilerProductHelper();
+    const bool isHeapless = compilerProductHelper.isHeaplessModeEnabled(this->device->getHwInfo());
+    const bool isStateless = compilerProductHelper.isForceToStatelessRequired();
+
+    const Builtin bufferBuiltins[] = {
+        adjustBuiltinType<Builtin::fillBufferImmediate>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::fillBufferImmediateLeftOver>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::fillBufferSSHOffset>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::fillBufferMiddle>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::fillBufferRightLeftover>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::copyBufferBytes>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::copyBufferToBufferMiddle>(isStateless, isHeapless),
+        adjustBuiltinType<Builtin::copyBufferToBufferSide>(isStateless, isHeapless),
+        Builtin::copyBufferRectBytes2d,
+        Builtin::copyBufferRectBytes3d,
+        Builtin::queryKernelTimestamps,
+        Builtin::queryKernelTimestampsWithOffsets};
+
+    std::vector<WarmUpEntry> entries;
+    for (auto builtin : bufferBuiltins) {
+        entries.push_back({static_cast<uint32_t>(builtin), false});
+    }
+
+    if (this->device->getNEODevice()->getDeviceInfo().imageSupport) {
+        const ImageBuiltin imageBuiltins[] = {
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3d16Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3d2Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3d4Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3d3To4Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3d8Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3d6To8Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyBufferToImage3dBytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer16Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer2Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer3Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer4Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer4To3Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer6Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer8Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBuffer8To6Bytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImage3dToBufferBytes>(isHeapless),
+            adjustImageBuiltinType<ImageBuiltin::copyImageRegion>(isHeapless)};
+        for (auto builtin : imageBuiltins) {
+            entries.push_back({static_cast<uint32_t>(builtin), true});
+        }
+    }
+    return entries;
+}
+
+void BuiltinFunctionsLibImpl::startWarmUp() {
+    this->warmUpEnabled = true;
+    this->warmUpThread = std::thread(&BuiltinFunctionsLibImpl::warmUp, this, getWarmUpEntries());
+}
+
+/*
+ * Loads builtins expected by command lists of this device on several threads, builtins of the same module
+ * are serialized on module creation. Each builtin is published as soon as it is ready.
+ */
+void BuiltinFunctionsLibImpl::warmUp(std::vector<WarmUpEntry> entries) {
+    constexpr uint32_t maxWarmUpThreads = 4u;
+    auto warmUpStart = std::chrono::steady_clock::now();
+
+    std::atomic<size_t> nextEntry = 0u;
+    auto warmUpWorker = [this, &entries, &nextEntry]() {
+        for (auto entryId = nextEntry++; entryId < entries.size() && !this->warmUpCancelled.load(); entryId = nextEntry++) {
+            const auto &entry = entries[entryId];
+            auto &builtin = entry.isImageBuiltin ? this->imageBuiltins[entry.builtId] : this->builtins[entry.builtId];
+            {
+                std::lock_guard<std::mutex> lock(this->builtinsMutex);
+                if (builtin.get() != nullptr) {
+                    continue;
+                }
+            }
+            auto builtinData = entry.isImageBuiltin ? this->loadBuiltinImageKernel(static_cast<ImageBuiltin>(entry.builtId))
+                                                    : this->loadBuiltinKernel(static_cast<Builtin>(entry.builtId));
+            if (builtinData.get() != nullptr) {
+                this->publishBuiltin(builtin, std::move(builtinData));
+                this->warmedUpBuiltinsCount++;
+            }
+        }
+    };
+
+    auto threadsCount = std::min({std::max(std::thread::hardware_concurrency(), 1u), maxWarmUpThreads, static_cast<uint32_t>(entries.size())});
+    std::vector<std::thread> workers;
+    for (auto i = 1u; i < threadsCount; i++) {
+        workers.emplace_back(warmUpWorker);
+    }
+    warmUpWorker();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    auto warmUpTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - warmUpStart).count();
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout,
+                       "Builtins warm-up: %u of %zu builtins loaded on %u threads in %" PRId64 " us\n",
+                       this->warmedUpBuiltinsCount.load(), entries.size(), threadsCount, static_cast<int64_t>(warmUpTime));
+}
+
+void BuiltinFunctionsLibImpl::stopWarmUp() {
+    this->warmUpCancelled.store(true);
+    if (this->warmUpThread.joinable()) {
+        this->warmUpThread.join();
+    }
+}
+
 std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) {
     using BuiltInCodeType = NEO::BuiltinCode::ECodeType;
 
@@ -376,9 +535,8 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 
     [[maybe_unused]] ze_result_t res;
 
-    if (this->modules.size() <= builtin) {
-        this->modules.resize(builtin + 1u);
-    }
+    UNRECOVERABLE_IF(builtin >= this->modules.size());
+    std::lock_guard<std::mutex> moduleLock(this->moduleMutexes[builtin]);
 
     if (this->modules[builtin].get() == nullptr) {
         std::unique_ptr<Module> module;
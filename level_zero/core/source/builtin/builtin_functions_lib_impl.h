@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,11 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/module/module.h"
 
+#include <atomic>
+#include <functional>
 #include <future>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace NEO {
@@ -28,6 +32,7 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib);
     ~BuiltinFunctionsLibImpl() override {
         this->ensureInitCompletionImpl();
+        this->stopWarmUp();
     }
 
     Kernel *getFunction(Builtin func) override;
@@ -41,7 +46,23 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     static bool initBuiltinsAsyncEnabled(Device *device);
 
   protected:
+    struct WarmUpEntry {
+        uint32_t builtId;
+        bool isImageBuiltin;
+    };
+
+    std::unique_ptr<BuiltinData> loadBuiltinKernel(Builtin func);
+    std::unique_ptr<BuiltinData> loadBuiltinImageKernel(ImageBuiltin func);
+    Kernel *getOrLoadBuiltin(std::unique_ptr<BuiltinData> &builtin, const std::function<std::unique_ptr<BuiltinData>()> &load);
+    void publishBuiltin(std::unique_ptr<BuiltinData> &builtin, std::unique_ptr<BuiltinData> &&builtinData);
+    std::vector<WarmUpEntry> getWarmUpEntries() const;
+    void startWarmUp();
+    void warmUp(std::vector<WarmUpEntry> entries);
+    void stopWarmUp();
+
     std::vector<std::unique_ptr<Module>> modules = {};
+    std::vector<std::mutex> moduleMutexes;
+    std::mutex builtinsMutex;
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::count)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::count)];
     Device *device;
@@ -49,6 +70,11 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
 
     bool initAsyncComplete = true;
     std::atomic_bool initAsync = false;
+
+    bool warmUpEnabled = false;
+    std::atomic_bool warmUpCancelled = false;
+    std::atomic<uint32_t> warmedUpBuiltinsCount = 0u;
+    std::thread warmUpThread;
 };
 struct BuiltinFunctionsLibImpl::BuiltinData {
     MOCKABLE_VIRTUAL ~BuiltinData();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/direct_submission_publish_scope.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
@@ -458,6 +459,7 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
     }
 
     auto csr = cmdQImp->getCsr();
+    NEO::DirectSubmissionPublishScope directSubmissionPublishScope;
     auto lockCSR = outerLock != nullptr ? std::move(*outerLock) : csr->obtainUniqueOwnership();
 
     std::unique_lock<std::mutex> lockForIndirect;
@@ -533,6 +535,7 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
     }
 
     lockCSR.unlock();
+    directSubmissionPublishScope.publish();
     ze_result_t status = ZE_RESULT_SUCCESS;
     cmdQ->setTaskCount(completionStamp.taskCount);
 
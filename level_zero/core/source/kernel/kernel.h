@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 
 #include "level_zero/core/source/helpers/api_handle_helper.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -72,6 +73,15 @@ struct KernelImmutableData {
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
 
+    void setKernelInfo(NEO::KernelInfo *kernelInfo) {
+        this->kernelInfo = kernelInfo;
+        this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    }
+
+    bool isInitialized() const {
+        return initialized.load(std::memory_order_acquire);
+    }
+
     void setIsaCopiedToAllocation() {
         isaCopiedToAllocation = true;
     }
@@ -84,6 +94,8 @@ struct KernelImmutableData {
                                                    NEO::GraphicsAllocation *globalVarBuffer);
 
   protected:
+    void addGlobalBufferToResidencyContainer(NEO::GraphicsAllocation *globalBuffer);
+
     Device *device = nullptr;
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
@@ -103,7 +115,8 @@ struct KernelImmutableData {
 
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
-    bool isaCopiedToAllocation = false;
+    std::atomic<bool> isaCopiedToAllocation = false;
+    std::atomic<bool> initialized = false;
 };
 
 struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI, NEO::NonCopyableAndNonMovableClass {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,7 @@
 #include "encode_surface_state_args.h"
 #include "implicit_args.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace L0 {
@@ -76,8 +77,7 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
                                             bool internalKernel) {
 
     UNRECOVERABLE_IF(kernelInfo == nullptr);
-    this->kernelInfo = kernelInfo;
-    this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    setKernelInfo(kernelInfo);
 
     DeviceImp *deviceImp = static_cast<DeviceImp *>(device);
     auto neoDevice = deviceImp->getActiveDevice();
@@ -138,9 +138,9 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
                                  static_cast<uintptr_t>(globalConstBuffer->getGpuAddressToPatch()),
                                  *globalConstBuffer, kernelDescriptor->payloadMappings.implicitArgs.globalConstantsSurfaceAddress,
                                  *neoDevice, deviceImp->isImplicitScalingCapable());
-        this->residencyContainer.push_back(globalConstBuffer);
+        addGlobalBufferToResidencyContainer(globalConstBuffer);
     } else if (nullptr != globalConstBuffer) {
-        this->residencyContainer.push_back(globalConstBuffer);
+        addGlobalBufferToResidencyContainer(globalConstBuffer);
     }
 
     if (globalConstBuffer && NEO::isValidOffset(kernelDescriptor->payloadMappings.implicitArgs.globalConstantsSurfaceAddress.bindless)) {
@@ -161,9 +161,9 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
                                  static_cast<uintptr_t>(globalVarBuffer->getGpuAddressToPatch()),
                                  *globalVarBuffer, kernelDescriptor->payloadMappings.implicitArgs.globalVariablesSurfaceAddress,
                                  *neoDevice, deviceImp->isImplicitScalingCapable());
-        this->residencyContainer.push_back(globalVarBuffer);
+        addGlobalBufferToResidencyContainer(globalVarBuffer);
     } else if (nullptr != globalVarBuffer) {
-        this->residencyContainer.push_back(globalVarBuffer);
+        addGlobalBufferToResidencyContainer(globalVarBuffer);
     }
 
     if (globalVarBuffer && NEO::isValidOffset(kernelDescriptor->payloadMappings.implicitArgs.globalVariablesSurfaceAddress.bindless)) {
@@ -177,9 +177,19 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
                                                          *neoDevice, deviceImp->isImplicitScalingCapable(), ssInHeap, kernelInfo->kernelDescriptor);
     }
 
+    initialized.store(true, std::memory_order_release);
     return ZE_RESULT_SUCCESS;
 }
 
+/*
+ * Initialization of a lazily initialized kernel is retried after a failure, and linking may already have added allocations.
+ */
+void KernelImmutableData::addGlobalBufferToResidencyContainer(NEO::GraphicsAllocation *globalBuffer) {
+    if (std::find(residencyContainer.begin(), residencyContainer.end(), globalBuffer) == residencyContainer.end()) {
+        residencyContainer.push_back(globalBuffer);
+    }
+}
+
 void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer) {
     NEO::Linker::SegmentInfo globalData;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,8 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/program/decoded_program_cache.h"
+#include "shared/source/program/isa_upload_batcher.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/metadata_generation.h"
 #include "shared/source/program/program_initialization.h"
@@ -56,6 +58,7 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -378,7 +381,13 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     NEO::DecodeError decodeError;
     NEO::DeviceBinaryFormat singleDeviceBinaryFormat;
     auto &gfxCoreHelper = device->getGfxCoreHelper();
-    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
+    NEO::CompilerCache *compilerCache = nullptr;
+    if (NEO::debugManager.flags.EnableDecodedProgramCache.get() == 1) {
+        auto compilerInterface = device->getNEODevice()->getCompilerInterface();
+        compilerCache = compilerInterface ? compilerInterface->getCache() : nullptr;
+    }
+    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::DecodedProgramCache::decodeSingleDeviceBinary(compilerCache, device->getHwInfo().ipVersion.value, programInfo, binary,
+                                                                                                         decodeErrors, decodeWarnings, gfxCoreHelper);
     if (decodeWarnings.empty() == false) {
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
     }
@@ -515,6 +524,9 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 }
 
 ModuleImp::~ModuleImp() {
+    if (this->lazyKernelImmutableDataInit) {
+        printLazyKernelImmutableDataInitStats();
+    }
     for (auto &kernel : this->printfKernelContainer) {
         if (kernel.get() != nullptr) {
             destroyPrintfKernel(kernel->toHandle());
@@ -642,23 +654,43 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->setIsaCopiedToAllocation();
         }
     } else {
+        NEO::IsaUploadBatcher isaUploadBatcher(*neoDevice);
         for (auto &kernelImmData : kernelImmDatas) {
-            if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+            if (this->lazyKernelImmutableDataInit && !kernelImmData->isInitialized()) {
+                // copied on first use of the kernel
                 continue;
             }
-            kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
-
-            auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
-                                                                  *neoDevice,
-                                                                  kernelImmData->getIsaGraphicsAllocation(),
-                                                                  0u,
-                                                                  kernelHeapPtr,
-                                                                  kernelHeapSize);
-            kernelImmData->setIsaCopiedToAllocation();
+            transferKernelIsaToAllocation(neoDevice, kernelImmData, isaSegmentsForPatching, &isaUploadBatcher);
         }
+        isaUploadBatcher.upload();
+    }
+}
+
+/*
+ * When batcher is passed, ISA is only queued and is written to allocation by IsaUploadBatcher::upload.
+ */
+void ModuleImp::transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching,
+                                              NEO::IsaUploadBatcher *isaUploadBatcher) {
+    if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+        return;
     }
+    kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+
+    auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
+    if (isaUploadBatcher) {
+        isaUploadBatcher->add(kernelImmData->getIsaGraphicsAllocation(), 0u, kernelHeapPtr, kernelHeapSize);
+    } else {
+        const auto &productHelper = neoDevice->getProductHelper();
+        auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
+        NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
+                                                              *neoDevice,
+                                                              kernelImmData->getIsaGraphicsAllocation(),
+                                                              0u,
+                                                              kernelHeapPtr,
+                                                              kernelHeapSize);
+    }
+    kernelImmData->setIsaCopiedToAllocation();
 }
 
 std::pair<const void *, size_t> ModuleImp::getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData,
@@ -790,10 +822,20 @@ inline bool ModuleImp::shouldBuildBeFailed(NEO::Device *neoDevice) {
 
 ze_result_t ModuleImp::initializeKernelImmutableDatas() {
     if (size_t kernelsCount = this->translationUnit->programInfo.kernelInfos.size(); kernelsCount > 0lu) {
+        this->lazyKernelImmutableDataInit = (NEO::debugManager.flags.EnableLazyKernelImmutableDataInit.get() == 1) &&
+                                            (this->type == ModuleType::user) &&
+                                            (this->device->getL0Debugger() == nullptr);
         ze_result_t result;
         if (result = this->allocateKernelImmutableDatas(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+        if (this->lazyKernelImmutableDataInit) {
+            for (size_t i = 0lu; i < kernelsCount; i++) {
+                kernelImmDatas[i]->setKernelInfo(this->translationUnit->programInfo.kernelInfos[i]);
+            }
+            this->lazyKernelImmutableDataInitStats.deferredKernelsCount = static_cast<uint32_t>(kernelsCount);
+            return ZE_RESULT_SUCCESS;
+        }
         for (size_t i = 0lu; i < kernelsCount; i++) {
             result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
                                                    device,
@@ -810,6 +852,109 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
     return ZE_RESULT_SUCCESS;
 }
 
+/*
+ * Thread-safe one-shot initialization of a kernel deferred by lazy module creation.
+ * ISA is allocated and copied before the immutable data is published as initialized.
+ */
+ze_result_t ModuleImp::initializeKernelImmutableDataOnFirstUse(const char *kernelName) {
+    if (!this->lazyKernelImmutableDataInit) {
+        return ZE_RESULT_SUCCESS;
+    }
+    auto kernelImmDataIt = std::find_if(kernelImmDatas.begin(), kernelImmDatas.end(), [kernelName](const auto &kernelImmData) {
+        return kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(kernelName) == 0;
+    });
+    if (kernelImmDataIt == kernelImmDatas.end()) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return initializeDeferredKernelImmutableData(static_cast<size_t>(kernelImmDataIt - kernelImmDatas.begin()));
+}
+
+/*
+ * Debug zebin describes ISA of every kernel, so all deferred kernels are initialized before it is created.
+ */
+ze_result_t ModuleImp::initializeAllDeferredKernelImmutableDatas() {
+    if (!this->lazyKernelImmutableDataInit) {
+        return ZE_RESULT_SUCCESS;
+    }
+    for (size_t i = 0lu; i < kernelImmDatas.size(); i++) {
+        if (auto result = initializeDeferredKernelImmutableData(i); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ModuleImp::initializeDeferredKernelImmutableData(size_t kernelId) {
+    auto &kernelImmData = kernelImmDatas[kernelId];
+    if (kernelImmData->isInitialized()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(this->lazyKernelImmutableDataInitMutex);
+    if (kernelImmData->isInitialized()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto initializationStart = std::chrono::steady_clock::now();
+    auto kernelInfo = this->translationUnit->programInfo.kernelInfos[kernelId];
+    auto neoDevice = this->device->getNEODevice();
+
+    if (kernelImmData->getIsaGraphicsAllocation() == nullptr) {
+        auto allocation = this->allocateKernelsIsaMemory(kernelInfo->heapInfo.kernelHeapSize);
+        if (allocation == nullptr) {
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+        kernelImmData->setIsaPerKernelAllocation(allocation);
+        this->lazyKernelImmutableDataInitStats.unallocatedIsaSize -= kernelInfo->heapInfo.kernelHeapSize;
+    }
+    if (this->isFullyLinked && !this->sharedIsaAllocation) {
+        this->transferKernelIsaToAllocation(neoDevice, kernelImmData, this->isaSegmentsForPatching.empty() ? nullptr : &this->isaSegmentsForPatching);
+    }
+
+    auto result = kernelImmData->initialize(kernelInfo,
+                                            device,
+                                            neoDevice->getDeviceInfo().computeUnitsUsedForScratch,
+                                            this->translationUnit->globalConstBuffer,
+                                            this->translationUnit->globalVarBuffer,
+                                            false);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto initializationTime = std::chrono::steady_clock::now() - initializationStart;
+    this->lazyKernelImmutableDataInitStats.initializationTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(initializationTime).count();
+    this->lazyKernelImmutableDataInitStats.initializedKernelsCount++;
+    return ZE_RESULT_SUCCESS;
+}
+
+/*
+ * Time saved is estimated from the average first-use initialization time of kernels actually used.
+ */
+void ModuleImp::printLazyKernelImmutableDataInitStats() const {
+    const auto &stats = this->lazyKernelImmutableDataInitStats;
+    auto skippedKernelsCount = stats.deferredKernelsCount - stats.initializedKernelsCount;
+    int64_t averageInitializationTimeNs = (stats.initializedKernelsCount > 0) ? stats.initializationTimeNs / stats.initializedKernelsCount : 0;
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr,
+                       "Lazy kernel immutable data init: %u of %u kernels initialized on first use in %" PRId64 " ns, %u kernels never initialized (~%" PRId64 " ns saved), %zu bytes of ISA never allocated\n",
+                       stats.initializedKernelsCount, stats.deferredKernelsCount, stats.initializationTimeNs,
+                       skippedKernelsCount, averageInitializationTimeNs * skippedKernelsCount, stats.unallocatedIsaSize);
+}
+
+/*
+ * Kernel ISA addresses must be known at module creation when instructions are patched or referenced by symbols.
+ */
+bool ModuleImp::isIsaAddressRequiredForLinking() const {
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    if (linkerInput == nullptr) {
+        return false;
+    }
+    if (linkerInput->getTraits().exportsFunctions || linkerInput->getTraits().requiresPatchingOfInstructionSegments || linkerInput->getExportedFunctionsSegmentId() >= 0) {
+        return true;
+    }
+    const auto &symbols = linkerInput->getSymbols();
+    return std::any_of(symbols.begin(), symbols.end(), [](const auto &symbol) { return symbol.second.segment == NEO::SegmentType::instructions; });
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
@@ -838,7 +983,7 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     }
 
     bool debuggerDisabled = (this->device->getL0Debugger() == nullptr);
-    if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize) {
+    if (debuggerDisabled && kernelsIsaTotalSize <= this->getMaxSharedIsaAllocationSize()) {
         auto neoDevice = this->device->getNEODevice();
         auto &isaAllocator = neoDevice->getIsaPoolAllocator();
         auto crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(this->type == ModuleType::builtin, kernelsIsaTotalSize);
@@ -853,8 +998,13 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
             this->kernelImmDatas[i]->setIsaSubAllocationSize(isaSize);
         }
     } else {
+        bool deferIsaAllocations = this->lazyKernelImmutableDataInit && !this->isIsaAddressRequiredForLinking();
         for (auto i = 0lu; i < kernelsCount; i++) {
             auto kernelInfo = this->translationUnit->programInfo.kernelInfos[i];
+            if (deferIsaAllocations) {
+                this->lazyKernelImmutableDataInitStats.unallocatedIsaSize += kernelInfo->heapInfo.kernelHeapSize;
+                continue;
+            }
             if (auto allocation = this->allocateKernelsIsaMemory(kernelInfo->heapInfo.kernelHeapSize); allocation == nullptr) {
                 return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
             } else {
@@ -865,6 +1015,19 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     return ZE_RESULT_SUCCESS;
 }
 
+/*
+ * By default only modules fitting within single page share pooled ISA.
+ * Multi-page pooling packs larger modules contiguously into the ISA pool, so they are uploaded with a single copy
+ * instead of using one allocation per kernel. Kernels with deferred ISA allocation keep per-kernel allocations.
+ */
+size_t ModuleImp::getMaxSharedIsaAllocationSize() const {
+    if (NEO::debugManager.flags.EnableMultiPageIsaPooling.get() == 1 &&
+        !(this->lazyKernelImmutableDataInit && !this->isIsaAddressRequiredForLinking())) {
+        return std::numeric_limits<size_t>::max();
+    }
+    return this->isaAllocationPageSize;
+}
+
 size_t ModuleImp::computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel) {
     auto isaPadding = lastKernel ? this->device->getGfxCoreHelper().getPaddingForISAAllocation() : 0u;
     auto kernelStartPointerAlignment = this->device->getGfxCoreHelper().getKernelIsaPointerAlignment();
@@ -996,6 +1159,11 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED;
     }
+    res = initializeKernelImmutableDataOnFirstUse(desc->pKernelName);
+    if (res != ZE_RESULT_SUCCESS) {
+        driverHandle->clearErrorDescription();
+        return res;
+    }
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
@@ -1048,6 +1216,9 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
     }
 
     if (nullptr == translationUnit->debugData.get() && isZebinBinary) {
+        if (auto result = initializeAllDeferredKernelImmutableDatas(); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
         createDebugZebin();
     }
     if (pDebugData != nullptr) {
@@ -1200,6 +1371,9 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     // If the Function Pointer is not in the exported symbol table, then this function might be a kernel.
     // Check if the function name matches a kernel and return the gpu address to that function
     if (*pfnFunction == nullptr) {
+        if (auto result = initializeKernelImmutableDataOnFirstUse(pFunctionName); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
@@ -1701,7 +1875,9 @@ StackVec<NEO::GraphicsAllocation *, 32> ModuleImp::getModuleAllocations() {
     } else {
         // ISA allocations not optimized
         for (auto &kernImmData : kernelImmDatas) {
-            allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+            if (kernImmData->getIsaGraphicsAllocation()) {
+                allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+            }
         }
     }
 
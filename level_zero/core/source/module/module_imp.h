@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,10 +18,12 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
 namespace NEO {
+class IsaUploadBatcher;
 struct KernelDescriptor;
 struct MetadataGeneration;
 class SharedPoolAllocation;
@@ -180,6 +182,11 @@ struct ModuleImp : public Module {
     bool shouldBuildBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    ze_result_t initializeKernelImmutableDataOnFirstUse(const char *kernelName);
+    ze_result_t initializeAllDeferredKernelImmutableDatas();
+    ze_result_t initializeDeferredKernelImmutableData(size_t kernelId);
+    bool isIsaAddressRequiredForLinking() const;
+    void printLazyKernelImmutableDataInitStats() const;
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Zebin::Debug::Segments getZebinSegments();
@@ -189,7 +196,10 @@ struct ModuleImp : public Module {
     void notifyModuleDestroy();
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
+    size_t getMaxSharedIsaAllocationSize() const;
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    void transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching,
+                                       NEO::IsaUploadBatcher *isaUploadBatcher = nullptr);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
@@ -212,6 +222,16 @@ struct ModuleImp : public Module {
 
     std::unordered_map<std::string, HostGlobalSymbol> hostGlobalSymbolsMap;
 
+    struct LazyKernelImmutableDataInitStats {
+        uint32_t deferredKernelsCount = 0;
+        uint32_t initializedKernelsCount = 0;
+        size_t unallocatedIsaSize = 0;
+        int64_t initializationTimeNs = 0;
+    };
+
+    std::mutex lazyKernelImmutableDataInitMutex;
+    LazyKernelImmutableDataInitStats lazyKernelImmutableDataInitStats;
+
     bool builtFromSpirv = false;
     bool isFullyLinked = false;
     bool allocatePrivateMemoryPerDispatch = true;
@@ -219,6 +239,7 @@ struct ModuleImp : public Module {
     bool isFunctionSymbolExportEnabled = false;
     bool isGlobalSymbolExportEnabled = false;
     bool precompiled = false;
+    bool lazyKernelImmutableDataInit = false;
     ModuleType type;
     NEO::Linker::UnresolvedExternals unresolvedExternalsInfo{};
     std::set<NEO::GraphicsAllocation *> importedSymbolAllocations{};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -161,6 +161,107 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, whenCreateBuiltinFunctionsLibThenImmediate
     MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
 }
 
+struct MockWarmUpBuiltinFunctionsLibImpl : BuiltinFunctionsLibImpl {
+    using BuiltinFunctionsLibImpl::builtins;
+    using BuiltinFunctionsLibImpl::getWarmUpEntries;
+    using BuiltinFunctionsLibImpl::imageBuiltins;
+    using BuiltinFunctionsLibImpl::startWarmUp;
+    using BuiltinFunctionsLibImpl::warmedUpBuiltinsCount;
+    using BuiltinFunctionsLibImpl::warmUpEnabled;
+    using BuiltinFunctionsLibImpl::warmUpThread;
+
+    MockWarmUpBuiltinFunctionsLibImpl(L0::Device *device, NEO::BuiltIns *builtInsLib) : BuiltinFunctionsLibImpl(device, builtInsLib) {
+        mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
+    }
+
+    std::unique_ptr<BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) override {
+        loadBuiltInCalled++;
+        std::unique_ptr<Kernel> mockKernel(new Mock<::L0::KernelImp>());
+        return std::unique_ptr<BuiltinData>(new BuiltinData{mockModule.get(), std::move(mockKernel)});
+    }
+
+    std::atomic<uint32_t> loadBuiltInCalled = 0u;
+    std::unique_ptr<Module> mockModule;
+};
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinsWarmUpWhenWarmUpCompletesThenAllWarmUpBuiltinsArePublishedAndReusedByGetFunction) {
+    MockWarmUpBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_FALSE(lib.warmUpEnabled);
+
+    auto entries = lib.getWarmUpEntries();
+    ASSERT_FALSE(entries.empty());
+    lib.startWarmUp();
+    EXPECT_TRUE(lib.warmUpEnabled);
+    lib.warmUpThread.join();
+
+    EXPECT_EQ(entries.size(), lib.loadBuiltInCalled.load());
+    EXPECT_EQ(entries.size(), lib.warmedUpBuiltinsCount.load());
+    for (auto &entry : entries) {
+        if (entry.isImageBuiltin) {
+            ASSERT_NE(nullptr, lib.imageBuiltins[entry.builtId]);
+            EXPECT_EQ(lib.imageBuiltins[entry.builtId]->func.get(), lib.getImageFunction(static_cast<ImageBuiltin>(entry.builtId)));
+        } else {
+            ASSERT_NE(nullptr, lib.builtins[entry.builtId]);
+            EXPECT_EQ(lib.builtins[entry.builtId]->func.get(), lib.getFunction(static_cast<Builtin>(entry.builtId)));
+        }
+    }
+    EXPECT_EQ(entries.size(), lib.loadBuiltInCalled.load());
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinsWarmUpWhenBuiltinIsAlreadyLoadedThenWarmUpSkipsIt) {
+    MockWarmUpBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+
+    auto entries = lib.getWarmUpEntries();
+    ASSERT_FALSE(entries.empty());
+    ASSERT_FALSE(entries[0].isImageBuiltin);
+    auto preloadedKernel = lib.getFunction(static_cast<Builtin>(entries[0].builtId));
+    EXPECT_EQ(1u, lib.loadBuiltInCalled.load());
+
+    lib.startWarmUp();
+    lib.warmUpThread.join();
+
+    EXPECT_EQ(entries.size(), lib.loadBuiltInCalled.load());
+    EXPECT_EQ(entries.size() - 1, lib.warmedUpBuiltinsCount.load());
+    EXPECT_EQ(preloadedKernel, lib.getFunction(static_cast<Builtin>(entries[0].builtId)));
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinsWarmUpWhenGettingBuiltinNotCoveredByWarmUpThenItIsLoadedOnCallingThreadOnce) {
+    MockWarmUpBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    lib.startWarmUp();
+    lib.warmUpThread.join();
+    auto loadsAfterWarmUp = lib.loadBuiltInCalled.load();
+
+    auto entries = lib.getWarmUpEntries();
+    auto notWarmedUp = Builtin::count;
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        if (std::none_of(entries.begin(), entries.end(), [&](auto &entry) { return !entry.isImageBuiltin && entry.builtId == builtId; })) {
+            notWarmedUp = static_cast<Builtin>(builtId);
+            break;
+        }
+    }
+    ASSERT_NE(Builtin::count, notWarmedUp);
+    EXPECT_EQ(nullptr, lib.builtins[static_cast<uint32_t>(notWarmedUp)]);
+
+    auto kernel = lib.getFunction(notWarmedUp);
+    EXPECT_NE(nullptr, kernel);
+    EXPECT_EQ(kernel, lib.getFunction(notWarmedUp));
+    EXPECT_EQ(loadsAfterWarmUp + 1, lib.loadBuiltInCalled.load());
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenImagesNotSupportedWhenGettingWarmUpEntriesThenOnlyBufferBuiltinsAreIncluded) {
+    MockWarmUpBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    VariableBackup<uint32_t> imageSupportBackup(&neoDevice->deviceInfo.imageSupport, 0u);
+
+    auto entries = lib.getWarmUpEntries();
+    EXPECT_FALSE(entries.empty());
+    EXPECT_TRUE(std::none_of(entries.begin(), entries.end(), [](auto &entry) { return entry.isImageBuiltin; }));
+
+    const auto &compilerProductHelper = device->getCompilerProductHelper();
+    auto expectedFillBuiltin = BuiltinTypeHelper::adjustBuiltinType<Builtin::fillBufferImmediate>(compilerProductHelper.isForceToStatelessRequired(),
+                                                                                                  compilerProductHelper.isHeaplessModeEnabled(device->getHwInfo()));
+    EXPECT_TRUE(std::any_of(entries.begin(), entries.end(), [&](auto &entry) { return entry.builtId == static_cast<uint32_t>(expectedFillBuiltin); }));
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenHeaplessBuiltinsWhenInitBuiltinKernelThenCorrectArgumentsArePassed) {
 
     MockCheckPassedArgumentsBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
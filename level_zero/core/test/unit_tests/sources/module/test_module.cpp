@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -218,6 +218,69 @@ struct ModuleKernelIsaAllocationsFixture : public ModuleFixture {
         EXPECT_EQ(result, ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY);
     }
 
+    void givenMultiPageIsaPoolingEnabledWhenModuleIsaExceedsSinglePageThenKernelsArePackedIntoSharedIsaAllocation() {
+        debugManager.flags.EnableMultiPageIsaPooling.set(1);
+        mockModule->computeKernelIsaAllocationAlignedSizeWithPaddingCallBase = false;
+        mockModule->computeKernelIsaAllocationAlignedSizeWithPaddingResult = isaAllocationPageSize;
+
+        auto result = module->initialize(&this->moduleDesc, device->getNEODevice());
+        EXPECT_EQ(result, ZE_RESULT_SUCCESS);
+        EXPECT_EQ(0u, mockModule->allocateKernelsIsaMemoryCalled);
+
+        auto isaParentAllocation = mockModule->getKernelsIsaParentAllocation();
+        ASSERT_NE(nullptr, isaParentAllocation);
+        auto &kernelImmDatas = mockModule->kernelImmDatas;
+        ASSERT_EQ(zebinData->numOfKernels, kernelImmDatas.size());
+        auto expectedOffset = kernelImmDatas[0]->getIsaOffsetInParentAllocation();
+        for (auto &kernelImmData : kernelImmDatas) {
+            EXPECT_EQ(isaParentAllocation, kernelImmData->getIsaParentAllocation());
+            EXPECT_EQ(expectedOffset, kernelImmData->getIsaOffsetInParentAllocation());
+            EXPECT_EQ(isaAllocationPageSize, kernelImmData->getIsaSubAllocationSize());
+            EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+            expectedOffset += isaAllocationPageSize;
+        }
+    }
+
+    void givenSeparateIsaMemoryRegionPerKernelWhenModuleIsCreatedThenIsaOfAllKernelsIsUploadedInSingleBatch() {
+        debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::cpuAccessDisallowed));
+        mockModule->computeKernelIsaAllocationAlignedSizeWithPaddingCallBase = false;
+        mockModule->computeKernelIsaAllocationAlignedSizeWithPaddingResult = isaAllocationPageSize;
+
+        uint32_t perKernelBlitsCount = 0u;
+        VariableBackup<NEO::BlitHelperFunctions::BlitMemoryToAllocationFunc> blitBackup{
+            &NEO::BlitHelperFunctions::blitMemoryToAllocation, [&](const NEO::Device &, NEO::GraphicsAllocation *, size_t, const void *, const Vec3<size_t> &) {
+                perKernelBlitsCount++;
+                return NEO::BlitOperationResult::success;
+            }};
+        uint32_t batchedBlitsCount = 0u;
+        size_t batchedTransfersCount = 0u;
+        VariableBackup<NEO::BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitsBackup{
+            &NEO::BlitHelperFunctions::blitMemoryToAllocations, [&](const NEO::Device &, const void *, size_t, const NEO::BlitMemoryToAllocationEntries &entries) {
+                batchedBlitsCount++;
+                batchedTransfersCount += entries.size();
+                return NEO::BlitOperationResult::success;
+            }};
+
+        auto result = module->initialize(&this->moduleDesc, device->getNEODevice());
+        EXPECT_EQ(result, ZE_RESULT_SUCCESS);
+        EXPECT_EQ(zebinData->numOfKernels, mockModule->allocateKernelsIsaMemoryCalled);
+
+        auto &kernelImmDatas = mockModule->kernelImmDatas;
+        ASSERT_EQ(zebinData->numOfKernels, kernelImmDatas.size());
+        for (auto &kernelImmData : kernelImmDatas) {
+            EXPECT_EQ(nullptr, kernelImmData->getIsaParentAllocation());
+            EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+        }
+
+        EXPECT_EQ(0u, perKernelBlitsCount);
+        if (kernelImmDatas[0]->getIsaGraphicsAllocation()->isAllocatedInLocalMemoryPool()) {
+            EXPECT_EQ(1u, batchedBlitsCount);
+            EXPECT_EQ(kernelImmDatas.size(), batchedTransfersCount);
+        } else {
+            EXPECT_EQ(0u, batchedBlitsCount);
+        }
+    }
+
     Mock<Module> *mockModule = nullptr;
     ze_module_desc_t moduleDesc = {};
     std::unique_ptr<DebugManagerStateRestore> dbgRestorer = nullptr;
@@ -233,6 +296,14 @@ HWTEST_F(ModuleKernelIsaAllocationsInLocalMemoryTests, givenSeparateIsaMemoryReg
     this->givenSeparateIsaMemoryRegionPerKernelWhenGraphicsAllocationFailsThenProperErrorReturned();
 }
 
+HWTEST_F(ModuleKernelIsaAllocationsInLocalMemoryTests, givenMultiPageIsaPoolingEnabledWhenModuleIsaExceedsSinglePageThenKernelsArePackedIntoSharedIsaAllocation) {
+    this->givenMultiPageIsaPoolingEnabledWhenModuleIsaExceedsSinglePageThenKernelsArePackedIntoSharedIsaAllocation();
+}
+
+HWTEST_F(ModuleKernelIsaAllocationsInLocalMemoryTests, givenSeparateIsaMemoryRegionPerKernelWhenModuleIsCreatedThenIsaOfAllKernelsIsUploadedInSingleBatch) {
+    this->givenSeparateIsaMemoryRegionPerKernelWhenModuleIsCreatedThenIsaOfAllKernelsIsUploadedInSingleBatch();
+}
+
 using ModuleKernelIsaAllocationsInSharedMemoryTests = Test<ModuleKernelIsaAllocationsFixture<false>>;
 
 HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenIsaMemoryRegionSharedBetweenKernelsWhenGraphicsAllocationFailsThenProperErrorReturned) {
@@ -243,6 +314,165 @@ HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenSeparateIsaMemoryRe
     this->givenSeparateIsaMemoryRegionPerKernelWhenGraphicsAllocationFailsThenProperErrorReturned();
 }
 
+HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenMultiPageIsaPoolingEnabledWhenModuleIsaExceedsSinglePageThenKernelsArePackedIntoSharedIsaAllocation) {
+    this->givenMultiPageIsaPoolingEnabledWhenModuleIsaExceedsSinglePageThenKernelsArePackedIntoSharedIsaAllocation();
+}
+
+HWTEST_F(ModuleKernelIsaAllocationsInSharedMemoryTests, givenSeparateIsaMemoryRegionPerKernelWhenModuleIsCreatedThenIsaOfAllKernelsIsUploadedInSingleBatch) {
+    this->givenSeparateIsaMemoryRegionPerKernelWhenModuleIsCreatedThenIsaOfAllKernelsIsUploadedInSingleBatch();
+}
+
+struct ModuleLazyKernelImmutableDataInitFixture : public ModuleFixture {
+    struct LazyInitModule : public WhiteBox<::L0::Module> {
+        LazyInitModule(L0::Device *device, ModuleType type) : WhiteBox(device, nullptr, type) {}
+
+        size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel) override {
+            if (separateIsaAllocations) {
+                return MemoryConstants::pageSize2M;
+            }
+            return WhiteBox::computeKernelIsaAllocationAlignedSizeWithPadding(isaSize, lastKernel);
+        }
+
+        bool separateIsaAllocations = false;
+    };
+
+    void setUp() {
+        ModuleFixture::setUp();
+        debugManager.flags.EnableLazyKernelImmutableDataInit.set(1);
+
+        zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+        const auto &src = zebinData->storage;
+        this->moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+        this->moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(src.data());
+        this->moduleDesc.inputSize = src.size();
+    }
+
+    DebugManagerStateRestore restorer;
+    ze_module_desc_t moduleDesc = {};
+};
+
+using ModuleLazyKernelImmutableDataInitTests = Test<ModuleLazyKernelImmutableDataInitFixture>;
+
+HWTEST_F(ModuleLazyKernelImmutableDataInitTests, givenLazyInitEnabledWhenCreatingKernelThenOnlyThisKernelImmutableDataIsInitialized) {
+    auto lazyModule = std::make_unique<LazyInitModule>(device, ModuleType::user);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, lazyModule->initialize(&moduleDesc, device->getNEODevice()));
+    EXPECT_TRUE(lazyModule->lazyKernelImmutableDataInit);
+    ASSERT_EQ(2u, lazyModule->kernelImmDatas.size());
+    for (auto &kernelImmData : lazyModule->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isInitialized());
+        EXPECT_EQ(lazyModule->translationUnit->programInfo.kernelInfos[&kernelImmData - &lazyModule->kernelImmDatas[0]], kernelImmData->getKernelInfo());
+    }
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = "test";
+    ze_kernel_handle_t kernelHandles[2] = {};
+    for (auto &kernelHandle : kernelHandles) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->createKernel(&kernelDesc, &kernelHandle));
+    }
+
+    EXPECT_TRUE(lazyModule->kernelImmDatas[0]->isInitialized());
+    EXPECT_TRUE(lazyModule->kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_FALSE(lazyModule->kernelImmDatas[1]->isInitialized());
+    EXPECT_EQ(2u, lazyModule->lazyKernelImmutableDataInitStats.deferredKernelsCount);
+    EXPECT_EQ(1u, lazyModule->lazyKernelImmutableDataInitStats.initializedKernelsCount);
+
+    for (auto &kernelHandle : kernelHandles) {
+        Kernel::fromHandle(kernelHandle)->destroy();
+    }
+}
+
+HWTEST_F(ModuleLazyKernelImmutableDataInitTests, givenLazyInitEnabledAndSeparateIsaAllocationsWhenGettingFunctionPointerThenIsaIsAllocatedOnlyForThisKernel) {
+    auto lazyModule = std::make_unique<LazyInitModule>(device, ModuleType::user);
+    lazyModule->separateIsaAllocations = true;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, lazyModule->initialize(&moduleDesc, device->getNEODevice()));
+    ASSERT_EQ(2u, lazyModule->kernelImmDatas.size());
+    EXPECT_EQ(nullptr, lazyModule->getKernelsIsaParentAllocation());
+
+    auto &kernelInfos = lazyModule->translationUnit->programInfo.kernelInfos;
+    size_t totalIsaSize = kernelInfos[0]->heapInfo.kernelHeapSize + kernelInfos[1]->heapInfo.kernelHeapSize;
+    EXPECT_EQ(totalIsaSize, lazyModule->lazyKernelImmutableDataInitStats.unallocatedIsaSize);
+    for (auto &kernelImmData : lazyModule->kernelImmDatas) {
+        EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    void *functionPointer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->getFunctionPointer("memcpy_bytes_attr", &functionPointer));
+
+    auto &usedKernelImmData = lazyModule->kernelImmDatas[1];
+    ASSERT_NE(nullptr, usedKernelImmData->getIsaGraphicsAllocation());
+    EXPECT_EQ(reinterpret_cast<void *>(usedKernelImmData->getIsaGraphicsAllocation()->getGpuAddress()), functionPointer);
+    EXPECT_TRUE(usedKernelImmData->isInitialized());
+    EXPECT_TRUE(usedKernelImmData->isIsaCopiedToAllocation());
+    EXPECT_EQ(0, memcmp(usedKernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer(), kernelInfos[1]->heapInfo.pKernelHeap, kernelInfos[1]->heapInfo.kernelHeapSize));
+
+    EXPECT_EQ(nullptr, lazyModule->kernelImmDatas[0]->getIsaGraphicsAllocation());
+    EXPECT_FALSE(lazyModule->kernelImmDatas[0]->isInitialized());
+    EXPECT_EQ(kernelInfos[0]->heapInfo.kernelHeapSize, lazyModule->lazyKernelImmutableDataInitStats.unallocatedIsaSize);
+}
+
+HWTEST_F(ModuleLazyKernelImmutableDataInitTests, givenLazyInitEnabledAndPrintDebugMessagesWhenModuleIsDestroyedThenStatsArePrinted) {
+    debugManager.flags.PrintDebugMessages.set(1);
+    auto lazyModule = std::make_unique<LazyInitModule>(device, ModuleType::user);
+    lazyModule->separateIsaAllocations = true;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, lazyModule->initialize(&moduleDesc, device->getNEODevice()));
+    auto unallocatedIsaSize = lazyModule->lazyKernelImmutableDataInitStats.unallocatedIsaSize;
+
+    StreamCapture capture;
+    capture.captureStderr();
+    lazyModule.reset();
+    std::string output = capture.getCapturedStderr();
+
+    std::string expectedOutput = "Lazy kernel immutable data init: 0 of 2 kernels initialized on first use in 0 ns, 2 kernels never initialized (~0 ns saved), " +
+                                 std::to_string(unallocatedIsaSize) + " bytes of ISA never allocated\n";
+    EXPECT_EQ(expectedOutput, output);
+}
+
+HWTEST_F(ModuleLazyKernelImmutableDataInitTests, givenLazyInitEnabledAndSeparateIsaAllocationsWhenGettingDebugInfoThenAllKernelsAreInitializedBeforeDebugZebinIsCreated) {
+    auto lazyModule = std::make_unique<LazyInitModule>(device, ModuleType::user);
+    lazyModule->separateIsaAllocations = true;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, lazyModule->initialize(&moduleDesc, device->getNEODevice()));
+    for (auto &kernelImmData : lazyModule->kernelImmDatas) {
+        EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    size_t debugDataSize = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->getDebugInfo(&debugDataSize, nullptr));
+    EXPECT_NE(0u, debugDataSize);
+
+    for (auto &kernelImmData : lazyModule->kernelImmDatas) {
+        EXPECT_TRUE(kernelImmData->isInitialized());
+        EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+    EXPECT_EQ(2u, lazyModule->lazyKernelImmutableDataInitStats.initializedKernelsCount);
+    EXPECT_EQ(0u, lazyModule->lazyKernelImmutableDataInitStats.unallocatedIsaSize);
+}
+
+HWTEST_F(ModuleLazyKernelImmutableDataInitTests, givenKernelImmutableDataInitializationRetriedThenGlobalBuffersAreAddedToResidencyContainerOnce) {
+    auto lazyModule = std::make_unique<LazyInitModule>(device, ModuleType::user);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, lazyModule->initialize(&moduleDesc, device->getNEODevice()));
+
+    MockGraphicsAllocation globalConstBuffer;
+    MockGraphicsAllocation globalVarBuffer;
+    auto &kernelImmData = lazyModule->kernelImmDatas[0];
+    auto kernelInfo = lazyModule->translationUnit->programInfo.kernelInfos[0];
+    for (auto i = 0u; i < 2u; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, kernelImmData->initialize(kernelInfo, device, 0, &globalConstBuffer, &globalVarBuffer, false));
+    }
+
+    auto &residencyContainer = kernelImmData->getResidencyContainer();
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &globalConstBuffer));
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &globalVarBuffer));
+}
+
+HWTEST_F(ModuleLazyKernelImmutableDataInitTests, givenLazyInitEnabledWhenBuiltinModuleIsCreatedThenKernelImmutableDatasAreInitializedEagerly) {
+    auto builtinModule = std::make_unique<LazyInitModule>(device, ModuleType::builtin);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, builtinModule->initialize(&moduleDesc, device->getNEODevice()));
+    EXPECT_FALSE(builtinModule->lazyKernelImmutableDataInit);
+    for (auto &kernelImmData : builtinModule->kernelImmDatas) {
+        EXPECT_TRUE(kernelImmData->isInitialized());
+    }
+}
+
 HWTEST_F(ModuleTest, givenBuiltinModuleWhenCreatedThenCorrectAllocationTypeIsUsedForIsa) {
     this->module.reset();
     createModuleFromMockBinary(ModuleType::builtin);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2025 Intel Corporation
+ * Copyright (C) 2025-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/event/event.h"
@@ -1587,6 +1588,27 @@ HWCMDTEST_F(IGFX_XE_HP_CORE,
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_KERNEL_ATTRIBUTE_VALUE, result);
 }
 
+TEST(MutableResidencyAllocationsTest, givenSortedImmutableResidencyWhenPopulatingInputResidencyContainerThenAllocationsAlreadyPresentAreNotAddedAgain) {
+    MockGraphicsAllocation allocations[3];
+    MockGraphicsAllocation newAllocation;
+    NEO::ResidencyContainer cmdListResidency = {&allocations[2], &allocations[0], &allocations[1]};
+    std::sort(cmdListResidency.begin(), cmdListResidency.end());
+
+    WhiteBoxMutableResidencyAllocations mutableAllocations;
+    mutableAllocations.addAllocation(&allocations[0]);
+    mutableAllocations.addAllocation(&allocations[1]);
+    mutableAllocations.addAllocation(&allocations[2]);
+    mutableAllocations.addAllocation(&newAllocation);
+
+    mutableAllocations.populateInputResidencyContainer(cmdListResidency, false);
+    ASSERT_EQ(4u, cmdListResidency.size());
+    EXPECT_EQ(&newAllocation, cmdListResidency[3]);
+
+    mutableAllocations.populateInputResidencyContainer(cmdListResidency, true);
+    ASSERT_EQ(4u, cmdListResidency.size());
+    EXPECT_EQ(&newAllocation, cmdListResidency[3]);
+}
+
 using MutableCommandListInOrderTest = Test<MutableCommandListFixture<true>>;
 
 HWCMDTEST_F(IGFX_XE_HP_CORE,
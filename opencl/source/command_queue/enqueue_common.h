@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
+#include "shared/source/direct_submission/direct_submission_publish_scope.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/bcs_ccs_dependency_pair_container.h"
 #include "shared/source/helpers/engine_node_helper.h"
@@ -165,6 +166,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     std::unique_ptr<KernelOperation> blockedCommandsData;
     std::unique_ptr<PrintfHandler> printfHandler;
+    DirectSubmissionPublishScope directSubmissionPublishScope;
     TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
     auto commandStreamReceiverOwnership = computeCommandStreamReceiver.obtainUniqueOwnership();
 
@@ -477,6 +479,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     commandStreamReceiverOwnership.unlock();
     queueOwnership.unlock();
+    directSubmissionPublishScope.publish();
 
     if (blocking) {
         auto waitStatus = WaitStatus::ready;
@@ -13,6 +13,8 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
 #include "shared/source/helpers/compiler_options_parser.h"
+#include "shared/source/helpers/compiler_product_helper.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/utilities/logger.h"
 
@@ -111,9 +113,25 @@ cl_int Program::build(
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
             NEO::TranslationOutput compilerOuput = {};
 
+            // root devices sharing hw ip version get the same device binary, so it is compiled only once for them
+            struct UniqueBuild {
+                uint32_t rootDeviceIndex;
+                std::string frontendCompilerLog;
+                std::string backendCompilerLog;
+            };
+            std::unordered_map<uint32_t, UniqueBuild> uniqueBuilds;
+            const bool deduplicateBuilds = debugManager.flags.EnableProgramBuildDeduplication.get() == 1;
+
             for (const auto &clDevice : deviceVector) {
+                auto rootDeviceIndex = clDevice->getRootDeviceIndex();
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
-                    this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
+                    this->updateBuildLog(rootDeviceIndex, CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
+                }
+                auto hwIpVersion = clDevice->getCompilerProductHelper().getHwIpVersion(clDevice->getHardwareInfo());
+                auto uniqueBuildIt = deduplicateBuilds ? uniqueBuilds.find(hwIpVersion) : uniqueBuilds.end();
+                if (uniqueBuildIt != uniqueBuilds.end()) {
+                    reuseDeviceBuild(uniqueBuildIt->second.rootDeviceIndex, rootDeviceIndex, uniqueBuildIt->second.frontendCompilerLog, uniqueBuildIt->second.backendCompilerLog, phaseReached);
+                    continue;
                 }
                 auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
@@ -134,10 +152,17 @@ cl_int Program::build(
                 }
                 this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
                 phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::binaryCreation;
+                // only freshly compiled device binary can be reused, binary of device which skipped replacing it may come from elsewhere
+                if (deduplicateBuilds) {
+                    uniqueBuilds.emplace(hwIpVersion, UniqueBuild{rootDeviceIndex, compilerOuput.frontendCompilerLog, compilerOuput.backendCompilerLog});
+                }
             }
             if (retVal != CL_SUCCESS) {
                 break;
             }
+            if (deduplicateBuilds) {
+                PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "clBuildProgram: %zu compiler invocation(s) for %zu device(s)\n", uniqueBuilds.size(), deviceVector.size());
+            }
         }
         updateNonUniformFlag();
 
@@ -213,6 +238,29 @@ void Program::extractInternalOptions(const std::string &options, std::string &in
     }
 }
 
+void Program::reuseDeviceBuild(uint32_t srcRootDeviceIndex, uint32_t dstRootDeviceIndex, const std::string &frontendCompilerLog, const std::string &backendCompilerLog,
+                               std::unordered_map<uint32_t, BuildPhase> &phaseReached) {
+    if (srcRootDeviceIndex == dstRootDeviceIndex) {
+        return;
+    }
+    updateBuildLog(dstRootDeviceIndex, frontendCompilerLog.c_str(), frontendCompilerLog.size());
+    updateBuildLog(dstRootDeviceIndex, backendCompilerLog.c_str(), backendCompilerLog.size());
+
+    auto &srcBuildInfo = buildInfos[srcRootDeviceIndex];
+    auto &dstBuildInfo = buildInfos[dstRootDeviceIndex];
+    dstBuildInfo.debugData = makeCopy<char>(srcBuildInfo.debugData.get(), srcBuildInfo.debugDataSize);
+    dstBuildInfo.debugDataSize = srcBuildInfo.debugDataSize;
+    if (BuildPhase::binaryCreation == phaseReached[dstRootDeviceIndex]) {
+        return;
+    }
+    if (nullptr != srcBuildInfo.packedDeviceBinary) {
+        replaceDeviceBinary(makeCopy<char>(srcBuildInfo.packedDeviceBinary.get(), srcBuildInfo.packedDeviceBinarySize), srcBuildInfo.packedDeviceBinarySize, dstRootDeviceIndex);
+    } else {
+        replaceDeviceBinary(makeCopy<char>(srcBuildInfo.unpackedDeviceBinary.get(), srcBuildInfo.unpackedDeviceBinarySize), srcBuildInfo.unpackedDeviceBinarySize, dstRootDeviceIndex);
+    }
+    phaseReached[dstRootDeviceIndex] = BuildPhase::binaryCreation;
+}
+
 void Program::debugNotify(const ClDeviceVector &deviceVector, std::unordered_map<uint32_t, BuildPhase> &phasesReached) {
     for (auto &clDevice : deviceVector) {
         auto rootDeviceIndex = clDevice->getRootDeviceIndex();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,10 +21,12 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/program/isa_upload_batcher.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/utilities/time_measure_wrapper.h"
+#include "shared/source/utilities/worker_threads.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
@@ -33,6 +35,8 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 
 using namespace iOpenCL;
 
@@ -106,7 +110,10 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, size_
         strings.segmentSize = stringsInfo.size;
     }
     if (linkerInput->getExportedFunctionsSegmentId() >= 0) {
-        exportedFunctionsKernelId = static_cast<size_t>(linkerInput->getExportedFunctionsSegmentId());
+        {
+            std::lock_guard<std::mutex> lock(binaryProcessingMutex);
+            exportedFunctionsKernelId = static_cast<size_t>(linkerInput->getExportedFunctionsSegmentId());
+        }
         // Exported functions reside in instruction heap of one of kernels
         auto exportedFunctionHeapId = linkerInput->getExportedFunctionsSegmentId();
         buildInfos[rootDeviceIndex].exportedFunctionsSurface = kernelInfoArray[exportedFunctionHeapId]->getGraphicsAllocation();
@@ -151,39 +158,74 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, size_
         updateBuildLog(pDevice->getRootDeviceIndex(), error.c_str(), error.size());
         return CL_INVALID_BINARY;
     } else if (linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        IsaUploadBatcher isaUploadBatcher(*pDevice);
         for (auto kernelId = 0u; kernelId < kernelInfoArray.size(); kernelId++) {
             const auto &kernelInfo = kernelInfoArray[kernelId];
             auto &kernHeapInfo = kernelInfo->heapInfo;
             auto segmentId = &kernelInfo - &kernelInfoArray[0];
-            auto &rootDeviceEnvironment = pDevice->getRootDeviceEnvironment();
-            const auto &productHelper = pDevice->getProductHelper();
-            MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelInfo->getGraphicsAllocation()),
-                                                             *pDevice, kernelInfo->getGraphicsAllocation(), 0, isaSegmentsForPatching[segmentId].hostPointer,
-                                                             static_cast<size_t>(kernHeapInfo.kernelHeapSize));
+            isaUploadBatcher.add(kernelInfo->getGraphicsAllocation(), 0, isaSegmentsForPatching[segmentId].hostPointer,
+                                 static_cast<size_t>(kernHeapInfo.kernelHeapSize));
         }
+        isaUploadBatcher.upload();
     }
     DBG_LOG(PrintRelocations, NEO::constructRelocationsDebugMessage(this->getSymbols(pDevice->getRootDeviceIndex())));
     return CL_SUCCESS;
 }
 
 cl_int Program::processGenBinaries(const ClDeviceVector &clDevices, std::unordered_map<uint32_t, BuildPhase> &phaseReached) {
-    cl_int retVal = CL_SUCCESS;
+    auto processDevice = [this](const ClDevice &clDevice) {
+        if (debugManager.flags.PrintProgramBinaryProcessingTime.get()) {
+            return TimeMeasureWrapper::functionExecution(*this, &Program::processGenBinary, clDevice);
+        }
+        return processGenBinary(clDevice);
+    };
+
+    std::vector<const ClDevice *> devicesToProcess;
     for (auto &clDevice : clDevices) {
-        if (BuildPhase::binaryProcessing == phaseReached[clDevice->getRootDeviceIndex()]) {
+        auto rootDeviceIndex = clDevice->getRootDeviceIndex();
+        if (BuildPhase::binaryProcessing == phaseReached[rootDeviceIndex]) {
             continue;
         }
-        if (debugManager.flags.PrintProgramBinaryProcessingTime.get()) {
-            retVal = TimeMeasureWrapper::functionExecution(*this, &Program::processGenBinary, *clDevice);
-        } else {
-            retVal = processGenBinary(*clDevice);
+        if (std::none_of(devicesToProcess.begin(), devicesToProcess.end(), [&](auto device) { return device->getRootDeviceIndex() == rootDeviceIndex; })) {
+            devicesToProcess.push_back(clDevice);
         }
+    }
 
-        if (retVal != CL_SUCCESS) {
-            break;
+    // binary decoded ahead of processing is stored in program, so it can be processed only for single device
+    const bool processInParallel = (debugManager.flags.EnableParallelProgramBinaryProcessing.get() == 1) &&
+                                   (devicesToProcess.size() > 1u) &&
+                                   (false == decodedSingleDeviceBinary.isSet);
+    if (false == processInParallel) {
+        cl_int retVal = CL_SUCCESS;
+        for (auto clDevice : devicesToProcess) {
+            retVal = processDevice(*clDevice);
+            if (retVal != CL_SUCCESS) {
+                break;
+            }
+            phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::binaryProcessing;
+        }
+        return retVal;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<cl_int> retVals(devicesToProcess.size(), CL_SUCCESS);
+    std::atomic<size_t> nextDevice{0u};
+    runOnWorkerThreads(devicesToProcess.size(), [&]() {
+        for (auto i = nextDevice++; i < devicesToProcess.size(); i = nextDevice++) {
+            retVals[i] = processDevice(*devicesToProcess[i]);
+        }
+    });
+    std::chrono::duration<double, std::milli> elapsedTime = std::chrono::steady_clock::now() - start;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "clBuildProgram: processed binaries of %zu devices in parallel in %f ms\n", devicesToProcess.size(), elapsedTime.count());
+
+    // report first failure in device order, as serial processing does
+    for (auto i = 0u; i < devicesToProcess.size(); i++) {
+        if (retVals[i] != CL_SUCCESS) {
+            return retVals[i];
         }
-        phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::binaryProcessing;
+        phaseReached[devicesToProcess[i]->getRootDeviceIndex()] = BuildPhase::binaryProcessing;
     }
-    return retVal;
+    return CL_SUCCESS;
 }
 
 cl_int Program::processGenBinary(const ClDevice &clDevice) {
@@ -201,6 +243,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
             this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinarySize);
             this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = singleDeviceBinarySize;
 
+            std::lock_guard<std::mutex> lock(binaryProcessingMutex);
             this->isGeneratedByIgc = singleDeviceBinary.generator == GeneratorType::igc;
             this->indirectDetectionVersion = singleDeviceBinary.generatorFeatureVersions.indirectMemoryAccessDetection;
             this->indirectAccessBufferMajorVersion = singleDeviceBinary.generatorFeatureVersions.indirectAccessBuffer;
@@ -224,30 +267,31 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
         buildInfo.globalSurface = nullptr;
     }
 
+    // decoding into local storage keeps processing of different root devices independent
+    DecodedSingleDeviceBinary decodedBinary;
     if (!decodedSingleDeviceBinary.isSet) {
-        decodedSingleDeviceBinary.programInfo = {};
-
         auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
         SingleDeviceBinary binary = {};
         binary.deviceBinary = blob;
         binary.targetDevice = NEO::getTargetDevice(clDevice.getRootDeviceEnvironment());
 
         auto &gfxCoreHelper = clDevice.getGfxCoreHelper();
-        std::tie(decodedSingleDeviceBinary.decodeError, std::ignore) = NEO::decodeSingleDeviceBinary(decodedSingleDeviceBinary.programInfo, binary, decodedSingleDeviceBinary.decodeErrors, decodedSingleDeviceBinary.decodeWarnings, gfxCoreHelper);
+        std::tie(decodedBinary.decodeError, std::ignore) = NEO::decodeSingleDeviceBinary(decodedBinary.programInfo, binary, decodedBinary.decodeErrors, decodedBinary.decodeWarnings, gfxCoreHelper);
     } else {
-        decodedSingleDeviceBinary.isSet = false;
+        decodedBinary = std::move(decodedSingleDeviceBinary);
+        decodedSingleDeviceBinary = {};
     }
 
-    if (decodedSingleDeviceBinary.decodeWarnings.empty() == false) {
-        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodedSingleDeviceBinary.decodeWarnings.c_str());
+    if (decodedBinary.decodeWarnings.empty() == false) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodedBinary.decodeWarnings.c_str());
     }
 
-    if (DecodeError::success != decodedSingleDeviceBinary.decodeError) {
-        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodedSingleDeviceBinary.decodeErrors.c_str());
+    if (DecodeError::success != decodedBinary.decodeError) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodedBinary.decodeErrors.c_str());
         return CL_INVALID_BINARY;
     }
 
-    return this->processProgramInfo(decodedSingleDeviceBinary.programInfo, clDevice);
+    return this->processProgramInfo(decodedBinary.programInfo, clDevice);
 }
 
 cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
@@ -309,10 +353,11 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     }
     buildInfos[rootDeviceIndex].kernelMiscInfoPos = src.kernelMiscInfoPos;
 
+    IsaUploadBatcher isaUploadBatcher(clDevice.getDevice());
     for (auto &kernelInfo : kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
         if (kernelInfo->heapInfo.kernelHeapSize) {
-            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn, &isaUploadBatcher) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
         }
 
         if (retVal != CL_SUCCESS) {
@@ -321,9 +366,15 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
 
         kernelInfo->apply(deviceInfoConstants);
     }
+    if (false == isaUploadBatcher.upload()) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
 
-    indirectDetectionVersion = src.indirectDetectionVersion;
-    indirectAccessBufferMajorVersion = src.indirectAccessBufferMajorVersion;
+    {
+        std::lock_guard<std::mutex> lock(binaryProcessingMutex);
+        indirectDetectionVersion = src.indirectDetectionVersion;
+        indirectAccessBufferMajorVersion = src.indirectAccessBufferMajorVersion;
+    }
 
     return linkBinary(&clDevice.getDevice(), src.globalConstants.initData, src.globalConstants.size, src.globalVariables.initData,
                       src.globalVariables.size, src.globalStrings, src.externalFunctions);
@@ -293,6 +293,8 @@ class Program : public BaseObject<_cl_program> {
     void updateNonUniformFlag(const Program **inputProgram, size_t numInputPrograms);
 
     void extractInternalOptions(const std::string &options, std::string &internalOptions);
+    void reuseDeviceBuild(uint32_t srcRootDeviceIndex, uint32_t dstRootDeviceIndex, const std::string &frontendCompilerLog, const std::string &backendCompilerLog,
+                          std::unordered_map<uint32_t, BuildPhase> &phaseReached);
     MOCKABLE_VIRTUAL bool isFlagOption(ConstStringRef option);
     MOCKABLE_VIRTUAL bool isOptionValueValid(ConstStringRef option, ConstStringRef value);
 
@@ -378,6 +380,7 @@ class Program : public BaseObject<_cl_program> {
 
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     std::mutex lockMutex;
+    std::mutex binaryProcessingMutex;
     uint32_t exposedKernels = 0;
 
     size_t exportedFunctionsKernelId = std::numeric_limits<size_t>::max();
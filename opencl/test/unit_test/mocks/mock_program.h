@@ -177,11 +177,13 @@ class MockProgram : public Program {
     }
     cl_int processGenBinary(const ClDevice &clDevice) override {
         auto rootDeviceIndex = clDevice.getRootDeviceIndex();
+        std::unique_lock<std::mutex> lock{processGenBinaryCalledMutex};
         if (processGenBinaryCalledPerRootDevice.find(rootDeviceIndex) == processGenBinaryCalledPerRootDevice.end()) {
             processGenBinaryCalledPerRootDevice.insert({rootDeviceIndex, 1});
         } else {
             processGenBinaryCalledPerRootDevice[rootDeviceIndex]++;
         }
+        lock.unlock();
         return Program::processGenBinary(clDevice);
     }
 
@@ -228,6 +230,7 @@ class MockProgram : public Program {
 
     std::vector<NEO::ExternalFunctionInfo> externalFunctions;
     std::map<uint32_t, int> processGenBinaryCalledPerRootDevice;
+    std::mutex processGenBinaryCalledMutex;
     std::map<uint32_t, int> replaceDeviceBinaryCalledPerRootDevice;
     static int getInternalOptionsCalled;
     bool contextSet = false;
@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/memory_management.h"
 #include "shared/test/common/mocks/mock_deferrable_deletion.h"
 #include "shared/test/common/mocks/mock_deferred_deleter.h"
@@ -136,3 +137,21 @@ TEST_F(DeferredDeleterMtTest, WhenForcingSafeStopThenDeferredDeleterIsStopped) {
     deleter->removeClient();
     EXPECT_EQ(0, deleter->getClientsNum());
 }
+
+TEST(DeferredDeleterMaxLatencyMtTest, givenMaxDeferralLatencySetWhenDeletionsAreDeferredThenBackgroundThreadReleasesThem) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DeferredDeleterMaxLatencyUs.set(100);
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+    auto deleter = std::make_unique<MyDeferredDeleter>();
+
+    deleter->addClient();
+    for (int i = 0; i < 10; i++) {
+        deleter->deferDeletion(new MockDeferrableDeletion());
+    }
+    while (deleter->getElementsToRelease() != 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(deleter->isQueueEmpty());
+    deleter->removeClient();
+    EXPECT_FALSE(deleter->isThreadRunning());
+}
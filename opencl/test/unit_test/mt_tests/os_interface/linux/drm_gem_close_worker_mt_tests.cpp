@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -189,3 +190,68 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenBufferObjectsAreClosedThenTelemetryIsUpdated) {
+    this->drmMock->gemCloseExpected = 2;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    EXPECT_EQ(1u, worker->getWorkersCount());
+    EXPECT_EQ(0u, worker->getAverageCloseLatencyNs());
+
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 2, 0, 1));
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(2u, worker->getClosedBufferObjectsCount());
+    EXPECT_LE(1u, worker->getMaxQueueDepth());
+    EXPECT_GE(2u, worker->getMaxQueueDepth());
+    EXPECT_LE(worker->getAverageCloseLatencyNs(), worker->getMaxCloseLatencyNs());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleGemCloseWorkerThreadsWhenManyBufferObjectsArePushedThenAllAreClosed) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.DrmGemCloseWorkerThreadsCount.set(4);
+    constexpr int bufferObjectsCount = 1000;
+    this->drmMock->gemCloseExpected = bufferObjectsCount;
+
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::additionalThreads;
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::thread;
+    };
+
+    auto worker = std::make_unique<MockDrmGemCloseWorker>(*mm);
+    EXPECT_EQ(4u, worker->getWorkersCount());
+    EXPECT_EQ(3u, worker->additionalThreads.size());
+
+    for (int i = 0; i < bufferObjectsCount; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, i + 1, 0, 1));
+    }
+
+    while (!worker->isEmpty() && (deadCnt-- > 0)) {
+        sched_yield();
+    }
+    EXPECT_TRUE(worker->isEmpty());
+
+    worker->close(true);
+    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->additionalThreads.empty());
+    EXPECT_EQ(static_cast<uint64_t>(bufferObjectsCount), worker->getClosedBufferObjectsCount());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleGemCloseWorkerThreadsWhenClosedWithPendingBufferObjectsThenAllAreClosedBeforeWorkersExit) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.DrmGemCloseWorkerThreadsCount.set(4);
+    constexpr int bufferObjectsCount = 1000;
+    this->drmMock->gemCloseExpected = bufferObjectsCount;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    for (int i = 0; i < bufferObjectsCount; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, i + 1, 0, 1));
+    }
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(static_cast<uint64_t>(bufferObjectsCount), worker->getClosedBufferObjectsCount());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/utilities/arrayref.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -34,6 +35,7 @@
 #include "shared/test/common/helpers/mock_file_io.h"
 #include "shared/test/common/helpers/stream_capture.h"
 #include "shared/test/common/helpers/test_files.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/global_environment.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_ail_configuration.h"
@@ -3410,6 +3412,153 @@ TEST(BuildProgramTest, givenMultiDeviceProgramWhenBuildingThenStoreKernelInfoPer
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST(BuildProgramTest, givenMultiDeviceProgramWithSameHwIpVersionWhenBuildingThenCompileOnceAndReuseDeviceBinaryForOtherRootDevices) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableProgramBuildDeduplication.set(1);
+    debugManager.flags.PrintDebugMessages.set(true);
+
+    MockZebinWrapper zebin{*defaultHwInfo};
+    zebin.setAsMockCompilerReturnedBinary();
+
+    const char *source = "example_kernel(){}";
+    size_t sourceSize = std::strlen(source) + 1;
+    const char *sources[1] = {source};
+
+    MockUnrestrictiveContextMultiGPU context;
+    cl_int retVal = CL_INVALID_PROGRAM;
+    auto pProgram = Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    StreamCapture capture;
+    capture.captureStdout();
+    retVal = clBuildProgram(pProgram, 0, nullptr, nullptr, nullptr, nullptr);
+    auto output = capture.getCapturedStdout();
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto expectedLog = "clBuildProgram: 1 compiler invocation(s) for " + std::to_string(context.getDevices().size()) + " device(s)";
+    EXPECT_TRUE(hasSubstr(output, expectedLog));
+
+    auto &firstBuildInfo = pProgram->buildInfos[context.getRootDeviceIndices()[0]];
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        EXPECT_EQ(1, pProgram->replaceDeviceBinaryCalledPerRootDevice[rootDeviceIndex]);
+        EXPECT_EQ(1, pProgram->processGenBinaryCalledPerRootDevice[rootDeviceIndex]);
+        auto &buildInfo = pProgram->buildInfos[rootDeviceIndex];
+        ASSERT_EQ(firstBuildInfo.packedDeviceBinarySize, buildInfo.packedDeviceBinarySize);
+        EXPECT_EQ(0, memcmp(firstBuildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinarySize));
+        EXPECT_LT(0u, buildInfo.kernelInfoArray.size());
+    }
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST(BuildProgramTest, givenBuildDeduplicationNotEnabledWhenBuildingMultiDeviceProgramThenCompileForEachDevice) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintDebugMessages.set(true);
+
+    MockZebinWrapper zebin{*defaultHwInfo};
+    zebin.setAsMockCompilerReturnedBinary();
+
+    const char *source = "example_kernel(){}";
+    size_t sourceSize = std::strlen(source) + 1;
+    const char *sources[1] = {source};
+
+    MockUnrestrictiveContextMultiGPU context;
+    cl_int retVal = CL_INVALID_PROGRAM;
+    auto pProgram = Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    StreamCapture capture;
+    capture.captureStdout();
+    retVal = clBuildProgram(pProgram, 0, nullptr, nullptr, nullptr, nullptr);
+    auto output = capture.getCapturedStdout();
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(hasSubstr(output, "compiler invocation(s)"));
+
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        EXPECT_EQ(1, pProgram->replaceDeviceBinaryCalledPerRootDevice[rootDeviceIndex]);
+    }
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST(BuildProgramTest, givenParallelBinaryProcessingEnabledWhenBuildingMultiDeviceProgramThenProcessBinaryOncePerRootDeviceAndStoreKernelInfos) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelProgramBinaryProcessing.set(1);
+    debugManager.flags.PrintDebugMessages.set(true);
+
+    MockZebinWrapper zebin{*defaultHwInfo};
+    zebin.setAsMockCompilerReturnedBinary();
+
+    const char *source = "example_kernel(){}";
+    size_t sourceSize = std::strlen(source) + 1;
+    const char *sources[1] = {source};
+
+    MockUnrestrictiveContextMultiGPU context;
+    cl_int retVal = CL_INVALID_PROGRAM;
+    auto pProgram = Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    StreamCapture capture;
+    capture.captureStdout();
+    retVal = clBuildProgram(pProgram, 0, nullptr, nullptr, nullptr, nullptr);
+    auto output = capture.getCapturedStdout();
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(hasSubstr(output, "processed binaries of " + std::to_string(context.getRootDeviceIndices().size()) + " devices in parallel"));
+
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        EXPECT_EQ(1, pProgram->processGenBinaryCalledPerRootDevice[rootDeviceIndex]);
+        EXPECT_LT(0u, pProgram->getNumKernels());
+        for (auto i = 0u; i < pProgram->getNumKernels(); i++) {
+            EXPECT_NE(nullptr, pProgram->getKernelInfo(i, rootDeviceIndex));
+        }
+    }
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST(BuildProgramTest, givenParallelBinaryProcessingEnabledAndWorkerThreadsNotRunningWhenBuildingMultiDeviceProgramThenAllRootDevicesAreProcessedOnCallingThread) {
+    struct IdleWorkerThread : public Thread {
+        void join() override {}
+        void detach() override {}
+        void yield() override {}
+    };
+    VariableBackup<decltype(Thread::createFunc)> createFuncBackup{&Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> {
+                                                                       return std::make_unique<IdleWorkerThread>();
+                                                                   }};
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelProgramBinaryProcessing.set(1);
+
+    MockZebinWrapper zebin{*defaultHwInfo};
+    zebin.setAsMockCompilerReturnedBinary();
+
+    const char *source = "example_kernel(){}";
+    size_t sourceSize = std::strlen(source) + 1;
+    const char *sources[1] = {source};
+
+    MockUnrestrictiveContextMultiGPU context;
+    cl_int retVal = CL_INVALID_PROGRAM;
+    auto pProgram = Program::create<MockProgram>(&context, 1, sources, &sourceSize, retVal);
+    ASSERT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clBuildProgram(pProgram, 0, nullptr, nullptr, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    for (auto &rootDeviceIndex : context.getRootDeviceIndices()) {
+        EXPECT_EQ(1, pProgram->processGenBinaryCalledPerRootDevice[rootDeviceIndex]);
+        EXPECT_LT(0u, pProgram->getNumKernels());
+    }
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
 TEST(ProgramTest, whenProgramIsBuiltAsAnExecutableForAtLeastOneDeviceThenIsBuiltMethodReturnsTrue) {
     MockSpecializedContext context;
     MockProgram program(&context, false, context.getDevices());
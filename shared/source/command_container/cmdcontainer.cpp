@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,16 @@
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+#include <atomic>
+
 namespace NEO {
 
+namespace {
+std::atomic<uint32_t> residencyContainerIdGenerator{0u};
+} // namespace
+
 CommandContainer::~CommandContainer() {
     if (!device) {
         DEBUG_BREAK_IF(device);
@@ -47,7 +55,7 @@ CommandContainer::~CommandContainer() {
     }
 }
 
-CommandContainer::CommandContainer() {
+CommandContainer::CommandContainer() : residencyContainerId(residencyContainerIdGenerator.fetch_add(1u, std::memory_order_relaxed)) {
     for (auto &indirectHeap : indirectHeaps) {
         indirectHeap = nullptr;
     }
@@ -58,6 +66,10 @@ CommandContainer::CommandContainer() {
 
     residencyContainer.reserve(startingResidencyContainerSize);
 
+    if (debugManager.flags.EnableResidencyContainerDedupOnAppend.get() != -1) {
+        residencyDedupOnAppend = !!debugManager.flags.EnableResidencyContainerDedupOnAppend.get();
+    }
+
     if (debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get() != -1) {
         isHandleFenceCompletionRequired = !static_cast<bool>(debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get());
     }
@@ -138,7 +150,7 @@ CommandContainer::ErrorCode CommandContainer::initialize(Device *device, Allocat
             if (!allocationIndirectHeaps[i]) {
                 return ErrorCode::outOfDeviceMemory;
             }
-            residencyContainer.push_back(allocationIndirectHeaps[i]);
+            addToResidencyContainer(allocationIndirectHeaps[i]);
 
             bool requireInternalHeap = false;
             if (IndirectHeap::Type::indirectObject == heapType) {
@@ -166,9 +178,21 @@ void CommandContainer::addToResidencyContainer(GraphicsAllocation *alloc) {
         return;
     }
 
+    if (this->residencyDedupOnAppend) {
+        if (isInResidencyContainer(alloc, this->residencyContainer.size())) {
+            return;
+        }
+        alloc->setResidencyContainerPositionHint(this->residencyContainerId, this->residencyContainer.size());
+    }
+
     this->residencyContainer.push_back(alloc);
 }
 
+bool CommandContainer::isInResidencyContainer(const GraphicsAllocation *alloc, size_t searchedRangeSize) const {
+    auto position = alloc->getResidencyContainerPositionHint(this->residencyContainerId);
+    return position < searchedRangeSize && this->residencyContainer[position] == alloc;
+}
+
 bool CommandContainer::swapStreams() {
     if (this->useSecondaryCommandStream) {
         this->commandStream.swap(this->secondaryCommandStreamForImmediateCmdList);
@@ -180,6 +204,13 @@ bool CommandContainer::swapStreams() {
 void CommandContainer::removeDuplicatesFromResidencyContainer() {
     std::sort(this->residencyContainer.begin(), this->residencyContainer.end());
     this->residencyContainer.erase(std::unique(this->residencyContainer.begin(), this->residencyContainer.end()), this->residencyContainer.end());
+    if (this->residencyDedupOnAppend) {
+        for (size_t i = 0; i < this->residencyContainer.size(); i++) {
+            if (this->residencyContainer[i]) {
+                this->residencyContainer[i]->setResidencyContainerPositionHint(this->residencyContainerId, i);
+            }
+        }
+    }
 }
 
 void CommandContainer::reset() {
@@ -296,7 +327,7 @@ void CommandContainer::createAndAssignNewHeap(HeapType heapType, size_t size) {
     indirectHeap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                                 newAlloc->getUnderlyingBufferSize());
     auto newBase = indirectHeap->getHeapGpuBase();
-    getResidencyContainer().push_back(newAlloc);
+    addToResidencyContainer(newAlloc);
     if (this->immediateCmdListCsr) {
         this->storeAllocationAndFlushTagUpdate(oldAlloc);
     } else {
@@ -395,7 +426,7 @@ void CommandContainer::prepareBindfulSsh() {
                                                                                                       defaultHeapAllocationAlignment,
                                                                                                       device->getRootDeviceIndex());
             UNRECOVERABLE_IF(!allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
-            residencyContainer.push_back(allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
+            addToResidencyContainer(allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
 
             indirectHeaps[IndirectHeap::Type::surfaceState] = std::make_unique<IndirectHeap>(allocationIndirectHeaps[IndirectHeap::Type::surfaceState], false);
             indirectHeaps[IndirectHeap::Type::surfaceState]->getSpace(reservedSshSize);
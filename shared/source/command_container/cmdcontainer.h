@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -211,6 +211,7 @@ class CommandContainer : public NonCopyableAndNonMovableClass {
     void *findCpuBaseForCmdBufferAddress(void *cmdBufferAddress);
 
   protected:
+    bool isInResidencyContainer(const GraphicsAllocation *alloc, size_t searchedRangeSize) const;
     size_t getAlignedCmdBufferSize() const;
     size_t getMaxUsableSpace() const {
         return getAlignedCmdBufferSize() - cmdBufferReservedSize;
@@ -226,6 +227,7 @@ class CommandContainer : public NonCopyableAndNonMovableClass {
 
     CmdBufferContainer cmdBufferAllocations;
     ResidencyContainer residencyContainer;
+    const uint32_t residencyContainerId;
     std::vector<GraphicsAllocation *> deallocationContainer;
     HeapContainer sshAllocations;
 
@@ -273,6 +275,7 @@ class CommandContainer : public NonCopyableAndNonMovableClass {
     bool systolicModeSupport = false;
     bool doubleSbaWa = false;
     bool usingPrimaryBuffer = false;
+    bool residencyDedupOnAppend = true;
     bool globalBindlessHeapsEnabled = false;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_controller.h"
+#include "shared/source/direct_submission/direct_submission_publish_scope.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/cache_settings_helper.h"
@@ -454,6 +455,8 @@ void CommandStreamReceiver::cleanupResources() {
 }
 
 WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams &params, TaskCountType taskCountToWait) {
+    DirectSubmissionPublishScope::publishPendingReservation();
+
     bool printWaitForCompletion = debugManager.flags.LogWaitingForCompletion.get();
     if (printWaitForCompletion) {
         printTagAddressContent(taskCountToWait, params.waitTimeout, true);
@@ -909,7 +912,13 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
 }
 
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
-    return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
+    std::unique_lock<CommandStreamReceiver::MutexType> lock(this->ownershipMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // thread must not block on ownership with unpublished direct submission dispatch
+        DirectSubmissionPublishScope::publishPendingReservation();
+        lock.lock();
+    }
+    return lock;
 }
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainHostPtrSurfaceCreationLock() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->hostPtrSurfaceCreationMutex);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
-#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
@@ -32,8 +32,9 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
                                                    const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
-    Hash hash;
+    Hash128 hash;
 
+    hash.update(safePodCast<const char *>(&cacheKeyVersion), sizeof(cacheKeyVersion));
     hash.update("----", 4);
     hash.update(&*igcRevision.begin(), igcRevision.size());
     hash.update(safePodCast<const char *>(&igcLibSize), sizeof(igcLibSize));
@@ -65,9 +66,11 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
 
     if (debugManager.flags.BinaryCacheTrace.get()) {
         std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
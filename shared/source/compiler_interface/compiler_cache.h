@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,8 +27,25 @@ struct CompilerCacheConfig {
     size_t cacheSize = 0;
 };
 
+// Read-only view of cached binary, valid as long as the view exists
+class CachedBinaryView : NEO::NonCopyableAndNonMovableClass {
+  public:
+    CachedBinaryView(ArrayRef<const uint8_t> data) : data(data) {}
+    virtual ~CachedBinaryView() = default;
+
+    ArrayRef<const uint8_t> getData() const {
+        return data;
+    }
+
+  protected:
+    ArrayRef<const uint8_t> data;
+};
+
 class CompilerCache : NEO::NonCopyableAndNonMovableClass {
   public:
+    // Bump whenever the key layout or hash function changes, entries created with other versions are never matched
+    static constexpr uint32_t cacheKeyVersion = 2;
+
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
 
@@ -43,6 +60,9 @@ class CompilerCache : NEO::NonCopyableAndNonMovableClass {
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
+    // Maps cached binary instead of reading it to heap, only pages actually used become resident.
+    // Returns nullptr when mapping is not possible, loadCachedBinary should be used then.
+    MOCKABLE_VIRTUAL std::unique_ptr<CachedBinaryView> mapCachedBinary(const std::string &kernelFileHash);
 
   protected:
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_index.h"
+
+#include <charconv>
+
+namespace NEO {
+
+/*
+ * Returns false when the header is missing or any complete record is malformed.
+ * A trailing record without new line is a torn append and is skipped.
+ */
+bool CompilerCacheIndex::deserialize(const char *data, size_t dataSize) {
+    clear();
+    std::string_view content(data, dataSize);
+    if (content.substr(0, header.size()) != header) {
+        return false;
+    }
+    content.remove_prefix(header.size());
+
+    while (!content.empty()) {
+        auto lineEnd = content.find('\n');
+        if (lineEnd == content.npos) {
+            break;
+        }
+        if (!applyRecord(content.substr(0, lineEnd))) {
+            clear();
+            return false;
+        }
+        content.remove_prefix(lineEnd + 1);
+    }
+    return true;
+}
+
+bool CompilerCacheIndex::applyRecord(std::string_view record) {
+    if (record.size() < 3 || record[1] != ' ') {
+        return false;
+    }
+    auto type = record[0];
+    record.remove_prefix(2);
+
+    if (type == 'A') {
+        auto separator = record.find(' ');
+        if (separator == record.npos || separator + 1 == record.size()) {
+            return false;
+        }
+        size_t size = 0;
+        auto [ptr, ec] = std::from_chars(record.data(), record.data() + separator, size);
+        if (ec != std::errc() || ptr != record.data() + separator) {
+            return false;
+        }
+        add(std::string(record.substr(separator + 1)), size);
+        return true;
+    }
+    if (type == 'T') {
+        touch(std::string(record));
+        return true;
+    }
+    if (type == 'R') {
+        remove(std::string(record));
+        return true;
+    }
+    return false;
+}
+
+std::string CompilerCacheIndex::serialize() const {
+    std::string content(header);
+    for (const auto &entry : entries) {
+        content += createAddRecord(entry.fileName, entry.size);
+    }
+    return content;
+}
+
+std::string CompilerCacheIndex::createAddRecord(const std::string &fileName, size_t size) {
+    return "A " + std::to_string(size) + " " + fileName + "\n";
+}
+
+std::string CompilerCacheIndex::createTouchRecord(const std::string &fileName) {
+    return "T " + fileName + "\n";
+}
+
+std::string CompilerCacheIndex::createRemoveRecord(const std::string &fileName) {
+    return "R " + fileName + "\n";
+}
+
+void CompilerCacheIndex::add(const std::string &fileName, size_t size) {
+    remove(fileName);
+    entries.push_back({fileName, size});
+    entriesByName[fileName] = std::prev(entries.end());
+    totalSize += size;
+}
+
+void CompilerCacheIndex::touch(const std::string &fileName) {
+    auto it = entriesByName.find(fileName);
+    if (it == entriesByName.end()) {
+        return;
+    }
+    entries.splice(entries.end(), entries, it->second);
+}
+
+void CompilerCacheIndex::remove(const std::string &fileName) {
+    auto it = entriesByName.find(fileName);
+    if (it == entriesByName.end()) {
+        return;
+    }
+    totalSize -= it->second->size;
+    entries.erase(it->second);
+    entriesByName.erase(it);
+}
+
+bool CompilerCacheIndex::popLeastRecentlyUsed(Entry &entry) {
+    if (entries.empty()) {
+        return false;
+    }
+    entry = std::move(entries.front());
+    entriesByName.erase(entry.fileName);
+    entries.pop_front();
+    totalSize -= entry.size;
+    return true;
+}
+
+void CompilerCacheIndex::clear() {
+    entries.clear();
+    entriesByName.clear();
+    totalSize = 0;
+}
+
+} // namespace NEO
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace NEO {
+
+/*
+ * In-memory view of the persistent compiler cache index.
+ * On disk the index is an append-only text log: a header line followed by
+ * add ("A <size> <name>"), touch ("T <name>") and remove ("R <name>") records.
+ * Replaying the log yields cache entries ordered from least to most recently used.
+ */
+class CompilerCacheIndex {
+  public:
+    static constexpr std::string_view indexFileName = "cache.index";
+    static constexpr std::string_view header = "neo_compiler_cache_index 1\n";
+
+    struct Entry {
+        std::string fileName;
+        size_t size = 0;
+    };
+
+    bool deserialize(const char *data, size_t dataSize);
+    std::string serialize() const;
+
+    static std::string createAddRecord(const std::string &fileName, size_t size);
+    static std::string createTouchRecord(const std::string &fileName);
+    static std::string createRemoveRecord(const std::string &fileName);
+
+    void add(const std::string &fileName, size_t size);
+    void touch(const std::string &fileName);
+    void remove(const std::string &fileName);
+    bool popLeastRecentlyUsed(Entry &entry);
+    void clear();
+
+    size_t getEntriesCount() const {
+        return entries.size();
+    }
+    uint64_t getTotalSize() const {
+        return totalSize;
+    }
+
+  protected:
+    bool applyRecord(std::string_view record);
+
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entriesByName;
+    uint64_t totalSize = 0;
+};
+
+} // namespace NEO
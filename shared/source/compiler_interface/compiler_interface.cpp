@@ -712,6 +712,17 @@ void CompilerCacheHelper::packAndCacheBinary(CompilerCache &compilerCache, const
 }
 
 bool CompilerCacheHelper::loadCacheAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, const NEO::Device &device) {
+    if (auto mappedBinary = compilerCache.mapCachedBinary(kernelFileHash)) {
+        // only parts used by this device are copied out of mapped archive
+        auto archive = mappedBinary->getData();
+        if (isDeviceBinaryFormat<DeviceBinaryFormat::oclElf>(archive)) {
+            return processPackedCacheBinary(archive, output, device);
+        }
+        output.deviceBinary.mem = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
+        output.deviceBinary.size = archive.size();
+        return true;
+    }
+
     size_t cacheBinarySize = 0u;
     auto cacheBinary = compilerCache.loadCachedBinary(kernelFileHash, cacheBinarySize);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -153,6 +153,10 @@ class CompilerInterface : NEO::NonCopyableAndNonMovableClass {
     bool addOptionDisableZebin(std::string &options, std::string &internalOptions);
     bool disableZebin(std::string &options, std::string &internalOptions);
 
+    CompilerCache *getCache() const {
+        return cache.get();
+    }
+
   protected:
     struct CompilerLibraryEntry {
         std::string revision;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "RelocationInfo.h"
 
+#include <algorithm>
 #include <sstream>
 #include <unordered_map>
 
@@ -151,6 +152,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
             break;
         }
         outRelocInfo.push_back(std::move(relocInfo));
+        addTextRelocationToPlan(instructionsSegmentId, static_cast<uint32_t>(outRelocInfo.size() - 1));
     }
     return true;
 }
@@ -160,6 +162,7 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
     this->traits.requiresPatchingOfGlobalVariablesBuffer |= (relocationInfo.relocationSegment == SegmentType::globalVariables);
     this->traits.requiresPatchingOfGlobalConstantsBuffer |= (relocationInfo.relocationSegment == SegmentType::globalConstants);
     this->dataRelocations.push_back(relocationInfo);
+    addDataRelocationToPlan(static_cast<uint32_t>(this->dataRelocations.size() - 1));
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
@@ -175,6 +178,96 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
     relocationInfo.relocationSegment = SegmentType::instructions;
 
     outRelocInfo.push_back(std::move(relocationInfo));
+    addTextRelocationToPlan(instructionsSegmentId, static_cast<uint32_t>(outRelocInfo.size() - 1));
+}
+
+void LinkerInput::restoreDecodedState(const Traits &decodedTraits, SymbolMap &&decodedSymbols, Relocations &&decodedDataRelocations, RelocationsPerInstSegment &&decodedTextRelocations,
+                                      std::vector<ExternalFunctionUsageKernel> &&decodedKernelDependencies, std::vector<ExternalFunctionUsageExtFunc> &&decodedFunctionDependencies) {
+    this->traits = decodedTraits;
+    this->symbols = std::move(decodedSymbols);
+    this->dataRelocations = std::move(decodedDataRelocations);
+    this->textRelocations = std::move(decodedTextRelocations);
+    this->kernelDependencies = std::move(decodedKernelDependencies);
+    this->extFunDependencies = std::move(decodedFunctionDependencies);
+    this->extFuncSymbols.clear();
+    this->valid = true;
+    rebuildRelocationPlan();
+}
+
+uint32_t LinkerInput::internRelocationSymbol(const std::string &symbolName) {
+    // low/high parts of the same address are usually adjacent
+    auto lastSymbolId = static_cast<uint32_t>(relocationPlan.symbolNames.size() - 1);
+    if ((lastSymbolId != RelocationPlan::zeroValueSymbolId) && (relocationPlan.symbolNames[lastSymbolId] == symbolName)) {
+        return lastSymbolId;
+    }
+    auto [symbolIt, inserted] = relocationPlan.symbolIds.try_emplace(symbolName, static_cast<uint32_t>(relocationPlan.symbolNames.size()));
+    if (inserted) {
+        relocationPlan.symbolNames.push_back(symbolName);
+    }
+    return symbolIt->second;
+}
+
+namespace {
+size_t getRelocationTypeBucket(LinkerInput::RelocationInfo::Type type) {
+    auto bucket = static_cast<size_t>(type);
+    return (bucket < static_cast<size_t>(LinkerInput::RelocationInfo::Type::relocTypeMax)) ? bucket : static_cast<size_t>(LinkerInput::RelocationInfo::Type::unknown);
+}
+} // namespace
+
+void LinkerInput::addTextRelocationToPlan(uint32_t instructionsSegmentId, uint32_t relocationIndex) {
+    if (instructionsSegmentId >= relocationPlan.instructionsSegments.size()) {
+        relocationPlan.instructionsSegments.resize(instructionsSegmentId + 1);
+    }
+    auto &segmentPlan = relocationPlan.instructionsSegments[instructionsSegmentId];
+    const auto &relocation = textRelocations[instructionsSegmentId][relocationIndex];
+    RelocationPlan::Entry entry{relocation.offset, 0, RelocationPlan::zeroValueSymbolId, relocationIndex};
+    if (relocation.type == RelocationInfo::Type::perThreadPayloadOffset) {
+        segmentPlan.entriesPerType[static_cast<size_t>(relocation.type)].push_back(entry);
+    } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
+        segmentPlan.implicitArgs.push_back(entry);
+    } else {
+        if (false == relocation.symbolName.empty()) {
+            entry.symbolId = internRelocationSymbol(relocation.symbolName);
+            entry.addend = relocation.addend;
+        }
+        segmentPlan.entriesPerType[getRelocationTypeBucket(relocation.type)].push_back(entry);
+    }
+}
+
+void LinkerInput::addDataRelocationToPlan(uint32_t relocationIndex) {
+    const auto &relocation = dataRelocations[relocationIndex];
+    RelocationPlan::DataSegment dataSegment;
+    switch (relocation.relocationSegment) {
+    default:
+        relocationPlan.dataRelocationsInUnsupportedSegments.push_back(relocationIndex);
+        return;
+    case SegmentType::globalConstants:
+        dataSegment = RelocationPlan::globalConstants;
+        break;
+    case SegmentType::globalConstantsZeroInit:
+        dataSegment = RelocationPlan::globalConstantsZeroInit;
+        break;
+    case SegmentType::globalVariables:
+        dataSegment = RelocationPlan::globalVariables;
+        break;
+    case SegmentType::globalVariablesZeroInit:
+        dataSegment = RelocationPlan::globalVariablesZeroInit;
+        break;
+    }
+    RelocationPlan::Entry entry{relocation.offset, relocation.addend, internRelocationSymbol(relocation.symbolName), relocationIndex};
+    relocationPlan.dataSegments[dataSegment][getRelocationTypeBucket(relocation.type)].push_back(entry);
+}
+
+void LinkerInput::rebuildRelocationPlan() {
+    relocationPlan = {};
+    for (uint32_t segId = 0U; segId < textRelocations.size(); segId++) {
+        for (uint32_t relocationIndex = 0U; relocationIndex < textRelocations[segId].size(); relocationIndex++) {
+            addTextRelocationToPlan(segId, relocationIndex);
+        }
+    }
+    for (uint32_t relocationIndex = 0U; relocationIndex < dataRelocations.size(); relocationIndex++) {
+        addDataRelocationToPlan(relocationIndex);
+    }
 }
 
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_32> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_32>::RelocationInfo &reloc);
@@ -431,6 +524,61 @@ void Linker::removeLocalSymbolsFromRelocatedSymbols() {
     }
 }
 
+namespace {
+struct PlannedSymbol {
+    uint64_t gpuAddress = 0U;
+    bool resolved = false;
+};
+
+struct RejectedRelocation {
+    uint32_t relocationIndex = 0U;
+    bool invalidOffset = false;
+};
+
+std::vector<PlannedSymbol> resolvePlannedSymbols(const LinkerInput::RelocationPlan &plan, const Linker::RelocatedSymbolsMap &relocatedSymbols) {
+    std::vector<PlannedSymbol> symbols(plan.symbolNames.size());
+    symbols[LinkerInput::RelocationPlan::zeroValueSymbolId].resolved = true;
+    for (uint32_t symbolId = LinkerInput::RelocationPlan::zeroValueSymbolId + 1; symbolId < plan.symbolNames.size(); symbolId++) {
+        auto symbolIt = relocatedSymbols.find(plan.symbolNames[symbolId]);
+        if (symbolIt != relocatedSymbols.end()) {
+            symbols[symbolId] = {symbolIt->second.gpuAddress, true};
+        }
+    }
+    return symbols;
+}
+
+template <typename PatchFunctionT>
+size_t applyPlannedRelocations(const LinkerInput::RelocationPlan::Entries &entries, size_t segmentSize, size_t patchSize, const std::vector<PlannedSymbol> &symbols,
+                               std::vector<RejectedRelocation> &outRejected, PatchFunctionT &&patch) {
+    size_t appliedCount = 0U;
+    for (const auto &entry : entries) {
+        if (entry.offset + patchSize > segmentSize) {
+            DEBUG_BREAK_IF(true);
+            outRejected.push_back({entry.relocationIndex, true});
+            continue;
+        }
+        const auto &symbol = symbols[entry.symbolId];
+        if (false == symbol.resolved) {
+            outRejected.push_back({entry.relocationIndex, false});
+            continue;
+        }
+        patch(entry, symbol.gpuAddress + entry.addend);
+        appliedCount++;
+    }
+    return appliedCount;
+}
+
+template <typename PatchSizeT>
+void writePatchValue(void *segment, uint64_t offset, uint64_t value) {
+    auto valueToPatch = static_cast<PatchSizeT>(value);
+    memcpy_s(ptrOffset(segment, static_cast<uintptr_t>(offset)), sizeof(PatchSizeT), &valueToPatch, sizeof(PatchSizeT));
+}
+
+void sortByRelocationIndex(std::vector<RejectedRelocation> &rejected) {
+    std::sort(rejected.begin(), rejected.end(), [](const auto &lhs, const auto &rhs) { return lhs.relocationIndex < rhs.relocationIndex; });
+}
+} // namespace
+
 void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors) {
     if (false == data.getTraits().requiresPatchingOfInstructionSegments) {
         return;
@@ -438,34 +586,74 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
+    const auto &plan = data.getRelocationPlan();
+    auto symbols = resolvePlannedSymbols(plan, relocatedSymbols);
+    std::vector<RejectedRelocation> rejected;
     for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+        if (relocationsPerSegment[segId].empty()) {
+            continue;
+        }
         auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
+        UNRECOVERABLE_IF(nullptr == segment.hostPointer);
+        UNRECOVERABLE_IF(segId >= plan.instructionsSegments.size());
+        const auto &segmentPlan = plan.instructionsSegments[segId];
+        rejected.clear();
+
+        for (size_t typeBucket = 0U; typeBucket < segmentPlan.entriesPerType.size(); typeBucket++) {
+            const auto &entries = segmentPlan.entriesPerType[typeBucket];
+            if (entries.empty()) {
                 continue;
             }
+            auto type = static_cast<RelocationInfo::Type>(typeBucket);
+            auto patchSize = addressSizeInBytes(type);
+            switch (type) {
+            default:
+                applyPlannedRelocations(entries, segment.segmentSize, patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    patchAddress(ptrOffset(segment.hostPointer, static_cast<uintptr_t>(entry.offset)), value, relocationsPerSegment[segId][entry.relocationIndex]);
+                });
+                break;
+            case RelocationInfo::Type::address:
+                applyPlannedRelocations(entries, segment.segmentSize, patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    writePatchValue<uint64_t>(segment.hostPointer, entry.offset, value);
+                });
+                break;
+            case RelocationInfo::Type::addressLow:
+                applyPlannedRelocations(entries, segment.segmentSize, patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    writePatchValue<uint32_t>(segment.hostPointer, entry.offset, value & 0xffffffff);
+                });
+                break;
+            case RelocationInfo::Type::addressHigh:
+                applyPlannedRelocations(entries, segment.segmentSize, patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    writePatchValue<uint32_t>(segment.hostPointer, entry.offset, (value >> 32) & 0xffffffff);
+                });
+                break;
+            case RelocationInfo::Type::address16:
+                applyPlannedRelocations(entries, segment.segmentSize, patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    writePatchValue<uint16_t>(segment.hostPointer, entry.offset, value & 0xffff);
+                });
+                break;
+            case RelocationInfo::Type::perThreadPayloadOffset:
+                applyPlannedRelocations(entries, segment.segmentSize, patchSize, symbols, rejected, [&](const auto &entry, uint64_t) {
+                    writePatchValue<uint32_t>(segment.hostPointer, entry.offset, kernelDescriptors.at(segId)->getPerThreadDataOffset());
+                });
+                break;
+            }
+        }
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
-                *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->getPerThreadDataOffset();
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(std::pair<void *, RelocationInfo::Type>(relocAddress, relocation.type));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
-                patchAddress(relocAddress, patchValue, relocation);
-            } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
+        for (const auto &entry : segmentPlan.implicitArgs) {
+            auto type = relocationsPerSegment[segId][entry.relocationIndex].type;
+            if (entry.offset + addressSizeInBytes(type) > segment.segmentSize) {
+                DEBUG_BREAK_IF(true);
+                rejected.push_back({entry.relocationIndex, true});
+                continue;
             }
+            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(entry.offset));
+            pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(std::pair<void *, RelocationInfo::Type>(relocAddress, type));
+        }
+
+        sortByRelocationIndex(rejected);
+        for (const auto &rejectedRelocation : rejected) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocationsPerSegment[segId][rejectedRelocation.relocationIndex], static_cast<uint32_t>(segId), rejectedRelocation.invalidOffset});
         }
     }
 }
@@ -480,55 +668,65 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     memcpy_s(variablesData.data(), variablesData.size(), variablesInitData, variablesInitDataSize);
     bool isAnyRelocationPerformed = false;
 
-    for (const auto &relocation : data.getDataRelocations()) {
-        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-        if (symbolIt == relocatedSymbols.end()) {
-            outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
-            continue;
-        }
-        uint64_t srcGpuAddressAs64Bit = symbolIt->second.gpuAddress;
+    const auto &plan = data.getRelocationPlan();
+    auto symbols = resolvePlannedSymbols(plan, relocatedSymbols);
+    std::vector<RejectedRelocation> rejected;
+    for (auto relocationIndex : plan.dataRelocationsInUnsupportedSegments) {
+        rejected.push_back({relocationIndex, false});
+    }
 
-        ArrayRef<uint8_t> dst{};
+    struct DataSegmentToPatch {
+        ArrayRef<uint8_t> dst;
         const void *initData = nullptr;
-        if (SegmentType::globalConstants == relocation.relocationSegment) {
-            dst = {constantsData.data(), constantsInitDataSize};
-            initData = constantsInitData;
-        } else if (SegmentType::globalConstantsZeroInit == relocation.relocationSegment) {
-            dst = {constantsData.data() + constantsInitDataSize, constantsData.size() - constantsInitDataSize};
-        } else if (SegmentType::globalVariables == relocation.relocationSegment) {
-            dst = {variablesData.data(), variablesInitDataSize};
-            initData = variablesInitData;
-        } else if (SegmentType::globalVariablesZeroInit == relocation.relocationSegment) {
-            dst = {variablesData.data() + variablesInitDataSize, variablesData.size() - variablesInitDataSize};
-        } else {
-            outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
-            continue;
-        }
-
-        auto relocType = (LinkerInput::Traits::PointerSize::Ptr32bit == data.getTraits().pointerSize) ? RelocationInfo::Type::addressLow : relocation.type;
-        bool invalidOffset = relocation.offset + addressSizeInBytes(relocType) > dst.size();
-        DEBUG_BREAK_IF(invalidOffset);
-        if (invalidOffset) {
-            outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
-            continue;
+    };
+    std::array<DataSegmentToPatch, LinkerInput::RelocationPlan::dataSegmentsCount> dataSegments;
+    dataSegments[LinkerInput::RelocationPlan::globalConstants] = {{constantsData.data(), constantsInitDataSize}, constantsInitData};
+    dataSegments[LinkerInput::RelocationPlan::globalConstantsZeroInit] = {{constantsData.data() + constantsInitDataSize, constantsData.size() - constantsInitDataSize}, nullptr};
+    dataSegments[LinkerInput::RelocationPlan::globalVariables] = {{variablesData.data(), variablesInitDataSize}, variablesInitData};
+    dataSegments[LinkerInput::RelocationPlan::globalVariablesZeroInit] = {{variablesData.data() + variablesInitDataSize, variablesData.size() - variablesInitDataSize}, nullptr};
+
+    const bool is32bitPointer = (LinkerInput::Traits::PointerSize::Ptr32bit == data.getTraits().pointerSize);
+    for (size_t dataSegment = 0U; dataSegment < dataSegments.size(); dataSegment++) {
+        auto dst = dataSegments[dataSegment].dst;
+        auto initData = dataSegments[dataSegment].initData;
+        const auto &entriesPerType = plan.dataSegments[dataSegment];
+        for (size_t typeBucket = 0U; typeBucket < entriesPerType.size(); typeBucket++) {
+            const auto &entries = entriesPerType[typeBucket];
+            if (entries.empty()) {
+                continue;
+            }
+            auto relocType = is32bitPointer ? RelocationInfo::Type::addressLow : static_cast<RelocationInfo::Type>(typeBucket);
+            auto patchSize = addressSizeInBytes(relocType);
+            size_t appliedCount = 0U;
+            switch (relocType) {
+            default:
+                appliedCount = applyPlannedRelocations(entries, dst.size(), patchSize, symbols, rejected, [&](const auto &, uint64_t) {
+                    UNRECOVERABLE_IF(RelocationInfo::Type::address != relocType);
+                });
+                break;
+            case RelocationInfo::Type::address:
+                appliedCount = applyPlannedRelocations(entries, dst.size(), patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    patchIncrement<uint64_t>(dst.begin(), static_cast<size_t>(entry.offset), initData, value);
+                });
+                break;
+            case RelocationInfo::Type::addressLow:
+                appliedCount = applyPlannedRelocations(entries, dst.size(), patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    patchIncrement<uint32_t>(dst.begin(), static_cast<size_t>(entry.offset), initData, value & 0xffffffff);
+                });
+                break;
+            case RelocationInfo::Type::addressHigh:
+                appliedCount = applyPlannedRelocations(entries, dst.size(), patchSize, symbols, rejected, [&](const auto &entry, uint64_t value) {
+                    patchIncrement<uint32_t>(dst.begin(), static_cast<size_t>(entry.offset), initData, (value >> 32) & 0xffffffff);
+                });
+                break;
+            }
+            isAnyRelocationPerformed |= (appliedCount > 0U);
         }
+    }
 
-        uint64_t incrementValue = srcGpuAddressAs64Bit + relocation.addend;
-        isAnyRelocationPerformed = true;
-        switch (relocType) {
-        default:
-            UNRECOVERABLE_IF(RelocationInfo::Type::address != relocType);
-            patchIncrement<uint64_t>(dst.begin(), static_cast<size_t>(relocation.offset), initData, incrementValue);
-            break;
-        case RelocationInfo::Type::addressLow:
-            incrementValue = incrementValue & 0xffffffff;
-            patchIncrement<uint32_t>(dst.begin(), static_cast<size_t>(relocation.offset), initData, incrementValue);
-            break;
-        case RelocationInfo::Type::addressHigh:
-            incrementValue = (incrementValue >> 32) & 0xffffffff;
-            patchIncrement<uint32_t>(dst.begin(), static_cast<size_t>(relocation.offset), initData, incrementValue);
-            break;
-        }
+    sortByRelocationIndex(rejected);
+    for (const auto &rejectedRelocation : rejected) {
+        outUnresolvedExternals.push_back(UnresolvedExternal{data.getDataRelocations()[rejectedRelocation.relocationIndex]});
     }
 
     if (isAnyRelocationPerformed) {
@@ -718,7 +916,7 @@ void Linker::resolveBuiltins(Device *pDevice, UnresolvedExternals &outUnresolved
 template <typename PatchSizeT>
 void Linker::patchIncrement(void *dstBegin, size_t relocationOffset, const void *initData, uint64_t incrementValue) {
     if (nullptr == initData) {
-        *(reinterpret_cast<PatchSizeT *>(dstBegin) + relocationOffset) = static_cast<PatchSizeT>(incrementValue);
+        *reinterpret_cast<PatchSizeT *>(ptrOffset(dstBegin, relocationOffset)) = static_cast<PatchSizeT>(incrementValue);
         return;
     }
     auto initValue = ptrOffset(initData, relocationOffset);
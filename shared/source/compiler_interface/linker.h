@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <optional>
@@ -110,6 +111,45 @@ struct LinkerInput : NEO::NonCopyableAndNonMovableClass {
     using SymbolMap = std::unordered_map<std::string, SymbolInfo>;
     using RelocationsPerInstSegment = std::vector<Relocations>;
 
+    /*
+     * Relocations prepared for patching - symbol names are interned to dense ids and relocations are
+     * bucketed by target segment and type, so that linking resolves each symbol once and patches each bucket in a typed loop.
+     * Entries refer back to the source relocation by its index within the segment's relocation vector.
+     * The plan is extended as relocations are added, so linking does not pay for building it.
+     */
+    struct RelocationPlan {
+        struct Entry {
+            uint64_t offset = 0U;
+            int64_t addend = 0;
+            uint32_t symbolId = 0U;
+            uint32_t relocationIndex = 0U;
+        };
+        using Entries = std::vector<Entry>;
+        using EntriesPerType = std::array<Entries, static_cast<size_t>(RelocationInfo::Type::relocTypeMax)>;
+
+        struct InstructionsSegment {
+            EntriesPerType entriesPerType;
+            Entries implicitArgs;
+        };
+
+        enum DataSegment : uint32_t {
+            globalConstants,
+            globalConstantsZeroInit,
+            globalVariables,
+            globalVariablesZeroInit,
+            dataSegmentsCount
+        };
+
+        // id of pseudo symbol with value 0, used by text relocations without symbol
+        static constexpr uint32_t zeroValueSymbolId = 0U;
+
+        std::vector<std::string> symbolNames = {std::string{}};
+        std::unordered_map<std::string, uint32_t> symbolIds;
+        std::vector<InstructionsSegment> instructionsSegments;
+        std::array<EntriesPerType, dataSegmentsCount> dataSegments;
+        std::vector<uint32_t> dataRelocationsInUnsupportedSegments;
+    };
+
     LinkerInput();
     virtual ~LinkerInput();
 
@@ -122,6 +162,10 @@ struct LinkerInput : NEO::NonCopyableAndNonMovableClass {
 
     void addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId);
 
+    // Replaces decoded state with previously decoded tables (e.g. loaded from decoded program cache)
+    void restoreDecodedState(const Traits &decodedTraits, SymbolMap &&decodedSymbols, Relocations &&decodedDataRelocations, RelocationsPerInstSegment &&decodedTextRelocations,
+                             std::vector<ExternalFunctionUsageKernel> &&decodedKernelDependencies, std::vector<ExternalFunctionUsageExtFunc> &&decodedFunctionDependencies);
+
     template <Elf::ElfIdentifierClass numBits>
     void decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, const SectionNameToSegmentIdMap &nameToSegmentId);
 
@@ -177,8 +221,16 @@ struct LinkerInput : NEO::NonCopyableAndNonMovableClass {
         return extFunDependencies;
     }
 
+    const RelocationPlan &getRelocationPlan() const {
+        return relocationPlan;
+    }
+
   protected:
     void parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName);
+    uint32_t internRelocationSymbol(const std::string &symbolName);
+    void addTextRelocationToPlan(uint32_t instructionsSegmentId, uint32_t relocationIndex);
+    void addDataRelocationToPlan(uint32_t relocationIndex);
+    void rebuildRelocationPlan();
 
     Traits traits;
     SymbolMap symbols;
@@ -189,6 +241,8 @@ struct LinkerInput : NEO::NonCopyableAndNonMovableClass {
     std::vector<ExternalFunctionUsageExtFunc> extFunDependencies;
     int32_t exportedFunctionsSegmentId = -1;
     bool valid = true;
+
+    RelocationPlan relocationPlan;
 };
 
 struct Linker {
@@ -1,13 +1,15 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_index.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/path.h"
 #include "shared/source/helpers/string.h"
@@ -24,6 +26,7 @@
 #include <sstream>
 #include <string_view>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <unistd.h>
 #include <vector>
@@ -41,6 +44,7 @@ int filterFunction(const struct dirent *file) {
 
 struct ElementsStruct {
     std::string path;
+    std::string fileName;
     struct stat statEl;
 };
 
@@ -48,21 +52,87 @@ bool compareByLastAccessTime(const ElementsStruct &a, ElementsStruct &b) {
     return a.statEl.st_atime < b.statEl.st_atime;
 }
 
-bool CompilerCache::evictCache(uint64_t &bytesEvicted) {
+constexpr size_t cacheIndexCompactionThreshold = 4 * MemoryConstants::megaByte;
+constexpr std::string_view configFileName = "config.file";
+
+std::string getCacheIndexPath(const std::string &cacheDir) {
+    return joinPath(cacheDir, std::string(CompilerCacheIndex::indexFileName));
+}
+
+bool loadCacheIndex(const std::string &cacheDir, CompilerCacheIndex &index) {
+    int fd = NEO::SysCalls::open(getCacheIndexPath(cacheDir).c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    std::string content;
+    struct stat statbuf = {};
+    bool readSuccess = NEO::SysCalls::fstat(fd, &statbuf) == 0;
+    if (readSuccess) {
+        content.resize(static_cast<size_t>(statbuf.st_size));
+        readSuccess = NEO::SysCalls::pread(fd, content.data(), content.size(), 0) == static_cast<ssize_t>(content.size());
+    }
+    NEO::SysCalls::close(fd);
+
+    return readSuccess && index.deserialize(content.data(), content.size());
+}
+
+/*
+ * Index is replaced atomically, callers must hold config file lock.
+ */
+void writeCacheIndex(const std::string &cacheDir, const CompilerCacheIndex &index) {
+    const auto indexPath = getCacheIndexPath(cacheDir);
+    const auto tmpIndexPath = indexPath + ".tmp";
+
+    int fd = NEO::SysCalls::openWithMode(tmpIndexPath.c_str(), O_CREAT | O_TRUNC | O_WRONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+    if (fd < 0) {
+        return;
+    }
+    const auto content = index.serialize();
+    const bool written = NEO::SysCalls::write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size());
+    NEO::SysCalls::close(fd);
+
+    if (written) {
+        NEO::SysCalls::rename(tmpIndexPath.c_str(), indexPath.c_str());
+    }
+}
+
+/*
+ * Appends single record to existing index. Index is never created here,
+ * so a missing index cannot be mistaken for a complete one.
+ * Returns index size after append or -1 if index does not exist.
+ */
+ssize_t appendCacheIndexRecord(const std::string &cacheDir, const std::string &record) {
+    int fd = NEO::SysCalls::open(getCacheIndexPath(cacheDir).c_str(), O_WRONLY | O_APPEND);
+    if (fd < 0) {
+        return -1;
+    }
+    NEO::SysCalls::write(fd, record.data(), record.size());
+
+    struct stat statbuf = {};
+    ssize_t indexSize = 0;
+    if (NEO::SysCalls::fstat(fd, &statbuf) == 0) {
+        indexSize = static_cast<ssize_t>(statbuf.st_size);
+    }
+    NEO::SysCalls::close(fd);
+    return indexSize;
+}
+
+bool getCacheFilesSortedByAccessTime(const std::string &cacheDir, std::vector<ElementsStruct> &cacheFiles) {
     struct dirent **files = 0;
 
-    const int filesCount = NEO::SysCalls::scandir(config.cacheDir.c_str(), &files, filterFunction, NULL);
+    const int filesCount = NEO::SysCalls::scandir(cacheDir.c_str(), &files, filterFunction, NULL);
 
     if (filesCount == -1) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Scandir failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
         return false;
     }
 
-    std::vector<ElementsStruct> cacheFiles;
     cacheFiles.reserve(static_cast<size_t>(filesCount));
     for (int i = 0; i < filesCount; ++i) {
         ElementsStruct fileElement = {};
-        fileElement.path = joinPath(config.cacheDir, files[i]->d_name);
+        fileElement.fileName = files[i]->d_name;
+        fileElement.path = joinPath(cacheDir, fileElement.fileName);
         if (NEO::SysCalls::stat(fileElement.path.c_str(), &fileElement.statEl) == 0) {
             cacheFiles.push_back(std::move(fileElement));
         }
@@ -72,22 +142,69 @@ bool CompilerCache::evictCache(uint64_t &bytesEvicted) {
     free(files);
 
     std::sort(cacheFiles.begin(), cacheFiles.end(), compareByLastAccessTime);
+    return true;
+}
+
+bool rebuildCacheIndex(const std::string &cacheDir, CompilerCacheIndex &index) {
+    std::vector<ElementsStruct> cacheFiles;
+    if (!getCacheFilesSortedByAccessTime(cacheDir, cacheFiles)) {
+        return false;
+    }
+
+    index.clear();
+    for (const auto &file : cacheFiles) {
+        index.add(file.fileName, static_cast<size_t>(file.statEl.st_size));
+    }
+    return true;
+}
+
+/*
+ * Rewrites index when it is missing or appended records made it grow over compaction threshold,
+ * callers must hold config file lock.
+ */
+void compactCacheIndexIfNeeded(const std::string &cacheDir, ssize_t indexSize) {
+    if (indexSize >= 0 && static_cast<size_t>(indexSize) <= cacheIndexCompactionThreshold) {
+        return;
+    }
+    CompilerCacheIndex index;
+    if (loadCacheIndex(cacheDir, index) || rebuildCacheIndex(cacheDir, index)) {
+        writeCacheIndex(cacheDir, index);
+    }
+}
+
+/*
+ * Evicts least recently used entries based on persistent index, directory is listed only
+ * when index is missing, corrupted or does not cover enough files (e.g. entries added by older drivers).
+ */
+bool CompilerCache::evictCache(uint64_t &bytesEvicted) {
+    CompilerCacheIndex index;
+    bool indexLoaded = loadCacheIndex(config.cacheDir, index);
+    if (!indexLoaded && !rebuildCacheIndex(config.cacheDir, index)) {
+        return false;
+    }
 
     bytesEvicted = 0;
     const auto evictionLimit = config.cacheSize / 3;
 
-    for (const auto &file : cacheFiles) {
-        auto res = NEO::SysCalls::unlink(file.path);
-        if (res == -1) {
+    CompilerCacheIndex::Entry entry;
+    while (bytesEvicted <= evictionLimit) {
+        if (!index.popLeastRecentlyUsed(entry)) {
+            if (!indexLoaded || !rebuildCacheIndex(config.cacheDir, index)) {
+                break;
+            }
+            indexLoaded = false;
             continue;
         }
 
-        bytesEvicted += file.statEl.st_size;
-        if (bytesEvicted > evictionLimit) {
-            return true;
+        auto res = NEO::SysCalls::unlink(joinPath(config.cacheDir, entry.fileName));
+        if (res == -1) {
+            continue;
         }
+
+        bytesEvicted += entry.size;
     }
 
+    writeCacheIndex(config.cacheDir, index);
     return true;
 }
 
@@ -222,7 +339,6 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
     }
 
     std::unique_lock<std::mutex> lock(cacheAccessMtx);
-    constexpr std::string_view configFileName = "config.file";
 
     std::string configFilePath = joinPath(config.cacheDir, configFileName.data());
     std::string cacheFilePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
@@ -274,12 +390,78 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 
     NEO::SysCalls::pwrite(std::get<int>(fd), &directorySize, sizeof(directorySize), 0);
 
+    const auto indexSize = appendCacheIndexRecord(config.cacheDir, CompilerCacheIndex::createAddRecord(kernelFileHash + config.cacheFileExtension, binarySize));
+    compactCacheIndexIfNeeded(config.cacheDir, indexSize);
+
     return true;
 }
 
+/*
+ * Touch records are appended under config file lock, same as add records and index compaction,
+ * so they are never interleaved with concurrent appends or lost on index replacement.
+ * Lock is not waited for, so cache hits are not queued behind writers. Missing, unlockable
+ * or contended config file only skips the touch, entry stays at its previous LRU position.
+ * Missing index is not rebuilt here to keep directory listing out of cache hits.
+ */
+void appendCacheIndexTouchRecord(const std::string &cacheDir, const std::string &fileName) {
+    int configFd = NEO::SysCalls::open(joinPath(cacheDir, configFileName.data()).c_str(), O_RDWR);
+    if (configFd < 0) {
+        return;
+    }
+    if (NEO::SysCalls::flock(configFd, LOCK_EX | LOCK_NB) < 0) {
+        NEO::SysCalls::close(configFd);
+        return;
+    }
+    const auto indexSize = appendCacheIndexRecord(cacheDir, CompilerCacheIndex::createTouchRecord(fileName));
+    if (indexSize > 0) {
+        compactCacheIndexIfNeeded(cacheDir, indexSize);
+    }
+    unlockFileAndClose(configFd);
+}
+
+class MappedCachedBinary : public CachedBinaryView {
+  public:
+    MappedCachedBinary(void *address, size_t size) : CachedBinaryView({reinterpret_cast<const uint8_t *>(address), size}) {}
+    ~MappedCachedBinary() override {
+        NEO::SysCalls::munmap(const_cast<uint8_t *>(data.begin()), data.size());
+    }
+};
+
+std::unique_ptr<CachedBinaryView> CompilerCache::mapCachedBinary(const std::string &kernelFileHash) {
+    std::string fileName = kernelFileHash + config.cacheFileExtension;
+    std::string filePath = joinPath(config.cacheDir, fileName);
+
+    int fd = NEO::SysCalls::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat statbuf = {};
+    void *address = MAP_FAILED;
+    size_t size = 0u;
+    if (NEO::SysCalls::fstat(fd, &statbuf) == 0 && statbuf.st_size > 0) {
+        size = static_cast<size_t>(statbuf.st_size);
+        address = NEO::SysCalls::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // mapping stays valid after closing descriptor
+    NEO::SysCalls::close(fd);
+
+    if (address == MAP_FAILED || address == nullptr) {
+        return nullptr;
+    }
+
+    appendCacheIndexTouchRecord(config.cacheDir, fileName);
+    return std::make_unique<MappedCachedBinary>(address, size);
+}
+
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
+    std::string fileName = kernelFileHash + config.cacheFileExtension;
+    std::string filePath = joinPath(config.cacheDir, fileName);
 
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    auto binary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    if (binary) {
+        appendCacheIndexTouchRecord(config.cacheDir, fileName);
+    }
+    return binary;
 }
 } // namespace NEO
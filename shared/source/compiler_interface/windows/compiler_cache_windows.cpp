@@ -318,4 +318,9 @@ std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kerne
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
 }
+
+std::unique_ptr<CachedBinaryView> CompilerCache::mapCachedBinary(const std::string &kernelFileHash) {
+    return nullptr;
+}
+
 } // namespace NEO
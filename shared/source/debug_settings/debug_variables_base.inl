@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,6 +61,7 @@ DECLARE_DEBUG_VARIABLE(bool, OverrideInvalidEngineWithDefault, false, "Default t
 DECLARE_DEBUG_VARIABLE(bool, ForceImplicitFlush, false, "Flush after each enqueue; useful for debugging batched submission logic")
 DECLARE_DEBUG_VARIABLE(bool, ForcePipeControlPriorToWalker, false, "Force pipe control prior to walker")
 DECLARE_DEBUG_VARIABLE(bool, ZebinAppendElws, false, "Append cross-thread data with enqueue local work size")
+DECLARE_DEBUG_VARIABLE(int32_t, ZeInfoDecodeThreads, -1, "Number of threads decoding kernel entries of zeInfo. -1: default (calling thread only), >1: kernels decoded concurrently by that many threads")
 DECLARE_DEBUG_VARIABLE(bool, UseBindlessDebugSip, false, "Use bindless debug system routine")
 DECLARE_DEBUG_VARIABLE(bool, CleanStateInPreamble, false, "Ensures clean state in preamble")
 DECLARE_DEBUG_VARIABLE(bool, EnableStatelessCompressionWithUnifiedMemory, false, "Enable stateless compression with unified memory")
@@ -209,6 +210,20 @@ DECLARE_DEBUG_VARIABLE(int32_t, Force2dImageAsArray, -1, "-1: default, 0: WA Dis
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedBufferSize, -1, "-1: default, 0: disabled, >=1: Forces extended buffer size by specified pageSize number in clCreateBuffer, clCreateBufferWithProperties and clCreateBufferWithPropertiesINTEL calls")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedUSMBufferSize, -1, "-1: default, 0: disabled, >=1: Forces extended buffer size by specified pageSize number in USM calls")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedKernelIsaSize, -1, "-1: default, 0: disabled, >=1: Forces extended kernel isa size by specified pageSize number")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelImmutableDataInit, -1, "-1: default, 0: disabled, 1: enabled. L0 user modules defer kernel immutable data and per-kernel ISA allocation until first zeKernelCreate or zeModuleGetFunctionPointer")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableMultiPageIsaPooling, -1, "-1: default, 0: disabled, 1: enabled. L0 modules with ISA larger than single page are packed into shared ISA pool instead of allocation per kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDecodedProgramCache, -1, "-1: default, 0: disabled, 1: enabled. Decoded zebin programs are stored in compiler cache and loaded instead of decoding same binary again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableProgramBuildDeduplication, -1, "-1: default (disabled), 0: disabled, 1: enabled. clBuildProgram compiles once per hw ip version and reuses device binary for other root devices with same hw ip version, use only when such root devices are configured identically")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelProgramBinaryProcessing, -1, "-1: default (disabled), 0: disabled, 1: enabled. clBuildProgram processes device binaries of root devices concurrently, one thread per root device")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedIsaUpload, -1, "-1: default (enabled), 0: disabled, 1: enabled. ISA of all kernels of program or module is staged in single host buffer and uploaded with one blitter submission instead of one per kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinsWarmUp, -1, "-1: default (disabled), 0: disabled, 1: enabled. L0 device loads builtin modules and kernels used by command lists in background threads at creation instead of on first use")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableResidencyContainerDedupOnAppend, -1, "-1: default (enabled), 0: disabled, 1: enabled. Command container skips allocations already present in its residency container when they are added, instead of relying only on deduplication at close")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIncrementalResidency, -1, "-1: default (enabled), 0: disabled, 1: enabled. Vm bind memory operations handler skips allocations already made resident in given os context since last eviction when merging residency container")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWorkingSetEviction, -1, "-1: default (disabled), 0: disabled, 1: enabled. Vm bind memory operations handler tracks bound local memory and, once it exceeds high watermark after binding, evicts least recently submitted allocations until usage drops below low watermark")
+DECLARE_DEBUG_VARIABLE(int32_t, WorkingSetEvictionLowWatermark, -1, "-1: default (80), >=0: percent of local memory size down to which cold allocations are evicted when high watermark is exceeded with EnableWorkingSetEviction set")
+DECLARE_DEBUG_VARIABLE(int32_t, WorkingSetEvictionHighWatermark, -1, "-1: default (95), >=0: percent of local memory size above which cold allocations are evicted after binding new allocations when EnableWorkingSetEviction is set")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdaptiveIdleDetection, -1, "-1: default (disabled), 0: disabled, 1: enabled. Direct submission controller learns per ring idle gaps to choose ring stop timeout, sleeps until nearest ring stop deadline and is woken up on ring restart")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMultiProducerAppend, -1, "-1: default (disabled), 0: disabled, 1: enabled. Direct submission reserves ring space under command stream receiver ownership, command buffer is copied into ring and ring semaphore is released in reservation order after the ownership is released")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceSimdMessageSizeInWalker, -1, "-1: default, >=0 Program given value in Walker command for SIMD size")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRecoverablePageFaults, -1, "-1: default - ignore, 0: disable, 1: enable recoverable page faults on all VMs (on faultable hardware)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableImplicitMigrationOnFaultableHardware, -1, "-1: default - ignore, 0: disable, 1: enable implicit migration on faultable hardware (for all allocations)")
@@ -423,15 +438,20 @@ DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: defa
 DECLARE_DEBUG_VARIABLE(int32_t, EnableL3FlushAfterPostSync, -1, "-1: default, 0: disabled, 1: enabled. If enabled flush L3 after post sync operation")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (enabled, 2MB), 0: disabled, >=1: enabled, size in MB")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (enabled, 2MB), 0: disabled, >=1: enabled, size in MB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmPoolsManagerAdaptiveSizing, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, USM pools manager records allocation size histogram and creates dedicated pools for frequently missed size ranges")
 DECLARE_DEBUG_VARIABLE(int32_t, UseLocalPreferredForCacheableBuffers, -1, "Use localPreferred for cacheable buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyWithStagingBuffers, -1, "Enable copy with non-usm memory through staging buffers. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferSize, -1, "Size of single staging buffer. -1: default (2MB), >0: size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferCopyThreads, -1, "Number of threads copying data between host and staging buffers. -1: default (calling thread only), >1: chunk copies split across that many threads")
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePostSyncL1Flush, -1, "-1: default (do nothing), 0: L1 flush disabled in post sync, 1: L1 flush enabled in post sync")
 DECLARE_DEBUG_VARIABLE(int32_t, AllowNotZeroForCompressedOnWddm, -1, "-1: default (do nothing), 0: do not set AllowNotZeroed for compressed resources, 1: set AllowNotZeroed for compressed resources");
 DECLARE_DEBUG_VARIABLE(int32_t, ForceWddmHugeChunkSizeMB, -1, "-1: default (do nothing), >0: set given huge chunk size in MegaBytes for WDDM");
 DECLARE_DEBUG_VARIABLE(int64_t, ForceGmmSystemMemoryBufferForAllocations, 0, "0: default, >0: (bitmask) for given Allocation Types, force GMM_RESOURCE_USAGE_OCL_SYSTEM_MEMORY_BUFFER gmm resource type");
 DECLARE_DEBUG_VARIABLE(int32_t, EmitMemAdvisePriorToCopyForNonUsm, -1, "Enable Memadvise to system memory for copy/fill with shared system input: -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, TreatNonUsmForTransfersAsSharedSystem, -1, "-1: default, 0: import non-usm as external host ptr on copy/fill (legacy mode), 1: treat non usm on copy/fill as shared system usm")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHeapAllocatorFreeRangeIndex, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, HeapAllocator keeps freed ranges coalesced in address and size ordered index instead of freed chunks lists")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSvmAllocLookupCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, each thread remembers its last getSVMAlloc result and reuses it without taking SVM manager lock until any SVM allocation is removed")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorMagazineSize, -1, "-1: default (disabled), 0: disabled, >0: number of free tag nodes cached per thread magazine in TagAllocator, refilled from and drained to shared pool in batches")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -498,6 +518,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of r
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, DrmGemCloseWorkerThreadsCount, -1, "Number of gem close worker threads, each takes an equal batch of pending buffer objects, -1:default (1), >0: threads count")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferredDeleterMaxLatencyUs, -1, "-1: default (deferred deleter thread retries not completed deletions continuously), >=0: deferred deleter thread retires completed deletions in batches and retries remaining ones after at most given number of microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueOperations, -1, "Use Blitter engine for enqueue operations. -1: default, 0: disabled, 1: enabled")
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,10 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 namespace NEO {
 
 namespace Yaml {
@@ -45,23 +49,77 @@ inline Node &addNode(NodesCache &outNodes, Node &prevSibling, Node &parent) {
     return curr;
 }
 
-struct TokenizerContext {
-    TokenizerContext(ConstStringRef text)
-        : pos(text.begin()),
-          end(text.end()),
-          lineBeginPos(text.begin()) {
-        lineTraits.reset();
+void CharacterClassMasks::classifyScalar(const char *block, CharacterClassMasks &outMasks) {
+    outMasks = {};
+    for (auto i = 0u; i < blockSize; i++) {
+        auto c = block[i];
+        auto bit = 1u << i;
+        outMasks.newline |= ('\n' == c) ? bit : 0u;
+        outMasks.space |= (' ' == c) ? bit : 0u;
+        outMasks.nameIdentifier |= (isNameIdentifierCharacter(c) || isSeparationWhitespace(c)) ? bit : 0u;
+        outMasks.singleQuote |= ('\'' == c) ? bit : 0u;
+        outMasks.doubleQuote |= ('\"' == c) ? bit : 0u;
+    }
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+namespace {
+inline uint32_t classifyHalfBlock(__m128i chars, char value) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8(value))));
+}
+
+inline __m128i isInRange(__m128i chars, char first, char last) {
+    return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8(last + 1)));
+}
+
+inline uint32_t classifyNameIdentifierHalfBlock(__m128i chars) {
+    auto lowerCaseChars = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    auto matched = _mm_or_si128(isInRange(lowerCaseChars, 'a', 'z'), isInRange(chars, '0', '9'));
+    for (auto c : {'_', '-', '.', ' ', '\t'}) {
+        matched = _mm_or_si128(matched, _mm_cmpeq_epi8(chars, _mm_set1_epi8(c)));
     }
+    return static_cast<uint32_t>(_mm_movemask_epi8(matched));
+}
 
-    const char *pos = nullptr;
-    const char *const end = nullptr;
+void classifySse2(const char *block, CharacterClassMasks &outMasks) {
+    auto low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+    auto high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16));
+    outMasks.newline = classifyHalfBlock(low, '\n') | (classifyHalfBlock(high, '\n') << 16);
+    outMasks.space = classifyHalfBlock(low, ' ') | (classifyHalfBlock(high, ' ') << 16);
+    outMasks.nameIdentifier = classifyNameIdentifierHalfBlock(low) | (classifyNameIdentifierHalfBlock(high) << 16);
+    outMasks.singleQuote = classifyHalfBlock(low, '\'') | (classifyHalfBlock(high, '\'') << 16);
+    outMasks.doubleQuote = classifyHalfBlock(low, '\"') | (classifyHalfBlock(high, '\"') << 16);
+}
+} // namespace
 
-    uint32_t lineIndent = 0U;
-    TokenId lineBegin = 0U;
-    const char *lineBeginPos = nullptr;
-    bool isParsingIdent = false;
-    Line::LineTraits lineTraits;
-};
+CharacterClassMasks::ClassifyFunc CharacterClassMasks::classify = classifySse2;
+#else
+CharacterClassMasks::ClassifyFunc CharacterClassMasks::classify = CharacterClassMasks::classifyScalar;
+#endif
+
+const char *consumeNameIdentifier(TokenizerContext &context) {
+    if (false == isNameIdentifierBeginningCharacter(*context.pos)) {
+        return context.pos;
+    }
+    return context.scanner.findFirstNotInClass<&CharacterClassMasks::nameIdentifier>(context.pos + 1);
+}
+
+const char *consumeStringLiteral(TokenizerContext &context) {
+    auto quote = context.pos[0];
+    auto it = context.pos + 1;
+    while (it < context.end) {
+        it = ('\'' == quote) ? context.scanner.findFirstInClass<&CharacterClassMasks::singleQuote>(it)
+                             : context.scanner.findFirstInClass<&CharacterClassMasks::doubleQuote>(it);
+        if ((it == context.end) || (it[-1] != '\\')) { // allow escape characters
+            break;
+        }
+        ++it;
+    }
+    if (it >= context.end) {
+        return context.pos; // unterminated literal
+    }
+    return it + 1;
+}
 
 bool tokenizeEndLine(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning, TokenizerContext &context) {
     TokenId lineEnd = static_cast<uint32_t>(outTokens.size());
@@ -160,10 +218,12 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = context.scanner.findFirstNotInClass<&CharacterClassMasks::space>(context.pos);
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0U;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -178,13 +238,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::singleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = context.scanner.findFirstInClass<&CharacterClassMasks::newline>(context.pos + 1);
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::comment));
             }
@@ -200,7 +254,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '\"':
         case '\'': {
             context.isParsingIdent = false;
-            auto parseTokEnd = consumeStringLiteral(text, context.pos);
+            auto parseTokEnd = consumeStringLiteral(context);
             if (parseTokEnd == context.pos) {
                 outErrReason = constructYamlError(outLines.size(), context.lineBeginPos, context.pos, "Unterminated string");
                 return false;
@@ -276,7 +330,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         default: {
             context.isParsingIdent = false;
-            auto tokEnd = consumeNameIdentifier(text, context.pos);
+            auto tokEnd = consumeNameIdentifier(context);
             if (tokEnd != context.pos) {
                 auto tokenData = ConstStringRef(context.pos, tokEnd - context.pos);
                 tokenData = tokenData.trimEnd(isWhitespace);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,7 +11,10 @@
 #include "shared/source/utilities/const_stringref.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cstring>
 #include <iterator>
 #include <string>
 
@@ -125,49 +128,6 @@ constexpr const char *consumeNumberOrSign(ConstStringRef wholeText, const char *
     return parsePos;
 }
 
-constexpr const char *consumeNameIdentifier(ConstStringRef wholeText, const char *parsePos) {
-    auto parseEnd = wholeText.end();
-    if (isNameIdentifierBeginningCharacter(*parsePos)) {
-        auto it = parsePos + 1;
-        while (it < parseEnd) {
-            if (false == isNameIdentifierCharacter(*it)) {
-                if (false == isSeparationWhitespace(*it)) {
-                    break;
-                }
-            }
-            ++it;
-        }
-        return it;
-    }
-    return parsePos;
-}
-
-constexpr const char *consumeStringLiteral(ConstStringRef wholeText, const char *parsePos) {
-    auto stringLiteralBeg = *parsePos;
-    switch (stringLiteralBeg) {
-    default:
-        return parsePos;
-    case '\'':
-        break;
-    case '\"':
-        break;
-    }
-    auto parseEnd = wholeText.end();
-    auto it = parsePos + 1;
-    while (it < parseEnd) {
-        if (stringLiteralBeg == it[0]) {
-            if (it[-1] != '\\') { // allow escape characters
-                break;
-            }
-        }
-        ++it;
-    }
-    if (it == parseEnd) {
-        return parsePos; // unterminated literal
-    }
-    return it + 1;
-}
-
 using TokenId = uint32_t;
 
 constexpr TokenId invalidTokenId = std::numeric_limits<TokenId>::max();
@@ -307,6 +267,104 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
 bool isValidInlineCollectionFormat(const char *context, const char *contextEnd);
 constexpr ConstStringRef inlineCollectionYamlErrorMsg = "NEO::Yaml : Inline collection is not in valid regex format - ^\\[(\\s*(\\d|\\w)+,?)*\\s*\\]\\s*\\n";
 
+/*
+ * Tokenizer pre-scan classifies text in blocks of 32 characters, bit n of each mask describes n-th character of the block.
+ * Runs of indentation, name identifiers, comments and string literals are then skipped with bit scans instead of per character.
+ */
+struct CharacterClassMasks {
+    static constexpr size_t blockSize = 32U;
+
+    uint32_t newline = 0U;
+    uint32_t space = 0U;
+    uint32_t nameIdentifier = 0U; // isNameIdentifierCharacter or isSeparationWhitespace
+    uint32_t singleQuote = 0U;
+    uint32_t doubleQuote = 0U;
+
+    using ClassifyFunc = void (*)(const char *block, CharacterClassMasks &outMasks);
+    static void classifyScalar(const char *block, CharacterClassMasks &outMasks);
+    static ClassifyFunc classify;
+};
+
+/*
+ * Caches masks of the block containing the most recently scanned position.
+ * Blocks are aligned to the beginning of the text, the last partial block is zero padded.
+ */
+class TextBlockScanner {
+  public:
+    TextBlockScanner(ConstStringRef text)
+        : textBegin(text.begin()), textEnd(text.end()) {
+    }
+
+    template <uint32_t CharacterClassMasks::*mask>
+    const char *findFirstInClass(const char *pos) {
+        return scan<mask, false>(pos);
+    }
+
+    template <uint32_t CharacterClassMasks::*mask>
+    const char *findFirstNotInClass(const char *pos) {
+        return scan<mask, true>(pos);
+    }
+
+  protected:
+    template <uint32_t CharacterClassMasks::*mask, bool negate>
+    const char *scan(const char *pos) {
+        while (pos < textEnd) {
+            auto offsetInBlock = static_cast<uint32_t>(pos - textBegin) % CharacterClassMasks::blockSize;
+            loadBlock(pos - offsetInBlock);
+            auto candidates = negate ? ~(masks.*mask) : masks.*mask;
+            candidates >>= offsetInBlock;
+            if (0U != candidates) {
+                return std::min(pos + std::countr_zero(candidates), textEnd);
+            }
+            pos += CharacterClassMasks::blockSize - offsetInBlock;
+        }
+        return textEnd;
+    }
+
+    void loadBlock(const char *newBlockBegin) {
+        if (newBlockBegin == blockBegin) {
+            return;
+        }
+        blockBegin = newBlockBegin;
+        auto remaining = static_cast<size_t>(textEnd - blockBegin);
+        if (remaining >= CharacterClassMasks::blockSize) {
+            CharacterClassMasks::classify(blockBegin, masks);
+            return;
+        }
+        char paddedBlock[CharacterClassMasks::blockSize] = {};
+        memcpy(paddedBlock, blockBegin, remaining);
+        CharacterClassMasks::classify(paddedBlock, masks);
+    }
+
+    const char *const textBegin;
+    const char *const textEnd;
+    const char *blockBegin = nullptr;
+    CharacterClassMasks masks;
+};
+
+struct TokenizerContext {
+    TokenizerContext(ConstStringRef text)
+        : pos(text.begin()),
+          end(text.end()),
+          lineBeginPos(text.begin()),
+          scanner(text) {
+        lineTraits.reset();
+    }
+
+    const char *pos = nullptr;
+    const char *const end = nullptr;
+
+    uint32_t lineIndent = 0U;
+    TokenId lineBegin = 0U;
+    const char *lineBeginPos = nullptr;
+    bool isParsingIdent = false;
+    Line::LineTraits lineTraits;
+    TextBlockScanner scanner;
+};
+
+const char *consumeNameIdentifier(TokenizerContext &context);
+const char *consumeStringLiteral(TokenizerContext &context);
+
 bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
 
 using NodeId = uint32_t;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,9 @@
 
 #include "neo_aot_platforms.h"
 
+#include <string_view>
+#include <unordered_map>
+
 namespace NEO {
 template <>
 bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::zebin>(const ArrayRef<const uint8_t> binary) {
@@ -381,6 +384,46 @@ void handleTextSection(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, ZebinSecti
     dst.kernelInfos.push_back(kernelInfo.release());
 }
 
+namespace {
+using KernelSectionsDataMap = std::unordered_map<std::string_view, ArrayRef<const uint8_t>>;
+
+/*
+ * Name lookups below match getKernelHeap and getKernelGtpinInfo (first section with matching name wins),
+ * but are built once so that resolving sections for all kernels is not quadratic in kernels count.
+ */
+template <Elf::ElfIdentifierClass numBits>
+KernelSectionsDataMap getKernelHeapsByName(Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections) {
+    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
+    KernelSectionsDataMap kernelHeaps;
+    kernelHeaps.reserve(zebinSections.textKernelSections.size());
+    for (auto *textSection : zebinSections.textKernelSections) {
+        auto kernelName = getKernelNameFromSectionName(ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name));
+        kernelHeaps.emplace(std::string_view(kernelName.data(), kernelName.size()), textSection->data);
+    }
+    return kernelHeaps;
+}
+
+template <Elf::ElfIdentifierClass numBits>
+KernelSectionsDataMap getKernelGtpinInfosByName(Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections) {
+    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
+    KernelSectionsDataMap kernelGtpinInfos;
+    kernelGtpinInfos.reserve(zebinSections.gtpinInfoSections.size());
+    for (auto *gtpinInfoSection : zebinSections.gtpinInfoSections) {
+        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + gtpinInfoSection->header->name);
+        auto kernelName = sectionName.substr(static_cast<int>(Elf::SectionNames::gtpinInfo.length()));
+        kernelGtpinInfos.emplace(std::string_view(kernelName.data(), kernelName.size()), gtpinInfoSection->data);
+    }
+    return kernelGtpinInfos;
+}
+
+ArrayRef<const uint8_t> findKernelSectionData(const KernelSectionsDataMap &kernelSectionsData, ConstStringRef kernelName) {
+    auto it = kernelSectionsData.find(std::string_view(kernelName.data(), kernelName.size()));
+    return (it != kernelSectionsData.end()) ? it->second : ArrayRef<const uint8_t>{};
+}
+} // namespace
+
 template DecodeError decodeZebin<Elf::EI_CLASS_32>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_32> &elf, std::string &outErrReason, std::string &outWarning);
 template DecodeError decodeZebin<Elf::EI_CLASS_64>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, std::string &outErrReason, std::string &outWarning);
 template <Elf::ElfIdentifierClass numBits>
@@ -443,15 +486,17 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
 
     handleTextSection(dst, elf, zebinSections);
 
+    auto kernelHeaps = getKernelHeapsByName(elf, zebinSections);
+    auto kernelGtpinInfos = getKernelGtpinInfosByName(elf, zebinSections);
     for (auto &kernelInfo : dst.kernelInfos) {
         ConstStringRef kernelName(kernelInfo->kernelDescriptor.kernelMetadata.kernelName);
-        auto kernelInstructions = getKernelHeap(kernelName, elf, zebinSections);
+        auto kernelInstructions = findKernelSectionData(kernelHeaps, kernelName);
         if (kernelInstructions.empty()) {
             outErrReason.append("DeviceBinaryFormat::zebin : Could not find text section for kernel " + kernelName.str() + "\n");
             return DecodeError::invalidBinary;
         }
 
-        auto gtpinInfoForKernel = getKernelGtpinInfo(kernelName, elf, zebinSections);
+        auto gtpinInfoForKernel = findKernelSectionData(kernelGtpinInfos, kernelName);
         if (false == gtpinInfoForKernel.empty()) {
             kernelInfo->igcInfoForGtpin = reinterpret_cast<const gtpin::igc_info_t *>(gtpinInfoForKernel.begin());
         }
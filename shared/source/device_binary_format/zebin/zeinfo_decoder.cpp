@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,7 +19,9 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/worker_threads.h"
 
+#include <atomic>
 #include <sstream>
 
 namespace NEO::Zebin::ZeInfo {
@@ -517,8 +519,74 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
     return DecodeError::success;
 }
 
+uint32_t getZeInfoKernelsDecodeThreadsCount(size_t kernelsCount) {
+    auto threadsCount = NEO::debugManager.flags.ZeInfoDecodeThreads.get();
+    if (threadsCount <= 1 || kernelsCount < 2U) {
+        return 1U;
+    }
+    return getWorkerThreadsCount(std::min(static_cast<size_t>(threadsCount), kernelsCount));
+}
+
+/*
+ * Kernel entries are independent subtrees of the already built yaml tree, so they are decoded concurrently.
+ * Results are merged in kernel order and decoding stops at the first failing kernel, same as in serial mode,
+ * so reported errors and warnings do not depend on thread scheduling.
+ */
+DecodeError decodeZeInfoKernelsParallel(ProgramInfo &dst, Yaml::YamlParser &parser, const std::vector<const Yaml::Node *> &kernelNodes, uint32_t threadsCount, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
+    struct KernelDecodeResult {
+        std::unique_ptr<KernelInfo> kernelInfo;
+        std::string errReason;
+        std::string warning;
+        DecodeError error = DecodeError::success;
+    };
+    std::vector<KernelDecodeResult> results(kernelNodes.size());
+    std::atomic<size_t> nextKernel{0U};
+    std::atomic<size_t> firstFailedKernel{kernelNodes.size()};
+
+    auto decodeKernels = [&]() {
+        for (auto kernelId = nextKernel++; kernelId < kernelNodes.size(); kernelId = nextKernel++) {
+            if (kernelId > firstFailedKernel.load()) {
+                continue;
+            }
+            auto &result = results[kernelId];
+            result.kernelInfo = std::make_unique<KernelInfo>();
+            result.error = decodeZeInfoKernelEntry(result.kernelInfo->kernelDescriptor, parser, *kernelNodes[kernelId], dst.grfSize, dst.minScratchSpaceSize, dst.samplerStateSize, dst.samplerBorderColorStateSize, result.errReason, result.warning, srcZeInfoVersion);
+            if (DecodeError::success != result.error) {
+                auto failedKernel = firstFailedKernel.load();
+                while (kernelId < failedKernel && false == firstFailedKernel.compare_exchange_weak(failedKernel, kernelId)) {
+                }
+            }
+        }
+    };
+
+    runOnWorkerThreads(threadsCount, decodeKernels);
+
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + kernelNodes.size());
+    for (auto &result : results) {
+        outWarning.append(result.warning);
+        if (DecodeError::success != result.error) {
+            outErrReason.append(result.errReason);
+            return result.error;
+        }
+        dst.kernelInfos.push_back(result.kernelInfo.release());
+    }
+    return DecodeError::success;
+}
+
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
     UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
+    if (NEO::debugManager.flags.ZeInfoDecodeThreads.get() > 1) {
+        std::vector<const Yaml::Node *> kernelNodes;
+        kernelNodes.reserve(zeInfoSections.kernels[0]->numChildren);
+        for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+            kernelNodes.push_back(&kernelNd);
+        }
+        auto threadsCount = getZeInfoKernelsDecodeThreadsCount(kernelNodes.size());
+        if (threadsCount > 1U) {
+            return decodeZeInfoKernelsParallel(dst, parser, kernelNodes, threadsCount, outErrReason, outWarning, srcZeInfoVersion);
+        }
+    }
+
     for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
         auto kernelInfo = std::make_unique<KernelInfo>();
         auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, dst.samplerStateSize, dst.samplerBorderColorStateSize, outErrReason, outWarning, srcZeInfoVersion);
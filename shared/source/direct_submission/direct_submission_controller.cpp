@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -36,6 +37,9 @@ DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerIdleDetection.get() != -1) {
         isCsrIdleDetectionEnabled = debugManager.flags.DirectSubmissionControllerIdleDetection.get();
     }
+    if (debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.get() != -1) {
+        adaptiveIdleDetection = !!debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.get();
+    }
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
@@ -81,6 +85,7 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
         controller->handlePagingFenceRequests(lock, false);
 
         auto isControllerNotified = controller->sleep(lock);
+        controller->ringRestartNotified = false;
         if (isControllerNotified) {
             controller->handlePagingFenceRequests(lock, false);
         }
@@ -96,6 +101,7 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
         controller->handlePagingFenceRequests(lock, true);
 
         auto isControllerNotified = controller->sleep(lock);
+        controller->ringRestartNotified = false;
         if (isControllerNotified) {
             controller->handlePagingFenceRequests(lock, true);
         }
@@ -105,6 +111,11 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
 }
 
 void DirectSubmissionController::checkNewSubmissions() {
+    if (this->adaptiveIdleDetection) {
+        this->checkNewSubmissionsAdaptive();
+        return;
+    }
+
     auto timeoutMode = timeoutElapsed();
     if (timeoutMode == TimeoutElapsedMode::notElapsed) {
         return;
@@ -153,6 +164,98 @@ void DirectSubmissionController::checkNewSubmissions() {
     }
 }
 
+void DirectSubmissionController::checkNewSubmissionsAdaptive() {
+    std::vector<const OsContext *> restartedRings;
+    {
+        std::lock_guard<std::mutex> condVarLock(this->condVarMutex);
+        restartedRings.swap(this->restartedRings);
+    }
+
+    std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    const auto now = getCpuTimestamp();
+    auto nextWakeUp = adaptiveIdleSleepTimeout;
+    bool stateChanged = false;
+
+    for (auto &directSubmission : this->directSubmissions) {
+        auto csr = directSubmission.first;
+        auto &state = directSubmission.second;
+        if (state.timeout.count() == 0) {
+            state.timeout = getBaseTimeout(csr);
+        }
+
+        auto taskCount = csr->peekTaskCount();
+        if (taskCount != state.taskCount) {
+            markRingActive(csr, state, now);
+            state.taskCount = taskCount;
+            stateChanged = true;
+        } else if (state.isStopped && std::find(restartedRings.begin(), restartedRings.end(), &csr->getOsContext()) != restartedRings.end()) {
+            // ring restarted by submission whose task count is not published yet, deadline is armed from the restart
+            markRingActive(csr, state, now);
+            stateChanged = true;
+        } else if (!state.isStopped && now - state.lastActivity >= state.timeout) {
+            bool isCopyEngineIdle = true;
+            if (!EngineHelpers::isBcs(csr->getOsContext().getEngineType()) && csr->getProductHelper().checkBcsForDirectSubmissionStop()) {
+                std::optional<TaskCountType> bcsTaskCount{};
+                isCopyEngineIdle = isCopyEngineOnDeviceIdle(csr->getRootDeviceIndex(), bcsTaskCount);
+            }
+            auto csrLock = csr->obtainUniqueOwnership();
+            if (!isCsrIdleDetectionEnabled || (isCopyEngineIdle && isDirectSubmissionIdle(csr, csrLock))) {
+                csr->stopDirectSubmission(false, false);
+                state.isStopped = true;
+                state.lastStop = now;
+                stateChanged = true;
+            } else {
+                state.lastActivity = now;
+            }
+            state.taskCount = csr->peekTaskCount();
+        }
+
+        if (!state.isStopped) {
+            auto timeToStop = std::chrono::duration_cast<std::chrono::microseconds>(state.lastActivity + state.timeout - now);
+            nextWakeUp = std::min(nextWakeUp, std::max(timeToStop, std::chrono::microseconds(1)));
+        }
+    }
+
+    this->adaptiveSleepValue = nextWakeUp;
+    this->wakeups++;
+    if (!stateChanged) {
+        this->idleWakeups++;
+    }
+}
+
+void DirectSubmissionController::markRingActive(CommandStreamReceiver *csr, DirectSubmissionState &state, SteadyClock::time_point now) {
+    if (state.isStopped) {
+        learnIdleGap(csr, state, now);
+    }
+    state.isStopped = false;
+    state.lastActivity = now;
+}
+
+void DirectSubmissionController::learnIdleGap(CommandStreamReceiver *csr, DirectSubmissionState &state, SteadyClock::time_point now) {
+    if (state.lastStop == SteadyClock::time_point{}) {
+        return;
+    }
+
+    const auto idleGap = std::chrono::duration_cast<std::chrono::microseconds>(now - state.lastStop);
+    state.averageIdleGap = state.averageIdleGap.count() == 0 ? idleGap : (state.averageIdleGap * 3 + idleGap) / 4;
+
+    // keep ring alive through typical pauses between bursts, stop early when pauses are long
+    const auto baseTimeout = getBaseTimeout(csr);
+    const auto learnedTimeout = std::chrono::duration_cast<std::chrono::microseconds>(state.averageIdleGap * 1.5);
+    if (state.averageIdleGap > this->maxTimeout || learnedTimeout < baseTimeout) {
+        state.timeout = baseTimeout;
+    } else {
+        state.timeout = std::min(learnedTimeout, this->maxTimeout);
+    }
+}
+
+std::chrono::microseconds DirectSubmissionController::getBaseTimeout(CommandStreamReceiver *csr) const {
+    if (EngineHelpers::isBcs(csr->getOsContext().getEngineType())) {
+        return std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor);
+    }
+    return this->timeout;
+}
+
 bool DirectSubmissionController::isDirectSubmissionIdle(CommandStreamReceiver *csr, std::unique_lock<std::recursive_mutex> &csrLock) {
     if (csr->peekLatestFlushedTaskCount() == csr->peekTaskCount()) {
         return !csr->isBusyWithoutHang(lastHangCheckTime);
@@ -220,6 +323,20 @@ void DirectSubmissionController::enqueueWaitForPagingFence(CommandStreamReceiver
     condVar.notify_one();
 }
 
+void DirectSubmissionController::notifyRingRestart(const OsContext &osContext) {
+    ringRestarts++;
+    if (!this->adaptiveIdleDetection) {
+        return;
+    }
+
+    std::lock_guard lock(this->condVarMutex);
+    if (std::find(restartedRings.begin(), restartedRings.end(), &osContext) == restartedRings.end()) {
+        restartedRings.push_back(&osContext);
+    }
+    ringRestartNotified = true;
+    condVar.notify_one();
+}
+
 void DirectSubmissionController::drainPagingFenceQueue() {
     std::lock_guard lock(this->condVarMutex);
 
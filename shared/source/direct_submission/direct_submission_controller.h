@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,10 +20,12 @@
 #include <optional>
 #include <queue>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class MemoryManager;
 class CommandStreamReceiver;
+class OsContext;
 class Thread;
 class ProductHelper;
 
@@ -45,6 +47,7 @@ class DirectSubmissionController {
   public:
     static constexpr size_t defaultTimeout = 5'000;
     static constexpr size_t timeToPollTagUpdateNS = 20'000;
+    static constexpr std::chrono::microseconds adaptiveIdleSleepTimeout{1'000'000};
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
@@ -60,11 +63,20 @@ class DirectSubmissionController {
     void enqueueWaitForPagingFence(CommandStreamReceiver *csr, uint64_t pagingFenceValue);
     void drainPagingFenceQueue();
 
+    void notifyRingRestart(const OsContext &osContext);
+    uint64_t getRingRestartsCount() const { return ringRestarts; }
+    uint64_t getWakeupsCount() const { return wakeups; }
+    uint64_t getIdleWakeupsCount() const { return idleWakeups; }
+
   protected:
     struct DirectSubmissionState {
         DirectSubmissionState(DirectSubmissionState &&other) noexcept {
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            lastActivity = other.lastActivity;
+            lastStop = other.lastStop;
+            averageIdleGap = other.averageIdleGap;
+            timeout = other.timeout;
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -72,6 +84,10 @@ class DirectSubmissionController {
             }
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            this->lastActivity = other.lastActivity;
+            this->lastStop = other.lastStop;
+            this->averageIdleGap = other.averageIdleGap;
+            this->timeout = other.timeout;
             return *this;
         }
 
@@ -83,10 +99,20 @@ class DirectSubmissionController {
 
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+
+        // Used only with adaptive idle detection
+        SteadyClock::time_point lastActivity{};
+        SteadyClock::time_point lastStop{};
+        std::chrono::microseconds averageIdleGap{0};
+        std::chrono::microseconds timeout{0};
     };
 
     static void *controlDirectSubmissionsState(void *self);
     void checkNewSubmissions();
+    void checkNewSubmissionsAdaptive();
+    void learnIdleGap(CommandStreamReceiver *csr, DirectSubmissionState &state, SteadyClock::time_point now);
+    void markRingActive(CommandStreamReceiver *csr, DirectSubmissionState &state, SteadyClock::time_point now);
+    std::chrono::microseconds getBaseTimeout(CommandStreamReceiver *csr) const;
     bool isDirectSubmissionIdle(CommandStreamReceiver *csr, std::unique_lock<std::recursive_mutex> &csrLock);
     bool isCopyEngineOnDeviceIdle(uint32_t rootDeviceIndex, std::optional<TaskCountType> &bcsTaskCount);
     MOCKABLE_VIRTUAL bool sleep(std::unique_lock<std::mutex> &lock);
@@ -100,7 +126,12 @@ class DirectSubmissionController {
 
     void handlePagingFenceRequests(std::unique_lock<std::mutex> &lock, bool checkForNewSubmissions);
     MOCKABLE_VIRTUAL TimeoutElapsedMode timeoutElapsed();
-    std::chrono::microseconds getSleepValue() const { return std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor); }
+    std::chrono::microseconds getSleepValue() const {
+        if (this->adaptiveIdleDetection) {
+            return this->adaptiveSleepValue;
+        }
+        return std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor);
+    }
 
     uint32_t maxCcsCount = 1u;
     std::array<uint32_t, DeviceBitfield().size()> ccsCount = {};
@@ -120,9 +151,18 @@ class DirectSubmissionController {
     int32_t bcsTimeoutDivisor = 1;
     QueueThrottle lowestThrottleSubmitted = QueueThrottle::HIGH;
     bool isCsrIdleDetectionEnabled = false;
+    bool adaptiveIdleDetection = false;
+    std::chrono::microseconds adaptiveSleepValue{adaptiveIdleSleepTimeout};
 
     std::condition_variable condVar;
     std::mutex condVarMutex;
+    bool ringRestartNotified = false;
+    // Restart is notified before csr task count is updated, so restarted rings are tracked explicitly
+    std::vector<const OsContext *> restartedRings;
+
+    std::atomic<uint64_t> ringRestarts{0};
+    std::atomic<uint64_t> wakeups{0};
+    std::atomic<uint64_t> idleWakeups{0};
 
     std::queue<WaitForPagingFenceRequest> pagingFenceRequests;
 };
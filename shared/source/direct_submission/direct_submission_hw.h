@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,12 +8,15 @@
 #pragma once
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/queue_throttle.h"
+#include "shared/source/direct_submission/direct_submission_publish_scope.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 namespace NEO {
 class MemoryManager;
@@ -72,17 +75,18 @@ struct DirectSubmissionInputParams : NonCopyableClass {
 };
 
 template <typename GfxFamily, typename Dispatcher>
-class DirectSubmissionHw {
+class DirectSubmissionHw : public RingReservationPublisher {
   public:
     DirectSubmissionHw(const DirectSubmissionInputParams &inputParams);
 
-    virtual ~DirectSubmissionHw();
+    ~DirectSubmissionHw() override;
 
     bool initialize(bool submitOnInit);
 
     MOCKABLE_VIRTUAL bool stopRingBuffer(bool blocking);
 
     MOCKABLE_VIRTUAL bool dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp);
+    void publishReservation(const RingReservation &reservation) override;
     uint32_t getDispatchErrorCode();
 
     static std::unique_ptr<DirectSubmissionHw<GfxFamily, Dispatcher>> create(const DirectSubmissionInputParams &inputParams);
@@ -148,7 +152,14 @@ class DirectSubmissionHw {
     virtual void getTagAddressValue(TagData &tagData) = 0;
     virtual void getTagAddressValueForRingSwitch(TagData &tagData) = 0;
     void unblockGpu();
+    void unblockGpu(uint32_t queueWorkCount);
     bool submitCommandBufferToGpu(bool needStart, uint64_t gpuAddress, size_t size, bool needWait, const ResidencyContainer *allocationsForResidency);
+    void notifyRingRestart();
+
+    bool isMultiProducerAppendPossible(BatchBuffer &batchBuffer);
+    bool reserveDispatch(std::unique_lock<std::recursive_mutex> &reservationLock, RingReservation &reservation, bool dispatchMonitorFence, FlushStampTracker &flushStamp);
+    void waitForPublishedReservations();
+    std::unique_lock<std::recursive_mutex> obtainExclusiveRingAccess();
     bool copyCommandBufferIntoRing(BatchBuffer &batchBuffer);
 
     void cpuCachelineFlush(void *ptr, size_t size);
@@ -182,7 +193,7 @@ class DirectSubmissionHw {
 
     void setReturnAddress(void *returnCmd, uint64_t returnAddress);
 
-    void *dispatchWorkloadSection(BatchBuffer &batchBuffer, bool dispatchMonitorFence);
+    void *dispatchWorkloadSection(BatchBuffer &batchBuffer, bool dispatchMonitorFence, RingReservation *reservation = nullptr);
     size_t getSizeDispatch(bool relaxedOrderingSchedulerRequired, bool returnPtrsRequired, bool dispatchMonitorFence);
 
     void dispatchPrefetchMitigation();
@@ -231,6 +242,10 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
 
+    std::recursive_mutex ringReservationMutex;
+    uint64_t reservedDispatches = 0u;
+    std::atomic<uint64_t> publishedDispatches{0u};
+
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
     uint64_t gpuVaForAdditionalSynchronizationWA = 0u;
@@ -280,5 +295,6 @@ class DirectSubmissionHw {
     bool relaxedOrderingSchedulerRequired = false;
     bool inputMonitorFenceDispatchRequirement = true;
     bool notifyKmdDuringMonitorFence = false;
+    bool multiProducerAppend = false;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/execution_environment/execution_environment.h"
@@ -112,6 +113,10 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
     if (Dispatcher::isCopy() && relaxedOrderingEnabled) {
         relaxedOrderingEnabled = (debugManager.flags.DirectSubmissionRelaxedOrderingForBcs.get() != 0);
     }
+
+    if (debugManager.flags.DirectSubmissionMultiProducerAppend.get() != -1) {
+        multiProducerAppend = !!debugManager.flags.DirectSubmissionMultiProducerAppend.get();
+    }
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -227,15 +232,20 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateOsResources() {
 
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu() {
+    unblockGpu(currentQueueWorkCount);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu(uint32_t queueWorkCount) {
     SemaphoreFenceHelper fence(*this);
 
     if (this->pciBarrierPtr) {
         *this->pciBarrierPtr = 0u;
     }
 
-    PRINT_DEBUG_STRING(debugManager.flags.DirectSubmissionPrintSemaphoreUsage.get() == 1, stdout, "DirectSubmission semaphore %" PRIx64 " unlocked with value: %u\n", semaphoreGpuVa, currentQueueWorkCount);
+    PRINT_DEBUG_STRING(debugManager.flags.DirectSubmissionPrintSemaphoreUsage.get() == 1, stdout, "DirectSubmission semaphore %" PRIx64 " unlocked with value: %u\n", semaphoreGpuVa, queueWorkCount);
 
-    semaphoreData->queueWorkCount = currentQueueWorkCount;
+    semaphoreData->queueWorkCount = queueWorkCount;
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -291,6 +301,9 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::initialize(bool submitOnInit) {
         dispatchSemaphoreSection(currentQueueWorkCount);
 
         ringStart = submit(ringCommandStream.getGraphicsAllocation()->getGpuAddress(), startBufferSize, nullptr);
+        if (ringStart) {
+            notifyRingRestart();
+        }
         return ringStart;
     }
     return ret;
@@ -298,6 +311,8 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::initialize(bool submitOnInit) {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBuffer(bool blocking) {
+    auto reservationLock = obtainExclusiveRingAccess();
+
     if (!ringStart) {
         if (blocking) {
             this->ensureRingCompletion();
@@ -449,7 +464,7 @@ inline size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizeDispatch(bool re
 }
 
 template <typename GfxFamily, typename Dispatcher>
-void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBuffer &batchBuffer, bool dispatchMonitorFence) {
+void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBuffer &batchBuffer, bool dispatchMonitorFence, RingReservation *reservation) {
     void *currentPosition = ringCommandStream.getSpace(0);
     auto copyCmdBuffer = this->copyCommandBufferIntoRing(batchBuffer);
 
@@ -497,7 +512,13 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
         auto cmdStreamTaskPtr = ptrOffset(batchBuffer.stream->getCpuBase(), batchBuffer.startOffset);
         auto sizeToCopy = ptrDiff(returnCmd, cmdStreamTaskPtr);
         auto ringPtr = ringCommandStream.getSpace(sizeToCopy);
-        memcpy(ringPtr, cmdStreamTaskPtr, sizeToCopy);
+        if (reservation) {
+            reservation->copyDestination = ringPtr;
+            reservation->copySource = cmdStreamTaskPtr;
+            reservation->copySize = sizeToCopy;
+        } else {
+            memcpy(ringPtr, cmdStreamTaskPtr, sizeToCopy);
+        }
     } else {
         dispatchStartSection(commandStreamAddress);
     }
@@ -591,6 +612,19 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchUllsState() {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
+    std::unique_lock<std::recursive_mutex> reservationLock;
+    RingReservation reservation = {};
+    RingReservation *deferredWrite = nullptr;
+    if (this->multiProducerAppend) {
+        DirectSubmissionPublishScope::publishPendingReservation();
+        reservationLock = std::unique_lock<std::recursive_mutex>(this->ringReservationMutex);
+        if (isMultiProducerAppendPossible(batchBuffer)) {
+            deferredWrite = &reservation;
+        } else {
+            waitForPublishedReservations();
+        }
+    }
+
     this->handleRingRestartForUllsLightResidency(batchBuffer.allocationsForResidency);
 
     lastSubmittedThrottle = batchBuffer.throttle;
@@ -641,7 +675,13 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     handleNewResourcesSubmission();
 
-    void *currentPosition = dispatchWorkloadSection(batchBuffer, dispatchMonitorFence);
+    void *currentPosition = dispatchWorkloadSection(batchBuffer, dispatchMonitorFence, deferredWrite);
+
+    if (deferredWrite) {
+        reservation.dispatchPosition = currentPosition;
+        reservation.dispatchSize = dispatchSize;
+        return reserveDispatch(reservationLock, reservation, dispatchMonitorFence, flushStamp);
+    }
 
     cpuCachelineFlush(currentPosition, dispatchSize);
 
@@ -662,10 +702,81 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     return this->ringStart;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::isMultiProducerAppendPossible(BatchBuffer &batchBuffer) {
+    // Ring start, residency handling and relaxed ordering scheduler keep exclusive access to the ring
+    return this->ringStart &&
+           !batchBuffer.allocationsForResidency &&
+           !batchBuffer.pagingFenceSemInfo.requiresBlockingResidencyHandling &&
+           !(this->relaxedOrderingEnabled && this->relaxedOrderingSchedulerRequired) &&
+           this->copyCommandBufferIntoRing(batchBuffer);
+}
+
+/*
+ * Ticket, queue work count and tag value are taken in reservation order. When caller opened DirectSubmissionPublishScope,
+ * command buffer copy and semaphore release are left to it and happen after command stream receiver ownership is released.
+ */
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::reserveDispatch(std::unique_lock<std::recursive_mutex> &reservationLock, RingReservation &reservation, bool dispatchMonitorFence, FlushStampTracker &flushStamp) {
+    reservation.publisher = this;
+    reservation.ticket = this->reservedDispatches++;
+    reservation.queueWorkCount = this->currentQueueWorkCount++;
+    uint64_t flushValue = updateTagValue(dispatchMonitorFence);
+    reservationLock.unlock();
+
+    if (flushValue == DirectSubmissionHw<GfxFamily, Dispatcher>::updateTagValueFail) {
+        publishReservation(reservation);
+        return false;
+    }
+    flushStamp.setStamp(flushValue);
+
+    if (!DirectSubmissionPublishScope::deferReservation(reservation)) {
+        publishReservation(reservation);
+    }
+    return true;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::publishReservation(const RingReservation &reservation) {
+    if (reservation.copySize > 0u) {
+        memcpy(reservation.copyDestination, reservation.copySource, reservation.copySize);
+    }
+    cpuCachelineFlush(reservation.dispatchPosition, reservation.dispatchSize);
+
+    // Semaphore is released in reservation order, so GPU never runs into ring space which is still being written
+    while (this->publishedDispatches.load(std::memory_order_acquire) != reservation.ticket) {
+        CpuIntrinsics::pause();
+    }
+    this->unblockGpu(reservation.queueWorkCount);
+    cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    this->publishedDispatches.store(reservation.ticket + 1, std::memory_order_release);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::waitForPublishedReservations() {
+    DirectSubmissionPublishScope::publishPendingReservation();
+    while (this->publishedDispatches.load(std::memory_order_acquire) != this->reservedDispatches) {
+        CpuIntrinsics::pause();
+    }
+}
+
+template <typename GfxFamily, typename Dispatcher>
+std::unique_lock<std::recursive_mutex> DirectSubmissionHw<GfxFamily, Dispatcher>::obtainExclusiveRingAccess() {
+    if (!this->multiProducerAppend) {
+        return {};
+    }
+    std::unique_lock<std::recursive_mutex> reservationLock(this->ringReservationMutex);
+    waitForPublishedReservations();
+    return reservationLock;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::submitCommandBufferToGpu(bool needStart, uint64_t gpuAddress, size_t size, bool needWait, const ResidencyContainer *allocationsForResidency) {
     if (needStart) {
         this->ringStart = this->submit(gpuAddress, size, allocationsForResidency);
+        if (this->ringStart) {
+            notifyRingRestart();
+        }
         return this->ringStart;
     } else {
         if (needWait) {
@@ -676,6 +787,14 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::submitCommandBufferToGpu(bool ne
     }
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::notifyRingRestart() {
+    auto controller = this->rootDeviceEnvironment.executionEnvironment.directSubmissionController.get();
+    if (controller) {
+        controller->notifyRingRestart(this->osContext);
+    }
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::setReturnAddress(void *returnCmd, uint64_t returnAddress) {
     using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_publish_scope.h"
+
+namespace NEO {
+
+namespace {
+thread_local DirectSubmissionPublishScope *activePublishScope = nullptr;
+} // namespace
+
+DirectSubmissionPublishScope::DirectSubmissionPublishScope() {
+    if (activePublishScope == nullptr) {
+        activePublishScope = this;
+        active = true;
+    }
+}
+
+DirectSubmissionPublishScope::~DirectSubmissionPublishScope() {
+    if (active) {
+        publish();
+        activePublishScope = nullptr;
+    }
+}
+
+void DirectSubmissionPublishScope::publish() {
+    if (reservationPending) {
+        reservationPending = false;
+        pendingReservation.publisher->publishReservation(pendingReservation);
+    }
+}
+
+bool DirectSubmissionPublishScope::deferReservation(const RingReservation &reservation) {
+    if (activePublishScope == nullptr) {
+        return false;
+    }
+    activePublishScope->publish();
+    activePublishScope->pendingReservation = reservation;
+    activePublishScope->reservationPending = true;
+    return true;
+}
+
+void DirectSubmissionPublishScope::publishPendingReservation() {
+    if (activePublishScope) {
+        activePublishScope->publish();
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+class RingReservationPublisher;
+
+struct RingReservation {
+    RingReservationPublisher *publisher = nullptr;
+    void *dispatchPosition = nullptr;
+    size_t dispatchSize = 0u;
+    void *copyDestination = nullptr;
+    const void *copySource = nullptr;
+    size_t copySize = 0u;
+    uint64_t ticket = 0u;
+    uint32_t queueWorkCount = 0u;
+};
+
+class RingReservationPublisher {
+  public:
+    virtual ~RingReservationPublisher() = default;
+    virtual void publishReservation(const RingReservation &reservation) = 0;
+};
+
+/*
+ * Direct submission dispatches reserved in ring while command stream receiver ownership is held
+ * are written and published when scope is left, after the ownership is released.
+ * Scope has to be created before ownership is taken, nested scopes defer to the outermost one.
+ * At most one reservation per thread is pending, it is published before thread blocks on
+ * ownership, ring access or completion wait, so producers never wait on each other in a cycle.
+ */
+class DirectSubmissionPublishScope : NonCopyableAndNonMovableClass {
+  public:
+    DirectSubmissionPublishScope();
+    ~DirectSubmissionPublishScope();
+
+    void publish();
+
+    static bool deferReservation(const RingReservation &reservation);
+    static void publishPendingReservation();
+
+  protected:
+    RingReservation pendingReservation = {};
+    bool reservationPending = false;
+    bool active = false;
+};
+
+} // namespace NEO
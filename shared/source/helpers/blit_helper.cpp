@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,14 +12,36 @@
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/surface.h"
 
 namespace NEO {
 
 namespace BlitHelperFunctions {
 BlitMemoryToAllocationFunc blitMemoryToAllocation = BlitHelper::blitMemoryToAllocation;
+BlitMemoryToAllocationsFunc blitMemoryToAllocations = BlitHelper::blitMemoryToAllocations;
 } // namespace BlitHelperFunctions
 
+namespace {
+EngineControl *getBcsEngineForBlit(const Device &device, Device &deviceForBlit) {
+    auto &gfxCoreHelper = device.getGfxCoreHelper();
+    auto &selectorCopyEngine = deviceForBlit.getSelectorCopyEngine();
+    auto deviceBitfield = deviceForBlit.getDeviceBitfield();
+    auto internalUsage = true;
+    auto bcsEngineType = EngineHelpers::getBcsEngineType(deviceForBlit.getRootDeviceEnvironment(), deviceBitfield, selectorCopyEngine, internalUsage);
+    auto bcsEngineUsage = gfxCoreHelper.preferInternalBcsEngine() ? EngineUsage::internal : EngineUsage::regular;
+    auto bcsEngine = deviceForBlit.tryGetEngine(bcsEngineType, bcsEngineUsage);
+    if (!bcsEngine) {
+        return nullptr;
+    }
+
+    bcsEngine->commandStreamReceiver->initializeResources(false, device.getPreemptionMode());
+    bcsEngine->commandStreamReceiver->initDirectSubmission();
+    return bcsEngine;
+}
+} // namespace
+
 BlitOperationResult BlitHelper::blitMemoryToAllocation(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                        const Vec3<size_t> &size) {
     auto memoryBanks = memory->storageInfo.getMemoryBanks();
@@ -32,7 +54,6 @@ BlitOperationResult BlitHelper::blitMemoryToAllocationBanks(const Device &device
     if (!hwInfo.capabilityTable.blitterOperationsSupported) {
         return BlitOperationResult::unsupported;
     }
-    auto &gfxCoreHelper = device.getGfxCoreHelper();
 
     UNRECOVERABLE_IF(memoryBanks.none());
 
@@ -45,18 +66,11 @@ BlitOperationResult BlitHelper::blitMemoryToAllocationBanks(const Device &device
 
         UNRECOVERABLE_IF(!pRootDevice->getDeviceBitfield().test(tileId));
         auto pDeviceForBlit = pRootDevice->getNearestGenericSubDevice(tileId);
-        auto &selectorCopyEngine = pDeviceForBlit->getSelectorCopyEngine();
-        auto deviceBitfield = pDeviceForBlit->getDeviceBitfield();
-        auto internalUsage = true;
-        auto bcsEngineType = EngineHelpers::getBcsEngineType(pDeviceForBlit->getRootDeviceEnvironment(), deviceBitfield, selectorCopyEngine, internalUsage);
-        auto bcsEngineUsage = gfxCoreHelper.preferInternalBcsEngine() ? EngineUsage::internal : EngineUsage::regular;
-        auto bcsEngine = pDeviceForBlit->tryGetEngine(bcsEngineType, bcsEngineUsage);
+        auto bcsEngine = getBcsEngineForBlit(device, *pDeviceForBlit);
         if (!bcsEngine) {
             return BlitOperationResult::unsupported;
         }
 
-        bcsEngine->commandStreamReceiver->initializeResources(false, device.getPreemptionMode());
-        bcsEngine->commandStreamReceiver->initDirectSubmission();
         BlitPropertiesContainer blitPropertiesContainer;
         blitPropertiesContainer.push_back(
             BlitProperties::constructPropertiesForReadWrite(BlitterConstants::BlitDirection::hostPtrToBuffer,
@@ -74,4 +88,64 @@ BlitOperationResult BlitHelper::blitMemoryToAllocationBanks(const Device &device
     return BlitOperationResult::success;
 }
 
+/*
+ * All entries read from single host buffer, which is mapped once per tile, and are submitted in one blitter flush per tile.
+ */
+BlitOperationResult BlitHelper::blitMemoryToAllocations(const Device &device, const void *hostPtr, size_t hostPtrSize,
+                                                        const BlitMemoryToAllocationEntries &entries) {
+    const auto &hwInfo = device.getHardwareInfo();
+    if (!hwInfo.capabilityTable.blitterOperationsSupported) {
+        return BlitOperationResult::unsupported;
+    }
+
+    DeviceBitfield memoryBanks{};
+    for (const auto &entry : entries) {
+        memoryBanks |= entry.memory->storageInfo.getMemoryBanks();
+    }
+    UNRECOVERABLE_IF(memoryBanks.none());
+
+    auto pRootDevice = device.getRootDevice();
+
+    for (uint8_t tileId = 0u; tileId < 4u; tileId++) {
+        if (!memoryBanks.test(tileId)) {
+            continue;
+        }
+
+        UNRECOVERABLE_IF(!pRootDevice->getDeviceBitfield().test(tileId));
+        auto pDeviceForBlit = pRootDevice->getNearestGenericSubDevice(tileId);
+        auto bcsEngine = getBcsEngineForBlit(device, *pDeviceForBlit);
+        if (!bcsEngine) {
+            return BlitOperationResult::unsupported;
+        }
+        auto &csr = *bcsEngine->commandStreamReceiver;
+
+        HostPtrSurface hostPtrSurface(hostPtr, hostPtrSize, true);
+        if (!csr.createAllocationForHostSurface(hostPtrSurface, false)) {
+            return BlitOperationResult::fail;
+        }
+        auto hostAllocation = hostPtrSurface.getAllocation();
+
+        BlitPropertiesContainer blitPropertiesContainer;
+        for (const auto &entry : entries) {
+            if (!entry.memory->storageInfo.getMemoryBanks().test(tileId)) {
+                continue;
+            }
+            blitPropertiesContainer.push_back(
+                BlitProperties::constructPropertiesForReadWrite(BlitterConstants::BlitDirection::hostPtrToBuffer,
+                                                                csr, entry.memory, hostAllocation,
+                                                                ptrOffset(hostPtr, entry.hostPtrOffset),
+                                                                (entry.memory->getGpuAddress() + entry.offset),
+                                                                (hostAllocation->getGpuAddress() + entry.hostPtrOffset),
+                                                                0, 0, {entry.size, 1, 1}, 0, 0, 0, 0));
+        }
+
+        const auto newTaskCount = csr.flushBcsTask(blitPropertiesContainer, true, *pDeviceForBlit);
+        if (newTaskCount == CompletionStamp::gpuHang) {
+            return BlitOperationResult::gpuHang;
+        }
+    }
+
+    return BlitOperationResult::success;
+}
+
 } // namespace NEO
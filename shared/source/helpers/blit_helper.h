@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/vec.h"
 
 #include <functional>
+#include <vector>
 
 namespace NEO {
 
@@ -23,6 +24,14 @@ enum class BlitOperationResult {
     gpuHang
 };
 
+struct BlitMemoryToAllocationEntry {
+    GraphicsAllocation *memory = nullptr;
+    size_t offset = 0u;
+    size_t hostPtrOffset = 0u;
+    size_t size = 0u;
+};
+using BlitMemoryToAllocationEntries = std::vector<BlitMemoryToAllocationEntry>;
+
 namespace BlitHelperFunctions {
 using BlitMemoryToAllocationFunc = std::function<BlitOperationResult(const Device &device,
                                                                      GraphicsAllocation *memory,
@@ -30,6 +39,11 @@ using BlitMemoryToAllocationFunc = std::function<BlitOperationResult(const Devic
                                                                      const void *hostPtr,
                                                                      const Vec3<size_t> &size)>;
 extern BlitMemoryToAllocationFunc blitMemoryToAllocation;
+using BlitMemoryToAllocationsFunc = std::function<BlitOperationResult(const Device &device,
+                                                                      const void *hostPtr,
+                                                                      size_t hostPtrSize,
+                                                                      const BlitMemoryToAllocationEntries &entries)>;
+extern BlitMemoryToAllocationsFunc blitMemoryToAllocations;
 } // namespace BlitHelperFunctions
 
 struct BlitHelper {
@@ -37,6 +51,8 @@ struct BlitHelper {
                                                       const Vec3<size_t> &size);
     static BlitOperationResult blitMemoryToAllocationBanks(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                            const Vec3<size_t> &size, DeviceBitfield memoryBanks);
+    static BlitOperationResult blitMemoryToAllocations(const Device &device, const void *hostPtr, size_t hostPtrSize,
+                                                       const BlitMemoryToAllocationEntries &entries);
 };
 
 } // namespace NEO
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+
+namespace {
+constexpr uint64_t prime32v1 = 0x9e3779b1ull;
+constexpr uint64_t prime32v2 = 0x85ebca77ull;
+constexpr uint64_t prime32v3 = 0xc2b2ae3dull;
+constexpr uint64_t prime64v1 = 0x9e3779b185ebca87ull;
+constexpr uint64_t prime64v2 = 0xc2b2ae3d27d4eb4full;
+constexpr uint64_t prime64v3 = 0x165667b19e3779f9ull;
+constexpr uint64_t prime64v4 = 0x85ebca77c2b2ae63ull;
+constexpr uint64_t prime64v5 = 0x27d4eb2f165667c5ull;
+
+constexpr size_t scrambleSecretOffset = Hash128::secretWordsCount - Hash128::lanesCount;
+constexpr size_t mergeLowSecretOffset = 3;
+constexpr size_t mergeHighSecretOffset = 11;
+
+inline uint64_t read64(const uint8_t *ptr) {
+    uint64_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline uint64_t mul128Fold64(uint64_t lhs, uint64_t rhs) {
+    uint64_t loLo = (lhs & 0xffffffffull) * (rhs & 0xffffffffull);
+    uint64_t hiLo = (lhs >> 32) * (rhs & 0xffffffffull);
+    uint64_t loHi = (lhs & 0xffffffffull) * (rhs >> 32);
+    uint64_t hiHi = (lhs >> 32) * (rhs >> 32);
+    uint64_t cross = (loLo >> 32) + (hiLo & 0xffffffffull) + loHi;
+    uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    uint64_t lower = (cross << 32) | (loLo & 0xffffffffull);
+    return lower ^ upper;
+}
+
+inline uint64_t avalanche(uint64_t value) {
+    value ^= value >> 37;
+    value *= prime64v3;
+    value ^= value >> 32;
+    return value;
+}
+
+void scrambleAccumulators(uint64_t *acc, const uint64_t *secret) {
+    for (auto lane = 0u; lane < Hash128::lanesCount; lane++) {
+        auto value = acc[lane];
+        value ^= value >> 47;
+        value ^= secret[lane];
+        acc[lane] = value * prime32v1;
+    }
+}
+
+uint64_t mergeAccumulators(const uint64_t *acc, const uint64_t *secret, uint64_t start) {
+    auto result = start;
+    for (auto lane = 0u; lane < Hash128::lanesCount; lane += 2) {
+        result += mul128Fold64(acc[lane] ^ secret[lane], acc[lane + 1] ^ secret[lane + 1]);
+    }
+    return avalanche(result);
+}
+
+#if defined(__AVX2__)
+void accumulateStripesAvx2(uint64_t *acc, const uint8_t *input, size_t stripesCount, const uint64_t *secret) {
+    auto accLow = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc));
+    auto accHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + 4));
+    auto accumulate = [](__m256i accVec, const uint8_t *data, const uint64_t *key) {
+        auto dataVec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+        auto keyVec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(key));
+        auto dataKey = _mm256_xor_si256(dataVec, keyVec);
+        auto dataKeyHigh = _mm256_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+        auto product = _mm256_mul_epu32(dataKey, dataKeyHigh);
+        auto dataSwap = _mm256_shuffle_epi32(dataVec, _MM_SHUFFLE(1, 0, 3, 2));
+        return _mm256_add_epi64(product, _mm256_add_epi64(accVec, dataSwap));
+    };
+    for (auto stripe = 0u; stripe < stripesCount; stripe++) {
+        auto data = input + stripe * Hash128::stripeSize;
+        accLow = accumulate(accLow, data, secret + stripe);
+        accHigh = accumulate(accHigh, data + 32, secret + stripe + 4);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc), accLow);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + 4), accHigh);
+}
+#elif defined(__SSE2__) || defined(_M_X64)
+void accumulateStripesSse(uint64_t *acc, const uint8_t *input, size_t stripesCount, const uint64_t *secret) {
+    __m128i accVec[4];
+    for (auto i = 0u; i < 4; i++) {
+        accVec[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(acc + 2 * i));
+    }
+    for (auto stripe = 0u; stripe < stripesCount; stripe++) {
+        auto data = input + stripe * Hash128::stripeSize;
+        auto key = secret + stripe;
+        for (auto i = 0u; i < 4; i++) {
+            auto dataVec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16 * i));
+            auto keyVec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key + 2 * i));
+            auto dataKey = _mm_xor_si128(dataVec, keyVec);
+            auto dataKeyHigh = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+            auto product = _mm_mul_epu32(dataKey, dataKeyHigh);
+            auto dataSwap = _mm_shuffle_epi32(dataVec, _MM_SHUFFLE(1, 0, 3, 2));
+            accVec[i] = _mm_add_epi64(product, _mm_add_epi64(accVec[i], dataSwap));
+        }
+    }
+    for (auto i = 0u; i < 4; i++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc + 2 * i), accVec[i]);
+    }
+}
+#endif
+} // namespace
+
+const uint64_t Hash128::secret[Hash128::secretWordsCount] = {
+    0x7c2e92cd5d423adbull, 0x909308aba58d5b72ull, 0xf59c15ef841bad68ull, 0x1947beabdd3d2821ull,
+    0x61a9d7f7af52fc3dull, 0x0f2dff932f565f82ull, 0x693691800190291aull, 0x975203f891a1ac1dull,
+    0xa5285fb2e1dfa410ull, 0x0c17d75923f86547ull, 0x04369eb7a1213c28ull, 0xa1ea3d1ba180966aull,
+    0xb263feef5b3528beull, 0xe8b21c16ff5aa148ull, 0xc6df0a0b3f24d60bull, 0x66f21f3e31f6bc60ull,
+    0x7928f4569cbd065eull, 0x407b892c402fca67ull, 0x5712ac813b5081acull, 0x70f696c312695a0aull,
+    0x6b9e3b677d72d336ull, 0x91fd7c896ea27f6dull, 0xb9298c3d97ddd351ull, 0xac99388d1d17cc90ull,
+    0x64cb889724577546ull, 0xb3a5c9e8915e182eull, 0xd689e32aae26f900ull, 0xf9c3909f0021427full,
+    0xb669eb637eacf71full, 0x6b90462ff15e39ebull, 0xe57ad6a4f49d398eull, 0x15053cb8400caeb4ull};
+
+static_assert(Hash128::lanesCount + Hash128::stripesPerBlock - 1 <= Hash128::secretWordsCount);
+
+#if defined(__AVX2__)
+Hash128::AccumulateStripesFunc Hash128::accumulateStripes = accumulateStripesAvx2;
+#elif defined(__SSE2__) || defined(_M_X64)
+Hash128::AccumulateStripesFunc Hash128::accumulateStripes = accumulateStripesSse;
+#else
+Hash128::AccumulateStripesFunc Hash128::accumulateStripes = Hash128::accumulateStripesScalar;
+#endif
+
+/*
+ * Reference implementation, every SIMD variant must produce the same accumulators.
+ * Stripe n of a block uses secret words starting at n, so reordered stripes do not collide.
+ */
+void Hash128::accumulateStripesScalar(uint64_t *acc, const uint8_t *input, size_t stripesCount, const uint64_t *secret) {
+    for (auto stripe = 0u; stripe < stripesCount; stripe++) {
+        auto data = input + stripe * stripeSize;
+        auto key = secret + stripe;
+        for (auto lane = 0u; lane < lanesCount; lane++) {
+            auto dataValue = read64(data + lane * sizeof(uint64_t));
+            auto dataKey = dataValue ^ key[lane];
+            acc[lane ^ 1] += dataValue;
+            acc[lane] += (dataKey & 0xffffffffull) * (dataKey >> 32);
+        }
+    }
+}
+
+void Hash128::reset() {
+    acc = {prime32v3, prime64v1, prime64v2, prime64v3, prime64v4, prime32v2, prime64v5, prime32v1};
+    buffer = {};
+    bufferedSize = 0;
+    stripesInBlock = 0;
+    totalLength = 0;
+}
+
+void Hash128::consumeStripes(const uint8_t *input, size_t stripesCount) {
+    while (stripesCount > 0) {
+        auto stripesToAccumulate = std::min(stripesCount, stripesPerBlock - stripesInBlock);
+        accumulateStripes(acc.data(), input, stripesToAccumulate, secret + stripesInBlock);
+        input += stripesToAccumulate * stripeSize;
+        stripesCount -= stripesToAccumulate;
+        stripesInBlock += stripesToAccumulate;
+        if (stripesInBlock == stripesPerBlock) {
+            scrambleAccumulators(acc.data(), secret + scrambleSecretOffset);
+            stripesInBlock = 0;
+        }
+    }
+}
+
+void Hash128::update(const char *buff, size_t size) {
+    if (buff == nullptr || size == 0) {
+        return;
+    }
+    auto input = reinterpret_cast<const uint8_t *>(buff);
+    totalLength += size;
+
+    if (bufferedSize > 0) {
+        auto toCopy = std::min(size, stripeSize - bufferedSize);
+        memcpy(buffer.data() + bufferedSize, input, toCopy);
+        bufferedSize += toCopy;
+        input += toCopy;
+        size -= toCopy;
+        if (bufferedSize < stripeSize) {
+            return;
+        }
+        consumeStripes(buffer.data(), 1);
+        bufferedSize = 0;
+    }
+
+    auto stripesCount = size / stripeSize;
+    consumeStripes(input, stripesCount);
+    input += stripesCount * stripeSize;
+    size -= stripesCount * stripeSize;
+
+    if (size > 0) {
+        memcpy(buffer.data(), input, size);
+        bufferedSize = size;
+    }
+}
+
+/*
+ * Pending partial stripe is zero padded, total length is mixed into both halves
+ * so inputs differing only by trailing zeros do not collide.
+ */
+Hash128Value Hash128::finish() const {
+    auto finalAcc = acc;
+    if (bufferedSize > 0) {
+        std::array<uint8_t, stripeSize> lastStripe = {};
+        memcpy(lastStripe.data(), buffer.data(), bufferedSize);
+        accumulateStripes(finalAcc.data(), lastStripe.data(), 1, secret + stripesInBlock);
+    }
+
+    Hash128Value result;
+    result.low = mergeAccumulators(finalAcc.data(), secret + mergeLowSecretOffset, totalLength * prime64v1);
+    result.high = mergeAccumulators(finalAcc.data(), secret + mergeHighSecretOffset, ~(totalLength * prime64v2));
+    return result;
+}
+
+} // namespace NEO
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+struct Hash128Value {
+    uint64_t high = 0;
+    uint64_t low = 0;
+
+    bool operator==(const Hash128Value &other) const {
+        return (high == other.high) && (low == other.low);
+    }
+    bool operator!=(const Hash128Value &other) const {
+        return !(*this == other);
+    }
+};
+
+/*
+ * Streaming 128-bit hash for large inputs (e.g. compiler cache keys).
+ * Input is consumed in 64-byte stripes accumulated into eight 64-bit lanes,
+ * lanes are scrambled after every block of stripes and merged into two 64-bit halves on finish.
+ * SIMD and scalar stripe accumulation produce identical results.
+ */
+class Hash128 {
+  public:
+    static constexpr size_t lanesCount = 8;
+    static constexpr size_t stripeSize = lanesCount * sizeof(uint64_t);
+    static constexpr size_t stripesPerBlock = 16;
+    static constexpr size_t secretWordsCount = 32;
+
+    using AccumulateStripesFunc = void (*)(uint64_t *acc, const uint8_t *input, size_t stripesCount, const uint64_t *secret);
+
+    Hash128() {
+        reset();
+    }
+
+    void update(const char *buff, size_t size);
+    Hash128Value finish() const;
+    void reset();
+
+    static Hash128Value hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+    static void accumulateStripesScalar(uint64_t *acc, const uint8_t *input, size_t stripesCount, const uint64_t *secret);
+    static AccumulateStripesFunc accumulateStripes;
+    static const uint64_t secret[secretWordsCount];
+
+  protected:
+    void consumeStripes(const uint8_t *input, size_t stripesCount);
+
+    std::array<uint64_t, lanesCount> acc;
+    std::array<uint8_t, stripeSize> buffer;
+    size_t bufferedSize = 0;
+    size_t stripesInBlock = 0;
+    uint64_t totalLength = 0;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,18 @@
 
 #include "shared/source/memory_manager/deferred_deleter.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/deferrable_deletion.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <chrono>
+
 namespace NEO {
-DeferredDeleter::DeferredDeleter() = default;
+DeferredDeleter::DeferredDeleter() {
+    if (debugManager.flags.DeferredDeleterMaxLatencyUs.get() != -1) {
+        maxDeferralLatencyUs = debugManager.flags.DeferredDeleterMaxLatencyUs.get();
+    }
+}
 
 void DeferredDeleter::stop() {
     // Called with threadMutex acquired
@@ -53,10 +60,11 @@ void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
     this->elementsToRelease++;
     if (deletion->isExternalHostptr()) {
         this->hostptrsToRelease++;
+        hostptrQueue.pushTailOne(*deletion);
+    } else {
+        queue.pushTailOne(*deletion);
     }
 
-    queue.pushTailOne(*deletion);
-
     lock.unlock();
     condition.notify_one();
 }
@@ -97,14 +105,23 @@ void *DeferredDeleter::run(void *arg) {
     // Mark that working thread really started
     self->doWorkInBackground = true;
     do {
-        if (self->queue.peekIsEmpty()) {
+        if (self->areQueuesEmpty()) {
             // Wait for signal that some items are ready to be deleted
             self->condition.wait(lock);
         }
         lock.unlock();
-        // Delete items placed into deferred delete queue
-        self->clearQueue(false);
-        lock.lock();
+        if (self->maxDeferralLatencyUs < 0) {
+            // Delete items placed into deferred delete queue
+            self->clearQueue(false);
+            lock.lock();
+        } else {
+            // Retire what is ready in one pass, retry not completed items after at most max deferral latency
+            self->processDeletions(false);
+            lock.lock();
+            if (!self->areQueuesEmpty() && !self->shouldStop()) {
+                self->condition.wait_for(lock, std::chrono::microseconds(self->maxDeferralLatencyUs));
+            }
+        }
         // Check whether working thread should be stopped
     } while (!self->shouldStop());
     lock.unlock();
@@ -122,18 +139,41 @@ void DeferredDeleter::drain(bool blocking, bool hostptrsOnly) {
 
 void DeferredDeleter::clearQueue(bool hostptrsOnly) {
     do {
-        auto deletion = queue.removeFrontOne();
-        if (deletion) {
-            bool isDeletionHostptr = deletion->isExternalHostptr();
-            if ((!hostptrsOnly || isDeletionHostptr) && deletion->apply()) {
-                this->elementsToRelease--;
-                if (isDeletionHostptr) {
-                    this->hostptrsToRelease--;
-                }
-            } else {
-                queue.pushTailOne(*deletion.release());
-            }
+        processDeletions(hostptrsOnly);
+    } while (hostptrsOnly ? !areElementsReleased(hostptrsOnly) : !areQueuesEmpty());
+}
+
+void DeferredDeleter::processDeletions(bool hostptrsOnly) {
+    processDeletionsBatch(hostptrQueue, true);
+    if (!hostptrsOnly) {
+        processDeletionsBatch(queue, false);
+    }
+}
+
+void DeferredDeleter::processDeletionsBatch(IDList<DeferrableDeletion, true> &deletionsQueue, bool isHostptrQueue) {
+    IDList<DeferrableDeletion, false> batch(deletionsQueue.detachNodes());
+    IDList<DeferrableDeletion, false> notCompleted;
+    int releasedCount = 0;
+
+    while (auto deletion = batch.removeFrontOne().release()) {
+        if (deletion->apply()) {
+            delete deletion;
+            releasedCount++;
+        } else {
+            notCompleted.pushTailOne(*deletion);
         }
-    } while (hostptrsOnly ? !areElementsReleased(hostptrsOnly) : !queue.peekIsEmpty());
+    }
+
+    if (!notCompleted.peekIsEmpty()) {
+        deletionsQueue.splice(*notCompleted.detachNodes());
+    }
+    this->elementsToRelease -= releasedCount;
+    if (isHostptrQueue) {
+        this->hostptrsToRelease -= releasedCount;
+    }
+}
+
+bool DeferredDeleter::areQueuesEmpty() {
+    return queue.peekIsEmpty() && hostptrQueue.peekIsEmpty();
 }
 } // namespace NEO
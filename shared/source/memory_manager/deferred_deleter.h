@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,9 @@ class DeferredDeleter : NEO::NonCopyableAndNonMovableClass {
     void safeStop();
     void ensureThread();
     MOCKABLE_VIRTUAL void clearQueue(bool hostptrsOnly);
+    void processDeletions(bool hostptrsOnly);
+    void processDeletionsBatch(IDList<DeferrableDeletion, true> &deletionsQueue, bool isHostptrQueue);
+    bool areQueuesEmpty();
     MOCKABLE_VIRTUAL bool shouldStop();
 
     static void *run(void *);
@@ -46,7 +49,9 @@ class DeferredDeleter : NEO::NonCopyableAndNonMovableClass {
     std::atomic<int> hostptrsToRelease = 0;
     std::unique_ptr<Thread> worker;
     int32_t numClients = 0;
+    int32_t maxDeferralLatencyUs = -1;
     IDList<DeferrableDeletion, true> queue;
+    IDList<DeferrableDeletion, true> hostptrQueue;
     std::mutex queueMutex;
     std::mutex threadMutex;
     std::condition_variable condition;
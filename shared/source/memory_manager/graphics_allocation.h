@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -185,6 +185,15 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation>, NEO::NonCopyableAn
         }
     }
     TaskCountType getResidencyTaskCount(uint32_t contextId) const { return usageInfos[contextId].residencyTaskCount; }
+    bool isBoundInOsContext(uint32_t contextId) const { return usageInfos[contextId].boundInOsContext; }
+    void setBoundInOsContext(bool bound, uint32_t contextId) { usageInfos[contextId].boundInOsContext = bound; }
+    void resetBoundInOsContexts() {
+        for (auto &usageInfo : usageInfos) {
+            usageInfo.boundInOsContext = false;
+        }
+    }
+    bool isEvictedFromOsContext(uint32_t contextId) const { return usageInfos[contextId].evictedFromOsContext; }
+    void setEvictedFromOsContext(bool evicted, uint32_t contextId) { usageInfos[contextId].evictedFromOsContext = evicted; }
     void releaseResidencyInOsContext(uint32_t contextId) { updateResidencyTaskCount(objectNotResident, contextId); }
     bool isResidencyTaskCountBelow(TaskCountType taskCount, uint32_t contextId) const { return !isResident(contextId) || getResidencyTaskCount(contextId) < taskCount; }
 
@@ -319,6 +328,21 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation>, NEO::NonCopyableAn
         return residency;
     }
 
+    // Position hint is keyed by residency container id, hint stored by other container is never used as a position
+    size_t getResidencyContainerPositionHint(uint32_t containerId) const {
+        auto hint = residencyContainerPositionHint.load(std::memory_order_relaxed);
+        if (static_cast<uint32_t>(hint >> 32) != containerId) {
+            return std::numeric_limits<size_t>::max();
+        }
+        return static_cast<size_t>(static_cast<uint32_t>(hint));
+    }
+    void setResidencyContainerPositionHint(uint32_t containerId, size_t position) {
+        if (position >= std::numeric_limits<uint32_t>::max()) {
+            return;
+        }
+        residencyContainerPositionHint.store((static_cast<uint64_t>(containerId) << 32) | static_cast<uint32_t>(position), std::memory_order_relaxed);
+    }
+
     uint64_t getBindlessOffset() {
         if (bindlessInfo.heapAllocation == nullptr) {
             return std::numeric_limits<uint64_t>::max();
@@ -368,6 +392,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation>, NEO::NonCopyableAn
         TaskCountType taskCount = objectNotUsed;
         TaskCountType residencyTaskCount = objectNotResident;
         uint32_t inspectionId = 0u;
+        bool boundInOsContext = false;
+        bool evictedFromOsContext = false;
     };
 
     struct SharingInfo {
@@ -426,6 +452,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation>, NEO::NonCopyableAn
     StackVec<Gmm *, EngineLimits::maxHandleCount> gmms;
     ResidencyData residency;
     std::atomic<uint32_t> registeredContextsNum{0};
+    std::atomic<uint64_t> residencyContainerPositionHint{std::numeric_limits<uint64_t>::max()};
     bool shareableHostMemory = false;
     bool cantBeReadOnly = false;
     bool explicitlyMadeResident = false;
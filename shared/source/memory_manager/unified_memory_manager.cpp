@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,20 @@
 
 namespace NEO {
 
+namespace {
+// Last successful getSVMAlloc lookup of the calling thread. Range of the allocation is copied into the entry,
+// so a hit never dereferences svmData. The entry is valid only while generation of its owning manager is unchanged.
+struct SvmAllocLookupCacheEntry {
+    uint64_t ownerId = 0u;
+    uint64_t generation = 0u;
+    const void *ptr = nullptr;
+    size_t size = 0u;
+    SvmAllocationData *svmData = nullptr;
+};
+thread_local SvmAllocLookupCacheEntry svmAllocLookupCacheEntry;
+std::atomic<uint64_t> svmAllocsManagerIdGenerator{1u};
+} // namespace
+
 uint32_t SVMAllocsManager::UnifiedMemoryProperties::getRootDeviceIndex() const {
     if (device) {
         return device->getRootDeviceIndex();
@@ -72,7 +86,6 @@ bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, SvmAll
     if (svmData->isSavedForReuse) {
         return true;
     }
-    std::lock_guard<std::mutex> lock(this->mtx);
     bool isSuccess = true;
     if (auto device = svmData->device) {
         auto lock = device->usmReuseInfo.obtainAllocationsReuseLock();
@@ -97,7 +110,10 @@ bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, SvmAll
             svmAllocsManager->removeFromAllocsForIndirectAccess(*svmData);
         }
         svmData->isSavedForReuse = true;
-        allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr, svmData, waitForCompletion);
+        svmAllocsManager->invalidateSVMAllocLookupCaches();
+        auto &bucket = buckets[getSizeClassIndex(size)];
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        bucket.allocations.emplace(std::lower_bound(bucket.allocations.begin(), bucket.allocations.end(), size), size, ptr, svmData, waitForCompletion);
     }
     if (enablePerformanceLogging) {
         logCacheOperation({.allocationSize = size,
@@ -140,44 +156,54 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     if (false == sizeAllowed(size)) {
         return nullptr;
     }
-    std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        if (false == allocUtilizationAllows(size, allocationIter->allocationSize)) {
-            break;
-        }
-        void *allocationPtr = allocationIter->allocation;
-        DEBUG_BREAK_IF(nullptr == allocationIter->svmData);
-        if (allocationIter->svmData->device == unifiedMemoryProperties.device &&
-            allocationIter->svmData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            allocationIter->svmData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
-            alignmentAllows(allocationIter->allocation, unifiedMemoryProperties.alignment) &&
-            false == isInUse(*allocationIter)) {
-            if (allocationIter->svmData->device) {
-                auto lock = allocationIter->svmData->device->usmReuseInfo.obtainAllocationsReuseLock();
-                allocationIter->svmData->device->usmReuseInfo.recordAllocationGetFromReuse(allocationIter->allocationSize);
-            } else {
-                auto lock = memoryManager->usmReuseInfo.obtainAllocationsReuseLock();
-                memoryManager->usmReuseInfo.recordAllocationGetFromReuse(allocationIter->allocationSize);
-            }
-            if (enablePerformanceLogging) {
-                logCacheOperation({.allocationSize = allocationIter->allocationSize,
-                                   .timePoint = std::chrono::high_resolution_clock::now(),
-                                   .allocationType = allocationIter->svmData->memoryType,
-                                   .operationType = CacheOperationType::get,
-                                   .isSuccess = true});
+    bool utilizationAllows = true;
+    for (auto bucketIndex = getSizeClassIndex(size); bucketIndex < sizeClassesCount && utilizationAllows; ++bucketIndex) {
+        auto &allocations = buckets[bucketIndex].allocations;
+        std::unique_lock<std::mutex> lock(buckets[bucketIndex].mtx);
+        for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
+             allocationIter != allocations.end();
+             ++allocationIter) {
+            if (false == allocUtilizationAllows(size, allocationIter->allocationSize)) {
+                utilizationAllows = false;
+                break;
             }
-            allocationIter->svmData->size = size;
-            allocationIter->svmData->isSavedForReuse = false;
-            allocationIter->svmData->gpuAllocations.getDefaultGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            allocationIter->svmData->gpuAllocations.getDefaultGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
-            if (requireUpdatingAllocsForIndirectAccess) {
-                allocationIter->svmData->setAllocId(++svmAllocsManager->allocationsCounter);
-                svmAllocsManager->reinsertToAllocsForIndirectAccess(*allocationIter->svmData);
+            DEBUG_BREAK_IF(nullptr == allocationIter->svmData);
+            if (allocationIter->svmData->device == unifiedMemoryProperties.device &&
+                allocationIter->svmData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
+                allocationIter->svmData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
+                alignmentAllows(allocationIter->allocation, unifiedMemoryProperties.alignment) &&
+                false == isInUse(*allocationIter)) {
+                const auto allocationSize = allocationIter->allocationSize;
+                void *allocationPtr = allocationIter->allocation;
+                auto svmData = allocationIter->svmData;
+                allocations.erase(allocationIter);
+                lock.unlock();
+
+                if (svmData->device) {
+                    auto lock = svmData->device->usmReuseInfo.obtainAllocationsReuseLock();
+                    svmData->device->usmReuseInfo.recordAllocationGetFromReuse(allocationSize);
+                } else {
+                    auto lock = memoryManager->usmReuseInfo.obtainAllocationsReuseLock();
+                    memoryManager->usmReuseInfo.recordAllocationGetFromReuse(allocationSize);
+                }
+                if (enablePerformanceLogging) {
+                    logCacheOperation({.allocationSize = allocationSize,
+                                       .timePoint = std::chrono::high_resolution_clock::now(),
+                                       .allocationType = svmData->memoryType,
+                                       .operationType = CacheOperationType::get,
+                                       .isSuccess = true});
+                }
+                svmData->size = size;
+                svmData->isSavedForReuse = false;
+                svmAllocsManager->invalidateSVMAllocLookupCaches();
+                svmData->gpuAllocations.getDefaultGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+                svmData->gpuAllocations.getDefaultGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+                if (requireUpdatingAllocsForIndirectAccess) {
+                    svmData->setAllocId(++svmAllocsManager->allocationsCounter);
+                    svmAllocsManager->reinsertToAllocsForIndirectAccess(*svmData);
+                }
+                return allocationPtr;
             }
-            allocations.erase(allocationIter);
-            return allocationPtr;
         }
     }
     if (enablePerformanceLogging) {
@@ -191,26 +217,40 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
 }
 
 void SVMAllocsManager::SvmAllocationCache::trim() {
-    std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto &cachedAllocationInfo : this->allocations) {
-        DEBUG_BREAK_IF(nullptr == cachedAllocationInfo.svmData);
-        if (cachedAllocationInfo.svmData->device) {
-            auto lock = cachedAllocationInfo.svmData->device->usmReuseInfo.obtainAllocationsReuseLock();
-            cachedAllocationInfo.svmData->device->usmReuseInfo.recordAllocationGetFromReuse(cachedAllocationInfo.allocationSize);
-        } else {
-            auto lock = memoryManager->usmReuseInfo.obtainAllocationsReuseLock();
-            memoryManager->usmReuseInfo.recordAllocationGetFromReuse(cachedAllocationInfo.allocationSize);
+    for (auto &bucket : buckets) {
+        std::vector<SvmCacheAllocationInfo> allocationsToTrim;
+        {
+            std::lock_guard<std::mutex> lock(bucket.mtx);
+            allocationsToTrim.swap(bucket.allocations);
         }
-        if (enablePerformanceLogging) {
-            logCacheOperation({.allocationSize = cachedAllocationInfo.allocationSize,
-                               .timePoint = std::chrono::high_resolution_clock::now(),
-                               .allocationType = cachedAllocationInfo.svmData->memoryType,
-                               .operationType = CacheOperationType::trim,
-                               .isSuccess = true});
+        for (auto &cachedAllocationInfo : allocationsToTrim) {
+            DEBUG_BREAK_IF(nullptr == cachedAllocationInfo.svmData);
+            if (cachedAllocationInfo.svmData->device) {
+                auto lock = cachedAllocationInfo.svmData->device->usmReuseInfo.obtainAllocationsReuseLock();
+                cachedAllocationInfo.svmData->device->usmReuseInfo.recordAllocationGetFromReuse(cachedAllocationInfo.allocationSize);
+            } else {
+                auto lock = memoryManager->usmReuseInfo.obtainAllocationsReuseLock();
+                memoryManager->usmReuseInfo.recordAllocationGetFromReuse(cachedAllocationInfo.allocationSize);
+            }
+            if (enablePerformanceLogging) {
+                logCacheOperation({.allocationSize = cachedAllocationInfo.allocationSize,
+                                   .timePoint = std::chrono::high_resolution_clock::now(),
+                                   .allocationType = cachedAllocationInfo.svmData->memoryType,
+                                   .operationType = CacheOperationType::trim,
+                                   .isSuccess = true});
+            }
+            svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, cachedAllocationInfo.svmData);
         }
-        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, cachedAllocationInfo.svmData);
     }
-    this->allocations.clear();
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getAllocationsCount() {
+    size_t allocationsCount = 0u;
+    for (auto &bucket : buckets) {
+        std::lock_guard<std::mutex> lock(bucket.mtx);
+        allocationsCount += bucket.allocations.size();
+    }
+    return allocationsCount;
 }
 
 void SVMAllocsManager::SvmAllocationCache::cleanup() {
@@ -262,39 +302,42 @@ void SVMAllocsManager::SvmAllocationCache::logCacheOperation(const SvmAllocation
 }
 
 void SVMAllocsManager::SvmAllocationCache::trimOldAllocs(std::chrono::high_resolution_clock::time_point trimTimePoint, bool trimAll) {
-    std::lock_guard<std::mutex> lock(this->mtx);
-    auto allocCleanCandidateIndex = allocations.size();
-    while (0u != allocCleanCandidateIndex) {
-        auto &allocCleanCandidate = allocations[--allocCleanCandidateIndex];
-        if (allocCleanCandidate.saveTime > trimTimePoint) {
-            continue;
-        }
-        DEBUG_BREAK_IF(nullptr == allocCleanCandidate.svmData);
-        if (allocCleanCandidate.svmData->device) {
-            auto lock = allocCleanCandidate.svmData->device->usmReuseInfo.obtainAllocationsReuseLock();
-            allocCleanCandidate.svmData->device->usmReuseInfo.recordAllocationGetFromReuse(allocCleanCandidate.allocationSize);
-        } else {
-            auto lock = memoryManager->usmReuseInfo.obtainAllocationsReuseLock();
-            memoryManager->usmReuseInfo.recordAllocationGetFromReuse(allocCleanCandidate.allocationSize);
-        }
-        if (enablePerformanceLogging) {
-            logCacheOperation({.allocationSize = allocCleanCandidate.allocationSize,
-                               .timePoint = std::chrono::high_resolution_clock::now(),
-                               .allocationType = allocCleanCandidate.svmData->memoryType,
-                               .operationType = CacheOperationType::trimOld,
-                               .isSuccess = true});
+    for (auto bucketIndex = sizeClassesCount; 0u != bucketIndex;) {
+        auto &allocations = buckets[--bucketIndex].allocations;
+        std::lock_guard<std::mutex> lock(buckets[bucketIndex].mtx);
+        auto allocCleanCandidateIndex = allocations.size();
+        while (0u != allocCleanCandidateIndex) {
+            auto &allocCleanCandidate = allocations[--allocCleanCandidateIndex];
+            if (allocCleanCandidate.saveTime > trimTimePoint) {
+                continue;
+            }
+            DEBUG_BREAK_IF(nullptr == allocCleanCandidate.svmData);
+            if (allocCleanCandidate.svmData->device) {
+                auto lock = allocCleanCandidate.svmData->device->usmReuseInfo.obtainAllocationsReuseLock();
+                allocCleanCandidate.svmData->device->usmReuseInfo.recordAllocationGetFromReuse(allocCleanCandidate.allocationSize);
+            } else {
+                auto lock = memoryManager->usmReuseInfo.obtainAllocationsReuseLock();
+                memoryManager->usmReuseInfo.recordAllocationGetFromReuse(allocCleanCandidate.allocationSize);
+            }
+            if (enablePerformanceLogging) {
+                logCacheOperation({.allocationSize = allocCleanCandidate.allocationSize,
+                                   .timePoint = std::chrono::high_resolution_clock::now(),
+                                   .allocationType = allocCleanCandidate.svmData->memoryType,
+                                   .operationType = CacheOperationType::trimOld,
+                                   .isSuccess = true});
+            }
+            svmAllocsManager->freeSVMAllocImpl(allocCleanCandidate.allocation, FreePolicyType::defer, allocCleanCandidate.svmData);
+            if (trimAll) {
+                allocCleanCandidate.markForDelete();
+            } else {
+                allocations.erase(allocations.begin() + allocCleanCandidateIndex);
+                return;
+            }
         }
-        svmAllocsManager->freeSVMAllocImpl(allocCleanCandidate.allocation, FreePolicyType::defer, allocCleanCandidate.svmData);
         if (trimAll) {
-            allocCleanCandidate.markForDelete();
-        } else {
-            allocations.erase(allocations.begin() + allocCleanCandidateIndex);
-            break;
+            std::erase_if(allocations, SvmCacheAllocationInfo::isMarkedForDelete);
         }
     }
-    if (trimAll) {
-        std::erase_if(allocations, SvmCacheAllocationInfo::isMarkedForDelete);
-    }
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -388,9 +431,18 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
 
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager)
     : memoryManager(memoryManager) {
+    if (debugManager.flags.EnableSvmAllocLookupCache.get() != -1) {
+        svmAllocLookupCacheEnabled = !!debugManager.flags.EnableSvmAllocLookupCache.get();
+    }
+    // ids are never reused, so entries of a destroyed manager can't be hit by a new one at the same address
+    svmAllocsManagerId = svmAllocsManagerIdGenerator.fetch_add(1u, std::memory_order_relaxed);
 }
 
-SVMAllocsManager::~SVMAllocsManager() = default;
+SVMAllocsManager::~SVMAllocsManager() {
+    if (svmAllocLookupCacheEntry.ownerId == svmAllocsManagerId) {
+        svmAllocLookupCacheEntry = {};
+    }
+}
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
                                        const RootDeviceIndicesContainer &rootDeviceIndices,
@@ -667,9 +719,37 @@ void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
 void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
     ContainerReadWriteLockType lock(mtx);
     internalAllocationsMap.erase(svmAllocData.getAllocId());
+    invalidateSVMAllocLookupCaches();
     svmAllocs.remove(reinterpret_cast<void *>(svmAllocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
 }
 
+SvmAllocationData *SVMAllocsManager::getSVMAllocImpl(const void *ptr) {
+    if (svmAllocLookupCacheEnabled && ptr) {
+        const auto &cacheEntry = svmAllocLookupCacheEntry;
+        if (cacheEntry.ownerId == svmAllocsManagerId &&
+            (ptr == cacheEntry.ptr || (ptr > cacheEntry.ptr && ptrDiff(ptr, cacheEntry.ptr) < cacheEntry.size)) &&
+            cacheEntry.generation == svmAllocsGeneration.load(std::memory_order_acquire)) {
+            return cacheEntry.svmData;
+        }
+    }
+
+    ContainerReadLockType lock(mtx);
+    auto allocationIt = svmAllocs.getImpl(ptr, true);
+    if (allocationIt == svmAllocs.allocations.end()) {
+        return nullptr;
+    }
+    if (svmAllocLookupCacheEnabled) {
+        svmAllocLookupCacheEntry = {svmAllocsManagerId, svmAllocsGeneration.load(std::memory_order_relaxed), allocationIt->first, allocationIt->second->size, allocationIt->second.get()};
+    }
+    return allocationIt->second.get();
+}
+
+void SVMAllocsManager::invalidateSVMAllocLookupCaches() {
+    if (svmAllocLookupCacheEnabled) {
+        svmAllocsGeneration.fetch_add(1u, std::memory_order_acq_rel);
+    }
+}
+
 bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     if (svmDeferFreeAllocs.allocations.size() > 0) {
         this->freeSVMAllocDeferImpl();
@@ -919,6 +999,7 @@ void SVMAllocsManager::freeSVMData(SvmAllocationData *svmData) {
     std::unique_lock<std::mutex> lockForIndirect(mtxForIndirectAccess);
     ContainerReadWriteLockType lock(mtx);
     internalAllocationsMap.erase(svmData->getAllocId());
+    invalidateSVMAllocLookupCaches();
     svmAllocs.remove(reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
 }
 
@@ -932,7 +1013,6 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
 
 void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
     this->usmDeviceAllocationsCache.reset(new SvmAllocationCache);
-    this->usmDeviceAllocationsCache->allocations.reserve(128u);
     this->usmDeviceAllocationsCache->svmAllocsManager = this;
     this->usmDeviceAllocationsCache->memoryManager = memoryManager;
     if (auto usmReuseCleaner = device.getExecutionEnvironment()->unifiedMemoryReuseCleaner.get()) {
@@ -942,7 +1022,6 @@ void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
 
 void SVMAllocsManager::initUsmHostAllocationsCache() {
     this->usmHostAllocationsCache.reset(new SvmAllocationCache);
-    this->usmHostAllocationsCache->allocations.reserve(128u);
     this->usmHostAllocationsCache->svmAllocsManager = this;
     this->usmHostAllocationsCache->memoryManager = memoryManager;
     if (auto usmReuseCleaner = this->memoryManager->peekExecutionEnvironment().unifiedMemoryReuseCleaner.get()) {
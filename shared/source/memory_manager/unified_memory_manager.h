@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/device_bitfield.h"
@@ -20,6 +21,7 @@
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -196,12 +198,26 @@ class SVMAllocsManager {
             bool isSuccess;
         };
 
+        // Cached allocations are split into power-of-two size classes, each guarded by its own lock.
+        // Allocations within a bucket are sorted by size, so walking buckets in order visits all allocations sorted by size.
+        struct SizeClassBucket {
+            std::vector<SvmCacheAllocationInfo> allocations;
+            std::mutex mtx;
+        };
+
         static constexpr size_t maxServicedSize = 256 * MemoryConstants::megaByte;
         static constexpr size_t minimalSizeToCheckUtilization = 4 * MemoryConstants::pageSize64k;
         static constexpr double minimalAllocUtilization = 0.5;
+        static constexpr uint32_t smallestSizeClassShift = 16u;
+        static constexpr uint32_t sizeClassesCount = Math::log2(static_cast<uint64_t>(maxServicedSize)) - smallestSizeClassShift + 1u;
 
         SvmAllocationCache();
 
+        static uint32_t getSizeClassIndex(size_t size) {
+            const auto sizeShift = Math::log2(static_cast<uint64_t>(size | 1u));
+            return sizeShift <= smallestSizeClassShift ? 0u : std::min(sizeShift - smallestSizeClassShift, sizeClassesCount - 1u);
+        }
+
         static bool sizeAllowed(size_t size) { return size <= SvmAllocationCache::maxServicedSize; }
         bool insert(size_t size, void *ptr, SvmAllocationData *svmData, bool waitForCompletion);
         static bool allocUtilizationAllows(size_t requestedSize, size_t reuseCandidateSize);
@@ -212,10 +228,9 @@ class SVMAllocsManager {
         void trimOldAllocs(std::chrono::high_resolution_clock::time_point trimTimePoint, bool trimAll);
         void cleanup();
         void logCacheOperation(const SvmAllocationCachePerfInfo &cachePerfEvent) const;
+        size_t getAllocationsCount();
 
-        std::vector<SvmCacheAllocationInfo> allocations;
-
-        std::mutex mtx;
+        std::array<SizeClassBucket, sizeClassesCount> buckets;
         SVMAllocsManager *svmAllocsManager = nullptr;
         MemoryManager *memoryManager = nullptr;
         bool enablePerformanceLogging = false;
@@ -250,8 +265,7 @@ class SVMAllocsManager {
     template <typename T,
               std::enable_if_t<std::is_same_v<T, void> || std::is_same_v<T, const void>, int> = 0>
     SvmAllocationData *getSVMAlloc(T *ptr) {
-        ContainerReadLockType lock(mtx);
-        return svmAllocs.get(ptr);
+        return getSVMAllocImpl(ptr);
     }
 
     MOCKABLE_VIRTUAL bool freeSVMAlloc(void *ptr, bool blocking);
@@ -313,6 +327,8 @@ class SVMAllocsManager {
     void freeSVMData(SvmAllocationData *svmData);
     void insertSVMAlloc(void *ptr, const SvmAllocationData &allocData);
     void makeResidentForAllocationsWithId(uint32_t allocationId, CommandStreamReceiver &csr);
+    SvmAllocationData *getSVMAllocImpl(const void *ptr);
+    void invalidateSVMAllocLookupCaches();
 
     SortedVectorBasedAllocationTracker svmAllocs;
     MapOperationsTracker svmMapOperations;
@@ -323,5 +339,8 @@ class SVMAllocsManager {
     std::unique_ptr<SvmAllocationCache> usmDeviceAllocationsCache;
     std::unique_ptr<SvmAllocationCache> usmHostAllocationsCache;
     std::multimap<uint32_t, GraphicsAllocation *> internalAllocationsMap;
+    std::atomic<uint64_t> svmAllocsGeneration{1u};
+    uint64_t svmAllocsManagerId = 0u;
+    bool svmAllocLookupCacheEnabled = false;
 };
 } // namespace NEO
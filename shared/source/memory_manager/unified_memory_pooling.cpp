@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -111,6 +111,8 @@ void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t requestedSize, const
 
         pooledPtr = addrToPtr(pooledAddress);
         this->allocations.insert(pooledPtr, AllocationInfo{pooledAddress, actualSize, requestedSize});
+        this->allocatedBytes += actualSize;
+        this->requestedBytes += requestedSize;
 
         ++this->svmMemoryManager->allocationsCounter;
     }
@@ -132,6 +134,8 @@ bool UsmMemAllocPool::freeSVMAlloc(const void *ptr, bool blocking) {
         if (allocationInfo) {
             DEBUG_BREAK_IF(allocationInfo->size == 0 || allocationInfo->address == 0);
             this->chunkAllocator->free(allocationInfo->address, allocationInfo->size);
+            this->allocatedBytes -= allocationInfo->size;
+            this->requestedBytes -= allocationInfo->requestedSize;
             return true;
         }
     }
@@ -171,10 +175,42 @@ uint64_t UsmMemAllocPool::getPoolAddress() const {
     return castToUint64(this->pool);
 }
 
+size_t UsmMemAllocPool::getAllocatedBytes() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return this->allocatedBytes;
+}
+
+size_t UsmMemAllocPool::getRequestedBytes() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return this->requestedBytes;
+}
+
 bool UsmMemAllocPoolsManager::PoolInfo::isPreallocated() const {
     return 0u != preallocateSize;
 }
 
+double UsmMemAllocPoolsManager::PoolStatistics::getHitRatio() const {
+    const auto allocationsCount = pooledAllocationsCount + notPooledAllocationsCount;
+    if (0u == allocationsCount) {
+        return 0.0;
+    }
+    return static_cast<double>(pooledAllocationsCount) / allocationsCount;
+}
+
+double UsmMemAllocPoolsManager::PoolStatistics::getInternalFragmentation() const {
+    if (0u == allocatedBytes) {
+        return 0.0;
+    }
+    return 1.0 - static_cast<double>(requestedBytes) / allocatedBytes;
+}
+
+size_t UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(size_t size) {
+    if (size <= 1u) {
+        return 0u;
+    }
+    return Math::log2(static_cast<uint64_t>(size - 1)) + 1u;
+}
+
 bool UsmMemAllocPoolsManager::ensureInitialized(SVMAllocsManager *svmMemoryManager) {
     DEBUG_BREAK_IF(poolMemoryType != InternalMemoryType::deviceUnifiedMemory &&
                    poolMemoryType != InternalMemoryType::hostUnifiedMemory);
@@ -185,6 +221,7 @@ bool UsmMemAllocPoolsManager::ensureInitialized(SVMAllocsManager *svmMemoryManag
     if (isInitialized()) {
         return true;
     }
+    this->adaptiveSizingEnabled = debugManager.flags.EnableUsmPoolsManagerAdaptiveSizing.get() == 1;
     bool allPoolAllocationsSucceeded = true;
     this->totalSize = 0u;
     SVMAllocsManager::UnifiedMemoryProperties poolsMemoryProperties(poolMemoryType, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitFields);
@@ -217,6 +254,12 @@ void UsmMemAllocPoolsManager::trim() {
             trim(this->pools[poolInfo]);
         }
     }
+    for (auto bucketIndex = 0u; bucketIndex < sizeHistogramBucketsCount; ++bucketIndex) {
+        trim(this->adaptivePools[bucketIndex]);
+        if (this->adaptivePools[bucketIndex].empty()) {
+            this->sizeHistogram[bucketIndex].missesCount = 0u;
+        }
+    }
 }
 
 void UsmMemAllocPoolsManager::trim(std::vector<std::unique_ptr<UsmMemAllocPool>> &poolVector) {
@@ -238,6 +281,11 @@ void UsmMemAllocPoolsManager::cleanup() {
             pool->cleanup();
         }
     }
+    for (const auto &bucketPools : this->adaptivePools) {
+        for (const auto &pool : bucketPools) {
+            pool->cleanup();
+        }
+    }
     this->svmMemoryManager = nullptr;
 }
 
@@ -247,17 +295,61 @@ void *UsmMemAllocPoolsManager::createUnifiedMemoryAllocation(size_t size, const
         return nullptr;
     }
     std::unique_lock<std::mutex> lock(mtx);
+    void *pooledPtr = nullptr;
     for (const auto &poolInfo : this->poolInfos) {
         if (size <= poolInfo.maxServicedSize) {
             for (auto &pool : this->pools[poolInfo]) {
                 if (void *ptr = pool->createUnifiedMemoryAllocation(size, memoryProperties)) {
-                    return ptr;
+                    pooledPtr = ptr;
+                    break;
                 }
             }
             break;
         }
     }
-    return nullptr;
+    if (nullptr == pooledPtr && this->adaptiveSizingEnabled) {
+        pooledPtr = createAdaptivePoolAllocation(size, memoryProperties);
+    }
+    if (pooledPtr) {
+        ++this->pooledAllocationsCount;
+    } else {
+        ++this->notPooledAllocationsCount;
+    }
+    return pooledPtr;
+}
+
+void *UsmMemAllocPoolsManager::createAdaptivePoolAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    const auto bucketIndex = getSizeHistogramBucketIndex(size);
+    auto &bucket = this->sizeHistogram[bucketIndex];
+    ++bucket.allocationsCount;
+    for (auto &pool : this->adaptivePools[bucketIndex]) {
+        if (void *ptr = pool->createUnifiedMemoryAllocation(size, memoryProperties)) {
+            return ptr;
+        }
+    }
+    if (++bucket.missesCount < adaptivePoolCreationThreshold) {
+        return nullptr;
+    }
+
+    const size_t bucketMaxServicedSize = 1ull << bucketIndex;
+    const size_t bucketMinServicedSize = bucketIndex == 0u ? 0u : bucketMaxServicedSize / 2 + 1;
+    const auto poolSize = alignUp(std::max(std::min(bucketMaxServicedSize * adaptivePoolAllocationsCount, maxAdaptivePoolSize), bucketMaxServicedSize),
+                                  UsmMemAllocPool::poolAlignment);
+    if (this->totalSize + poolSize > getFreeMemory() * UsmMemAllocPool::getPercentOfFreeMemoryForRecycling(poolMemoryType)) {
+        return nullptr;
+    }
+
+    SVMAllocsManager::UnifiedMemoryProperties poolsMemoryProperties(poolMemoryType, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitFields);
+    poolsMemoryProperties.device = device;
+    auto pool = std::make_unique<UsmMemAllocPool>();
+    if (false == pool->initialize(this->svmMemoryManager, poolsMemoryProperties, poolSize, bucketMinServicedSize, bucketMaxServicedSize)) {
+        return nullptr;
+    }
+    bucket.missesCount = 0u;
+    this->totalSize += poolSize;
+    auto ptr = pool->createUnifiedMemoryAllocation(size, memoryProperties);
+    this->adaptivePools[bucketIndex].push_back(std::move(pool));
+    return ptr;
 }
 
 bool UsmMemAllocPoolsManager::freeSVMAlloc(const void *ptr, bool blocking) {
@@ -333,7 +425,38 @@ UsmMemAllocPool *UsmMemAllocPoolsManager::getPoolContainingAlloc(const void *ptr
             }
         }
     }
+    for (const auto &bucketPools : this->adaptivePools) {
+        for (const auto &pool : bucketPools) {
+            if (pool->isInPool(ptr)) {
+                return pool.get();
+            }
+        }
+    }
     return nullptr;
 }
 
+UsmMemAllocPoolsManager::PoolStatistics UsmMemAllocPoolsManager::getStatistics() {
+    std::unique_lock<std::mutex> lock(mtx);
+    PoolStatistics statistics{};
+    statistics.pooledAllocationsCount = this->pooledAllocationsCount;
+    statistics.notPooledAllocationsCount = this->notPooledAllocationsCount;
+    statistics.poolsSize = this->totalSize;
+    auto accumulatePool = [&statistics](UsmMemAllocPool &pool) {
+        statistics.allocatedBytes += pool.getAllocatedBytes();
+        statistics.requestedBytes += pool.getRequestedBytes();
+    };
+    for (const auto &poolInfo : this->poolInfos) {
+        for (const auto &pool : this->pools[poolInfo]) {
+            accumulatePool(*pool);
+        }
+    }
+    for (const auto &bucketPools : this->adaptivePools) {
+        statistics.adaptivePoolsCount += bucketPools.size();
+        for (const auto &pool : bucketPools) {
+            accumulatePool(*pool);
+        }
+    }
+    return statistics;
+}
+
 } // namespace NEO
\ No newline at end of file
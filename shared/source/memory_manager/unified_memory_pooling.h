@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/heap_allocator.h"
@@ -45,6 +46,8 @@ class UsmMemAllocPool {
     void *getPooledAllocationBasePtr(const void *ptr);
     size_t getOffsetInPool(const void *ptr) const;
     uint64_t getPoolAddress() const;
+    size_t getAllocatedBytes();
+    size_t getRequestedBytes();
 
     static constexpr auto chunkAlignment = 512u;
     static constexpr auto poolAlignment = MemoryConstants::pageSize2M;
@@ -63,6 +66,8 @@ class UsmMemAllocPool {
     size_t poolSize{};
     size_t minServicedSize;
     size_t maxServicedSize;
+    size_t allocatedBytes{};
+    size_t requestedBytes{};
 };
 
 class UsmMemAllocPoolsManager {
@@ -87,10 +92,29 @@ class UsmMemAllocPoolsManager {
     // clang-format on
     static constexpr size_t firstNonPreallocatedIndex = 3u;
 
+    struct PoolStatistics {
+        uint64_t pooledAllocationsCount = 0u;
+        uint64_t notPooledAllocationsCount = 0u;
+        uint64_t adaptivePoolsCount = 0u;
+        size_t poolsSize = 0u;
+        size_t allocatedBytes = 0u;
+        size_t requestedBytes = 0u;
+        double getHitRatio() const;
+        double getInternalFragmentation() const;
+    };
+
     using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
     static constexpr uint64_t KB = MemoryConstants::kiloByte; // NOLINT(readability-identifier-naming)
     static constexpr uint64_t MB = MemoryConstants::megaByte; // NOLINT(readability-identifier-naming)
     static constexpr uint64_t maxPoolableSize = 256 * MB;
+
+    // Adaptive sizing: poolable requests which miss all pools are counted in power-of-two size buckets,
+    // once a bucket collects enough misses a dedicated pool for that bucket is created
+    static constexpr size_t sizeHistogramBucketsCount = Math::log2(maxPoolableSize) + 1;
+    static constexpr uint64_t adaptivePoolCreationThreshold = 4u;
+    static constexpr size_t adaptivePoolAllocationsCount = 8u;
+    static constexpr size_t maxAdaptivePoolSize = 64 * MB;
+    static size_t getSizeHistogramBucketIndex(size_t size);
     UsmMemAllocPoolsManager(MemoryManager *memoryManager,
                             const RootDeviceIndicesContainer &rootDeviceIndices,
                             const std::map<uint32_t, NEO::DeviceBitfield> &deviceBitFields,
@@ -110,6 +134,7 @@ class UsmMemAllocPoolsManager {
     void *getPooledAllocationBasePtr(const void *ptr);
     size_t getOffsetInPool(const void *ptr);
     UsmMemAllocPool *getPoolContainingAlloc(const void *ptr);
+    PoolStatistics getStatistics();
 
   protected:
     static bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
@@ -120,6 +145,12 @@ class UsmMemAllocPoolsManager {
     bool belongsInPreallocatedPool(size_t size) {
         return size <= poolInfos[firstNonPreallocatedIndex - 1].maxServicedSize;
     }
+    void *createAdaptivePoolAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties);
+
+    struct SizeHistogramBucket {
+        uint64_t allocationsCount = 0u;
+        uint64_t missesCount = 0u;
+    };
 
     SVMAllocsManager *svmMemoryManager{};
     MemoryManager *memoryManager;
@@ -130,6 +161,11 @@ class UsmMemAllocPoolsManager {
     size_t totalSize{};
     std::mutex mtx;
     std::map<PoolInfo, std::vector<std::unique_ptr<UsmMemAllocPool>>> pools;
+    std::array<std::vector<std::unique_ptr<UsmMemAllocPool>>, sizeHistogramBucketsCount> adaptivePools;
+    std::array<SizeHistogramBucket, sizeHistogramBucketsCount> sizeHistogram{};
+    uint64_t pooledAllocationsCount = 0u;
+    uint64_t notPooledAllocationsCount = 0u;
+    bool adaptiveSizingEnabled = false;
 };
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,14 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <queue>
@@ -20,7 +22,14 @@
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    if (debugManager.flags.DrmGemCloseWorkerThreadsCount.get() > 0) {
+        workersCount = static_cast<uint32_t>(debugManager.flags.DrmGemCloseWorkerThreadsCount.get());
+    }
+    runningWorkersCount = workersCount;
     thread = Thread::createFunc(worker, reinterpret_cast<void *>(this));
+    for (uint32_t i = 1; i < workersCount; i++) {
+        additionalThreads.push_back(Thread::createFunc(worker, reinterpret_cast<void *>(this)));
+    }
 }
 
 void DrmGemCloseWorker::closeThread() {
@@ -31,6 +40,10 @@ void DrmGemCloseWorker::closeThread() {
 
         thread->join();
         thread.reset();
+        for (auto &additionalThread : additionalThreads) {
+            additionalThread->join();
+        }
+        additionalThreads.clear();
     }
 }
 
@@ -42,7 +55,11 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
+    queue.push({bo, std::chrono::steady_clock::now()});
+    auto queueDepth = static_cast<uint32_t>(queue.size());
+    if (queueDepth > maxQueueDepth.load(std::memory_order_relaxed)) {
+        maxQueueDepth.store(queueDepth, std::memory_order_relaxed);
+    }
     lock.unlock();
     condition.notify_one();
 }
@@ -59,24 +76,50 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
-inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
-    memoryManager.unreference(bo, false);
+uint64_t DrmGemCloseWorker::getAverageCloseLatencyNs() const {
+    auto closedCount = closedBufferObjectsCount.load();
+    if (closedCount == 0) {
+        return 0u;
+    }
+    return totalCloseLatencyNs.load() / closedCount;
+}
+
+inline void DrmGemCloseWorker::close(const WorkItem &workItem) {
+    workItem.bo->wait(-1);
+    memoryManager.unreference(workItem.bo, false);
+
+    uint64_t latencyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - workItem.pushTime).count();
+    totalCloseLatencyNs += latencyNs;
+    auto currentMaxLatencyNs = maxCloseLatencyNs.load();
+    while (latencyNs > currentMaxLatencyNs && !maxCloseLatencyNs.compare_exchange_weak(currentMaxLatencyNs, latencyNs)) {
+    }
+    closedBufferObjectsCount++;
     workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
+inline void DrmGemCloseWorker::processQueue(std::queue<WorkItem> &inputQueue) {
     while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
+        close(inputQueue.front());
         inputQueue.pop();
-        close(workItem);
+    }
+}
+
+void DrmGemCloseWorker::takeBatch(std::queue<WorkItem> &outputQueue) {
+    if (workersCount == 1u) {
+        outputQueue.swap(queue);
+        return;
+    }
+    // take 1/workersCount of what is queued now and leave the rest to other workers, shares shrink as queue drains
+    auto batchSize = std::max(queue.size() / workersCount, static_cast<size_t>(1u));
+    while (batchSize-- > 0 && !queue.empty()) {
+        outputQueue.push(queue.front());
+        queue.pop();
     }
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
+    std::queue<WorkItem> localQueue;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
@@ -88,18 +131,29 @@ void *DrmGemCloseWorker::worker(void *arg) {
         }
 
         if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+            self->takeBatch(localQueue);
+            if (!self->queue.empty()) {
+                self->condition.notify_one();
+            }
         }
 
         lock.unlock();
         self->processQueue(localQueue);
     }
 
+    // every exiting worker keeps taking batches, so remaining work is drained in parallel
     lock.lock();
-    self->processQueue(self->queue);
+    while (!self->queue.empty()) {
+        self->takeBatch(localQueue);
+        lock.unlock();
+        self->processQueue(localQueue);
+        lock.lock();
+    }
 
     lock.unlock();
-    self->workerDone.store(true);
+    if (--self->runningWorkersCount == 0u) {
+        self->workerDone.store(true);
+    }
     return nullptr;
 }
 } // namespace NEO
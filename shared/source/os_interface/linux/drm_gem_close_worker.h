@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,12 +9,15 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -36,22 +39,42 @@ class DrmGemCloseWorker : NEO::NonCopyableAndNonMovableClass {
 
     bool isEmpty();
 
+    uint32_t getWorkersCount() const { return workersCount; }
+    uint32_t getMaxQueueDepth() const { return maxQueueDepth.load(); }
+    uint64_t getClosedBufferObjectsCount() const { return closedBufferObjectsCount.load(); }
+    uint64_t getMaxCloseLatencyNs() const { return maxCloseLatencyNs.load(); }
+    uint64_t getAverageCloseLatencyNs() const;
+
   protected:
-    void close(BufferObject *workItem);
+    struct WorkItem {
+        BufferObject *bo;
+        std::chrono::steady_clock::time_point pushTime;
+    };
+
+    void close(const WorkItem &workItem);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void processQueue(std::queue<WorkItem> &inputQueue);
+    void takeBatch(std::queue<WorkItem> &outputQueue);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
+    std::vector<std::unique_ptr<Thread>> additionalThreads;
+    uint32_t workersCount = 1u;
 
-    std::queue<BufferObject *> queue;
+    std::queue<WorkItem> queue;
     std::atomic<uint32_t> workCount{0};
 
+    std::atomic<uint32_t> maxQueueDepth{0};
+    std::atomic<uint64_t> closedBufferObjectsCount{0};
+    std::atomic<uint64_t> totalCloseLatencyNs{0};
+    std::atomic<uint64_t> maxCloseLatencyNs{0};
+
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
+    std::atomic<uint32_t> runningWorkersCount{0};
     std::atomic<bool> workerDone{false};
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,7 +17,12 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/memory_info.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_interface.h"
+
+#include <algorithm>
 
 namespace NEO {
 
@@ -47,9 +52,16 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::lock(Device *device, Arra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, const bool forcePagingFence, const bool acquireLock) {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t skippedAllocations = 0u;
+    return makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable, forcePagingFence, false, skippedAllocations);
+}
+
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, const bool forcePagingFence,
+                                                                                       const bool skipBoundAllocations, size_t &skippedAllocations) {
     auto deviceBitfield = osContext->getDeviceBitfield();
+    auto contextId = osContext->getContextId();
 
-    std::lock_guard<std::mutex> lock(mutex);
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -58,6 +70,9 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
         devicesDone++;
 
         for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
+            if (skipBoundAllocations && (*gfxAllocation)->isBoundInOsContext(contextId)) {
+                continue;
+            }
             auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
             auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
 
@@ -66,13 +81,21 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
             }
 
             if (!bo->getBindInfo()[bo->getOsContextId(osContext)][drmIterator]) {
+                if (drmAllocation->isEvictedFromOsContext(contextId)) {
+                    drmAllocation->setEvictedFromOsContext(false, contextId);
+                    reboundAllocations++;
+                }
                 bo->requireExplicitLockedMemory(drmAllocation->isLockedMemory());
                 bo->requireImmediateBinding(true);
 
+                auto wasBound = isWorkingSetEvictionEnabled() && isBoundOnSubdevice(*drmAllocation, drmIterator);
                 int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true, forcePagingFence);
                 if (result) {
                     return MemoryOperationsStatus::outOfMemory;
                 }
+                if (isWorkingSetEvictionEnabled()) {
+                    updateBoundLocalMemorySize(*drmAllocation, drmIterator, wasBound);
+                }
             }
             if (!evictable) {
                 drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
@@ -80,6 +103,16 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
         }
     }
 
+    if (skipBoundAllocations) {
+        for (auto gfxAllocation : gfxAllocations) {
+            if (gfxAllocation->isBoundInOsContext(contextId)) {
+                skippedAllocations++;
+            } else if (!hasSharedBufferObjects(*gfxAllocation)) {
+                gfxAllocation->setBoundInOsContext(true, contextId);
+            }
+        }
+    }
+
     return MemoryOperationsStatus::success;
 }
 
@@ -107,20 +140,30 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictWithinOsContext(OsCo
 
 int DrmMemoryOperationsHandlerBind::evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield) {
     auto drmAllocation = static_cast<DrmAllocation *>(&gfxAllocation);
+    auto evicted = false;
     for (auto drmIterator = 0u; drmIterator < deviceBitfield.size(); drmIterator++) {
         if (deviceBitfield.test(drmIterator)) {
+            auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
+            if (drmAllocation->storageInfo.isChunked) {
+                bo = drmAllocation->getBO();
+            }
+            evicted |= bo->getBindInfo()[bo->getOsContextId(osContext)][drmIterator];
+            auto wasBound = isWorkingSetEvictionEnabled() && isBoundOnSubdevice(*drmAllocation, drmIterator);
             int retVal = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, false, false);
             if (retVal) {
                 return retVal;
             }
-            auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
-            if (drmAllocation->storageInfo.isChunked) {
-                bo = drmAllocation->getBO();
+            if (wasBound) {
+                updateBoundLocalMemorySize(*drmAllocation, drmIterator, wasBound);
             }
             bo->requireImmediateBinding(false);
         }
     }
     drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectNotResident, osContext->getContextId());
+    drmAllocation->setBoundInOsContext(false, osContext->getContextId());
+    if (evicted) {
+        drmAllocation->setEvictedFromOsContext(true, osContext->getContextId());
+    }
 
     return 0;
 }
@@ -148,10 +191,25 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContain
         this->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(memoryManager->getLocalMemAllocs(this->rootDeviceIndex)), true, false, true);
     }
 
-    auto retVal = this->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(residencyContainer), true, false, true);
+    auto incrementalResidency = debugManager.flags.EnableIncrementalResidency.get() != 0;
+    size_t skippedAllocations = 0u;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto retVal = this->makeResidentWithinOsContextImpl(osContext, ArrayRef<GraphicsAllocation *>(residencyContainer), true, false, incrementalResidency, skippedAllocations);
     if (retVal != MemoryOperationsStatus::success) {
         return retVal;
     }
+    skippedResidencyOperations += skippedAllocations;
+
+    if (isWorkingSetEvictionEnabled()) {
+        residencyClock++;
+        for (auto allocation : residencyContainer) {
+            allocation->getResidencyData().updateCompletionData(residencyClock, osContext->getContextId());
+        }
+        if (skippedAllocations < residencyContainer.size()) {
+            trimWorkingSet(osContext);
+        }
+    }
 
     return MemoryOperationsStatus::success;
 }
@@ -171,8 +229,8 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
     auto allocLock = memoryManager->acquireAllocLock();
 
     for (const auto status : {
-             this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion),
-             this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), waitForCompletion)}) {
+             this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion, false, 0u),
+             this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), waitForCompletion, false, 0u)}) {
 
         if (status == MemoryOperationsStatus::gpuHangDetectedDuringOperation) {
             return MemoryOperationsStatus::gpuHangDetectedDuringOperation;
@@ -182,7 +240,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
     return MemoryOperationsStatus::success;
 }
 
-MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion) {
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion, bool trimToLowWatermark, uint64_t protectedSubmission) {
     const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines(this->rootDeviceIndex);
     std::vector<GraphicsAllocation *> evictCandidates;
 
@@ -223,7 +281,14 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
             }
         }
 
+        if (trimToLowWatermark) {
+            this->selectColdAllocationsForEviction(evictCandidates, allocationsForEviction, subdeviceIndex, protectedSubmission);
+        }
+
         for (auto &allocationToEvict : evictCandidates) {
+            if (isBoundOnSubdevice(*allocationToEvict, subdeviceIndex)) {
+                evictedAllocations++;
+            }
             for (const auto &engine : engines) {
                 if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
                     DeviceBitfield deviceBitfield;
@@ -238,4 +303,120 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
     return MemoryOperationsStatus::success;
 }
 
+void DrmMemoryOperationsHandlerBind::selectColdAllocationsForEviction(std::vector<GraphicsAllocation *> &evictCandidates, const std::vector<GraphicsAllocation *> &allocations, uint32_t subdeviceIndex, uint64_t protectedSubmission) {
+    auto workingSetLimit = getWorkingSetLimit(subdeviceIndex, debugManager.flags.WorkingSetEvictionLowWatermark.get() != -1 ? debugManager.flags.WorkingSetEvictionLowWatermark.get() : 80);
+    if (workingSetLimit == 0u) {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, GraphicsAllocation *>> coldestFirst;
+    coldestFirst.reserve(evictCandidates.size());
+    for (auto allocation : evictCandidates) {
+        if (!isBoundOnSubdevice(*allocation, subdeviceIndex)) {
+            continue;
+        }
+        auto lastSubmission = getLastSubmission(*allocation, subdeviceIndex);
+        if (protectedSubmission != 0u && lastSubmission >= protectedSubmission) {
+            continue;
+        }
+        coldestFirst.emplace_back(lastSubmission, allocation);
+    }
+    std::stable_sort(coldestFirst.begin(), coldestFirst.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+    auto boundSize = getBoundSize(allocations, subdeviceIndex);
+    boundLocalMemorySize[subdeviceIndex] = boundSize;
+    evictCandidates.clear();
+    for (auto &[lastSubmission, allocation] : coldestFirst) {
+        if (boundSize <= workingSetLimit) {
+            break;
+        }
+        evictCandidates.push_back(allocation);
+        boundSize -= std::min(boundSize, static_cast<uint64_t>(allocation->getUnderlyingBufferSize()));
+    }
+}
+
+void DrmMemoryOperationsHandlerBind::trimWorkingSet(OsContext *osContext) {
+    auto highWatermark = debugManager.flags.WorkingSetEvictionHighWatermark.get() != -1 ? debugManager.flags.WorkingSetEvictionHighWatermark.get() : 95;
+
+    auto deviceBitfield = osContext->getDeviceBitfield();
+    for (auto subdeviceIndex = 0u; subdeviceIndex < deviceBitfield.size(); subdeviceIndex++) {
+        if (!deviceBitfield.test(subdeviceIndex)) {
+            continue;
+        }
+        auto workingSetLimit = getWorkingSetLimit(subdeviceIndex, highWatermark);
+        if (workingSetLimit != 0u && boundLocalMemorySize[subdeviceIndex] > workingSetLimit) {
+            auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
+            auto allocLock = memoryManager->acquireAllocLock();
+            this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), false, true, residencyClock);
+            return;
+        }
+    }
+}
+
+void DrmMemoryOperationsHandlerBind::updateBoundLocalMemorySize(GraphicsAllocation &allocation, uint32_t subdeviceIndex, bool wasBound) {
+    if (!allocation.isAllocatedInLocalMemoryPool() || wasBound == isBoundOnSubdevice(allocation, subdeviceIndex)) {
+        return;
+    }
+    auto &boundSize = boundLocalMemorySize[subdeviceIndex];
+    auto allocationSize = static_cast<uint64_t>(allocation.getUnderlyingBufferSize());
+    boundSize = wasBound ? boundSize - std::min(boundSize, allocationSize) : boundSize + allocationSize;
+}
+
+uint64_t DrmMemoryOperationsHandlerBind::getLastSubmission(GraphicsAllocation &allocation, uint32_t subdeviceIndex) const {
+    uint64_t lastSubmission = 0u;
+    for (const auto &engine : this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines(this->rootDeviceIndex)) {
+        if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
+            lastSubmission = std::max(lastSubmission, allocation.getResidencyData().getFenceValueForContextId(engine.osContext->getContextId()));
+        }
+    }
+    return lastSubmission;
+}
+
+uint64_t DrmMemoryOperationsHandlerBind::getBoundSize(const std::vector<GraphicsAllocation *> &allocations, uint32_t subdeviceIndex) const {
+    uint64_t boundSize = 0u;
+    for (auto allocation : allocations) {
+        if (allocation->getRootDeviceIndex() == this->rootDeviceIndex && isBoundOnSubdevice(*allocation, subdeviceIndex)) {
+            boundSize += allocation->getUnderlyingBufferSize();
+        }
+    }
+    return boundSize;
+}
+
+uint64_t DrmMemoryOperationsHandlerBind::getWorkingSetLimit(uint32_t subdeviceIndex, int32_t watermark) const {
+    auto memoryInfo = this->rootDeviceEnvironment.osInterface->getDriverModel()->as<Drm>()->getMemoryInfo();
+    if (memoryInfo == nullptr || subdeviceIndex >= memoryInfo->getLocalMemoryRegions().size()) {
+        return 0u;
+    }
+    return memoryInfo->getLocalMemoryRegionSize(subdeviceIndex) * static_cast<uint64_t>(watermark) / 100u;
+}
+
+bool DrmMemoryOperationsHandlerBind::isBoundOnSubdevice(GraphicsAllocation &allocation, uint32_t subdeviceIndex) const {
+    auto drmAllocation = static_cast<DrmAllocation *>(&allocation);
+    auto bo = (drmAllocation->storageInfo.getNumBanks() > 1 && !drmAllocation->storageInfo.isChunked) ? drmAllocation->getBOs()[subdeviceIndex] : drmAllocation->getBO();
+    if (bo == nullptr) {
+        return false;
+    }
+    for (const auto &contextBindInfo : bo->getBindInfo()) {
+        if (contextBindInfo[subdeviceIndex]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DrmMemoryOperationsHandlerBind::hasSharedBufferObjects(GraphicsAllocation &allocation) const {
+    // Shared buffer objects may be unbound through another allocation, their bind info is checked on every merge
+    auto drmAllocation = static_cast<DrmAllocation *>(&allocation);
+    for (auto bo : drmAllocation->getBOs()) {
+        if (bo && (bo->peekIsReusableAllocation() || bo->isBoHandleShared())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DrmMemoryOperationsHandlerBind::isWorkingSetEvictionEnabled() const {
+    return debugManager.flags.EnableWorkingSetEviction.get() == 1;
+}
+
 } // namespace NEO
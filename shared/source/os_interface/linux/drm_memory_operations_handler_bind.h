@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,9 @@
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <array>
+#include <atomic>
+
 namespace NEO {
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
@@ -28,9 +31,33 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
     MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
 
+    uint64_t getSkippedResidencyOperationsCount() const { return skippedResidencyOperations; }
+    uint64_t getEvictedAllocationsCount() const { return evictedAllocations; }
+    uint64_t getReboundAllocationsCount() const { return reboundAllocations; }
+
   protected:
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
-    MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
+    MemoryOperationsStatus makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable, const bool forcePagingFence,
+                                                           const bool skipBoundAllocations, size_t &skippedAllocations);
+    MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion, bool trimToLowWatermark, uint64_t protectedSubmission);
+    void selectColdAllocationsForEviction(std::vector<GraphicsAllocation *> &evictCandidates, const std::vector<GraphicsAllocation *> &allocations, uint32_t subdeviceIndex, uint64_t protectedSubmission);
+    void trimWorkingSet(OsContext *osContext);
+    void updateBoundLocalMemorySize(GraphicsAllocation &allocation, uint32_t subdeviceIndex, bool wasBound);
+    uint64_t getLastSubmission(GraphicsAllocation &allocation, uint32_t subdeviceIndex) const;
+    uint64_t getBoundSize(const std::vector<GraphicsAllocation *> &allocations, uint32_t subdeviceIndex) const;
+    uint64_t getWorkingSetLimit(uint32_t subdeviceIndex, int32_t watermark) const;
+    bool isBoundOnSubdevice(GraphicsAllocation &allocation, uint32_t subdeviceIndex) const;
+    bool hasSharedBufferObjects(GraphicsAllocation &allocation) const;
+    bool isWorkingSetEvictionEnabled() const;
     const RootDeviceEnvironment &rootDeviceEnvironment;
+
+    std::atomic<uint64_t> skippedResidencyOperations{0u};
+
+    // Incremented on every merge, allocations store it per os context in ResidencyData fence values
+    uint64_t residencyClock = 0u;
+    // Size of local memory allocations bound on each tile, updated on bind and unbind and recalculated when trimming
+    std::array<uint64_t, DeviceBitfield().size()> boundLocalMemorySize = {};
+    std::atomic<uint64_t> evictedAllocations{0u};
+    std::atomic<uint64_t> reboundAllocations{0u};
 };
 } // namespace NEO
@@ -0,0 +1,601 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/decoded_program_cache.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/compiler_interface/linker.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash128.h"
+#include "shared/source/helpers/neo_driver_version.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+namespace NEO {
+
+namespace {
+constexpr uint64_t noBinaryOffset = std::numeric_limits<uint64_t>::max();
+
+template <typename... StructsT>
+constexpr uint64_t getStructsLayoutFingerprint() {
+    uint64_t fingerprint = 0U;
+    ((fingerprint = fingerprint * 31U + sizeof(StructsT), fingerprint = fingerprint * 31U + alignof(StructsT)), ...);
+    return fingerprint;
+}
+
+// Descriptors are stored as raw memory, any change in their layout has to invalidate existing entries
+constexpr uint64_t layoutFingerprint = getStructsLayoutFingerprint<KernelDescriptor::KernelAttributes,
+                                                                   decltype(KernelDescriptor::entryPoints),
+                                                                   decltype(KernelDescriptor::PayloadMappings::dispatchTraits),
+                                                                   decltype(KernelDescriptor::PayloadMappings::bindingTable),
+                                                                   decltype(KernelDescriptor::PayloadMappings::samplerTable),
+                                                                   decltype(KernelDescriptor::PayloadMappings::implicitArgs),
+                                                                   KernelDescriptor::InlineSampler,
+                                                                   ArgDescPointer,
+                                                                   ArgDescImage,
+                                                                   ArgDescSampler,
+                                                                   ArgDescValue::Element,
+                                                                   ArgTypeTraits,
+                                                                   decltype(ArgDescriptor::ExtendedTypeInfo::packed),
+                                                                   SymbolInfo,
+                                                                   decltype(LinkerInput::Traits::packed)>();
+
+class DecodedProgramWriter {
+  public:
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto bytes = reinterpret_cast<const uint8_t *>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    void writeBytes(const uint8_t *bytes, size_t size) {
+        write(static_cast<uint64_t>(size));
+        data.insert(data.end(), bytes, bytes + size);
+    }
+
+    void writeString(const std::string &value) {
+        writeBytes(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    }
+
+    template <typename ContainerT, typename WriteElementT>
+    void writeArray(const ContainerT &container, WriteElementT writeElement) {
+        write(static_cast<uint64_t>(container.size()));
+        for (const auto &element : container) {
+            writeElement(element);
+        }
+    }
+
+    void writeBinaryOffset(const void *ptr, ArrayRef<const uint8_t> deviceBinary) {
+        write(ptr ? static_cast<uint64_t>(reinterpret_cast<const uint8_t *>(ptr) - deviceBinary.begin()) : noBinaryOffset);
+    }
+
+    std::vector<uint8_t> data;
+};
+
+/*
+ * Any out of bounds read invalidates the reader, values are left untouched and counts read as 0,
+ * so that decoding can run to the end and be validated once.
+ */
+class DecodedProgramReader {
+  public:
+    DecodedProgramReader(ArrayRef<const uint8_t> data) : data(data) {}
+
+    template <typename T>
+    void read(T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (data.size() - position < sizeof(T)) {
+            valid = false;
+            return;
+        }
+        memcpy(&value, data.begin() + position, sizeof(T));
+        position += sizeof(T);
+    }
+
+    size_t readCount() {
+        uint64_t count = 0;
+        read(count);
+        // every element takes at least one byte
+        if (count > data.size() - position) {
+            valid = false;
+            return 0;
+        }
+        return static_cast<size_t>(count);
+    }
+
+    void readString(std::string &value) {
+        auto size = readCount();
+        value.assign(reinterpret_cast<const char *>(data.begin() + position), size);
+        position += size;
+    }
+
+    void readBytes(std::vector<uint8_t> &value) {
+        auto size = readCount();
+        value.assign(data.begin() + position, data.begin() + position + size);
+        position += size;
+    }
+
+    template <typename T>
+    void readBinaryOffset(const T *&ptr, ArrayRef<const uint8_t> deviceBinary, size_t size) {
+        uint64_t offset = noBinaryOffset;
+        read(offset);
+        if (noBinaryOffset == offset) {
+            ptr = nullptr;
+            return;
+        }
+        if ((offset > deviceBinary.size()) || (deviceBinary.size() - offset < size)) {
+            valid = false;
+            return;
+        }
+        ptr = reinterpret_cast<const T *>(deviceBinary.begin() + offset);
+    }
+
+    void invalidate() {
+        valid = false;
+    }
+
+    bool isFullyConsumed() const {
+        return valid && (position == data.size());
+    }
+
+  protected:
+    ArrayRef<const uint8_t> data;
+    size_t position = 0U;
+    bool valid = true;
+};
+
+bool isInBinary(const void *ptr, size_t size, ArrayRef<const uint8_t> deviceBinary) {
+    if (nullptr == ptr) {
+        return true;
+    }
+    auto bytes = reinterpret_cast<const uint8_t *>(ptr);
+    return (bytes >= deviceBinary.begin()) && (bytes <= deviceBinary.end()) && (static_cast<size_t>(deviceBinary.end() - bytes) >= size);
+}
+
+void writeArgDescriptor(DecodedProgramWriter &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::argTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::argTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::argTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::argTValue:
+        writer.writeArray(arg.as<ArgDescValue>().elements, [&](const ArgDescValue::Element &element) { writer.write(element); });
+        break;
+    }
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo().packed);
+}
+
+void readArgDescriptor(DecodedProgramReader &reader, StackVec<ArgDescriptor, 16> &explicitArgs) {
+    auto type = ArgDescriptor::argTUnknown;
+    reader.read(type);
+    if (type > ArgDescriptor::argTValue) {
+        reader.invalidate();
+        return;
+    }
+
+    ArgDescriptor arg(type);
+    switch (type) {
+    default:
+        break;
+    case ArgDescriptor::argTPointer:
+        reader.read(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::argTImage:
+        reader.read(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::argTSampler:
+        reader.read(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::argTValue:
+        for (auto elementsCount = reader.readCount(); elementsCount > 0; elementsCount--) {
+            ArgDescValue::Element element;
+            reader.read(element);
+            arg.as<ArgDescValue>().elements.push_back(element);
+        }
+        break;
+    }
+    reader.read(arg.getTraits());
+    reader.read(arg.getExtendedTypeInfo().packed);
+    explicitArgs.push_back(arg);
+}
+
+void writeKernelDescriptor(DecodedProgramWriter &writer, const KernelDescriptor &desc) {
+    writer.write(desc.kernelAttributes);
+    writer.write(desc.entryPoints);
+    writer.write(desc.payloadMappings.dispatchTraits);
+    writer.write(desc.payloadMappings.bindingTable);
+    writer.write(desc.payloadMappings.samplerTable);
+    writer.write(desc.payloadMappings.implicitArgs);
+    writer.writeArray(desc.payloadMappings.explicitArgs, [&](const ArgDescriptor &arg) { writeArgDescriptor(writer, arg); });
+    writer.writeArray(desc.explicitArgsExtendedMetadata, [&](const ArgTypeMetadataExtended &metadata) {
+        writer.writeString(metadata.argName);
+        writer.writeString(metadata.type);
+        writer.writeString(metadata.accessQualifier);
+        writer.writeString(metadata.addressQualifier);
+        writer.writeString(metadata.typeQualifiers);
+    });
+    writer.writeArray(desc.inlineSamplers, [&](const KernelDescriptor::InlineSampler &inlineSampler) { writer.write(inlineSampler); });
+
+    writer.writeString(desc.kernelMetadata.kernelName);
+    writer.writeString(desc.kernelMetadata.kernelLanguageAttributes);
+    writer.writeArray(desc.kernelMetadata.printfStringsMap, [&](const auto &printfString) {
+        writer.write(printfString.first);
+        writer.writeString(printfString.second);
+    });
+    writer.write(desc.kernelMetadata.compiledSubGroupsNumber);
+    writer.write(desc.kernelMetadata.requiredSubGroupSize);
+    writer.write(desc.kernelMetadata.requiredThreadGroupDispatchSize);
+    writer.write(desc.kernelMetadata.isGeneratedByIgc);
+
+    writer.writeBytes(desc.generatedSsh.data(), desc.generatedSsh.size());
+    writer.writeBytes(desc.generatedDsh.data(), desc.generatedDsh.size());
+}
+
+void readKernelDescriptor(DecodedProgramReader &reader, KernelDescriptor &desc) {
+    reader.read(desc.kernelAttributes);
+    reader.read(desc.entryPoints);
+    reader.read(desc.payloadMappings.dispatchTraits);
+    reader.read(desc.payloadMappings.bindingTable);
+    reader.read(desc.payloadMappings.samplerTable);
+    reader.read(desc.payloadMappings.implicitArgs);
+    for (auto argsCount = reader.readCount(); argsCount > 0; argsCount--) {
+        readArgDescriptor(reader, desc.payloadMappings.explicitArgs);
+    }
+    desc.explicitArgsExtendedMetadata.resize(reader.readCount());
+    for (auto &metadata : desc.explicitArgsExtendedMetadata) {
+        reader.readString(metadata.argName);
+        reader.readString(metadata.type);
+        reader.readString(metadata.accessQualifier);
+        reader.readString(metadata.addressQualifier);
+        reader.readString(metadata.typeQualifiers);
+    }
+    desc.inlineSamplers.resize(reader.readCount());
+    for (auto &inlineSampler : desc.inlineSamplers) {
+        reader.read(inlineSampler);
+    }
+
+    reader.readString(desc.kernelMetadata.kernelName);
+    reader.readString(desc.kernelMetadata.kernelLanguageAttributes);
+    for (auto printfStringsCount = reader.readCount(); printfStringsCount > 0; printfStringsCount--) {
+        uint32_t index = 0U;
+        reader.read(index);
+        reader.readString(desc.kernelMetadata.printfStringsMap[index]);
+    }
+    reader.read(desc.kernelMetadata.compiledSubGroupsNumber);
+    reader.read(desc.kernelMetadata.requiredSubGroupSize);
+    reader.read(desc.kernelMetadata.requiredThreadGroupDispatchSize);
+    reader.read(desc.kernelMetadata.isGeneratedByIgc);
+
+    reader.readBytes(desc.generatedSsh);
+    reader.readBytes(desc.generatedDsh);
+}
+
+void writeRelocation(DecodedProgramWriter &writer, const LinkerInput::RelocationInfo &relocation) {
+    writer.writeString(relocation.symbolName);
+    writer.write(relocation.offset);
+    writer.write(relocation.type);
+    writer.write(relocation.relocationSegment);
+    writer.writeString(relocation.relocationSegmentName);
+    writer.write(relocation.addend);
+}
+
+void readRelocations(DecodedProgramReader &reader, LinkerInput::Relocations &relocations) {
+    relocations.resize(reader.readCount());
+    for (auto &relocation : relocations) {
+        reader.readString(relocation.symbolName);
+        reader.read(relocation.offset);
+        reader.read(relocation.type);
+        reader.read(relocation.relocationSegment);
+        reader.readString(relocation.relocationSegmentName);
+        reader.read(relocation.addend);
+    }
+}
+
+void writeLinkerInput(DecodedProgramWriter &writer, const LinkerInput &linkerInput) {
+    writer.write(linkerInput.getTraits().packed);
+    writer.write(linkerInput.getExportedFunctionsSegmentId());
+    writer.writeArray(linkerInput.getSymbols(), [&](const auto &symbol) {
+        writer.writeString(symbol.first);
+        writer.write(symbol.second);
+    });
+    writer.writeArray(linkerInput.getDataRelocations(), [&](const LinkerInput::RelocationInfo &relocation) { writeRelocation(writer, relocation); });
+    writer.writeArray(linkerInput.getRelocationsInInstructionSegments(), [&](const LinkerInput::Relocations &relocations) {
+        writer.writeArray(relocations, [&](const LinkerInput::RelocationInfo &relocation) { writeRelocation(writer, relocation); });
+    });
+    writer.writeArray(linkerInput.getKernelDependencies(), [&](const ExternalFunctionUsageKernel &dependency) {
+        writer.writeString(dependency.usedFuncName);
+        writer.writeString(dependency.kernelName);
+    });
+    writer.writeArray(linkerInput.getFunctionDependencies(), [&](const ExternalFunctionUsageExtFunc &dependency) {
+        writer.writeString(dependency.usedFuncName);
+        writer.writeString(dependency.callerFuncName);
+    });
+}
+
+void readLinkerInput(DecodedProgramReader &reader, LinkerInput &linkerInput) {
+    LinkerInput::Traits traits;
+    reader.read(traits.packed);
+    int32_t exportedFunctionsSegmentId = -1;
+    reader.read(exportedFunctionsSegmentId);
+
+    LinkerInput::SymbolMap symbols;
+    for (auto symbolsCount = reader.readCount(); symbolsCount > 0; symbolsCount--) {
+        std::string symbolName;
+        reader.readString(symbolName);
+        reader.read(symbols[symbolName]);
+    }
+    LinkerInput::Relocations dataRelocations;
+    readRelocations(reader, dataRelocations);
+    LinkerInput::RelocationsPerInstSegment textRelocations(reader.readCount());
+    for (auto &relocations : textRelocations) {
+        readRelocations(reader, relocations);
+    }
+    std::vector<ExternalFunctionUsageKernel> kernelDependencies(reader.readCount());
+    for (auto &dependency : kernelDependencies) {
+        reader.readString(dependency.usedFuncName);
+        reader.readString(dependency.kernelName);
+    }
+    std::vector<ExternalFunctionUsageExtFunc> functionDependencies(reader.readCount());
+    for (auto &dependency : functionDependencies) {
+        reader.readString(dependency.usedFuncName);
+        reader.readString(dependency.callerFuncName);
+    }
+
+    linkerInput.restoreDecodedState(traits, std::move(symbols), std::move(dataRelocations), std::move(textRelocations),
+                                    std::move(kernelDependencies), std::move(functionDependencies));
+    linkerInput.setExportedFunctionsSegmentId(exportedFunctionsSegmentId);
+}
+} // namespace
+
+std::string DecodedProgramCache::getCacheKey(ArrayRef<const uint8_t> deviceBinary, uint32_t ipVersion, ConstStringRef driverVersion) {
+    Hash128 hash;
+    hash.update(reinterpret_cast<const char *>(&formatVersion), sizeof(formatVersion));
+    hash.update(reinterpret_cast<const char *>(&layoutFingerprint), sizeof(layoutFingerprint));
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(deviceBinary.begin()), deviceBinary.size());
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(&ipVersion), sizeof(ipVersion));
+    hash.update("----", 4);
+    hash.update(driverVersion.data(), driverVersion.size());
+    hash.update("----", 4);
+
+    // debug flags changing zebin decoding results
+    const int32_t decodingFlags[] = {static_cast<int32_t>(debugManager.flags.ZebinAppendElws.get()),
+                                     static_cast<int32_t>(debugManager.flags.IgnoreZebinUnknownAttributes.get())};
+    hash.update(reinterpret_cast<const char *>(decodingFlags), sizeof(decodingFlags));
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::hex
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low
+           << cacheKeySuffix.data();
+    return stream.str();
+}
+
+/*
+ * Only state fully described by descriptors and offsets into device binary can be stored,
+ * programs with debug data or driver specific descriptor extensions are always decoded.
+ */
+bool DecodedProgramCache::isCacheable(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary) {
+    if (programInfo.linkerInput && (false == programInfo.linkerInput->isValid())) {
+        return false;
+    }
+
+    bool cacheable = isInBinary(programInfo.globalConstants.initData, programInfo.globalConstants.size, deviceBinary);
+    cacheable &= isInBinary(programInfo.globalVariables.initData, programInfo.globalVariables.size, deviceBinary);
+    cacheable &= isInBinary(programInfo.globalStrings.initData, programInfo.globalStrings.size, deviceBinary);
+
+    for (const auto &kernelInfo : programInfo.kernelInfos) {
+        const auto &desc = kernelInfo->kernelDescriptor;
+        cacheable &= isInBinary(kernelInfo->heapInfo.pKernelHeap, kernelInfo->heapInfo.kernelHeapSize, deviceBinary);
+        cacheable &= isInBinary(kernelInfo->igcInfoForGtpin, 0U, deviceBinary);
+        cacheable &= (nullptr == kernelInfo->heapInfo.pGsh);
+        cacheable &= (kernelInfo->heapInfo.pSsh == desc.generatedSsh.data()) && (kernelInfo->heapInfo.pDsh == desc.generatedDsh.data());
+        cacheable &= (nullptr == desc.kernelDescriptorExt);
+        cacheable &= (nullptr == desc.external.debugData) && (nullptr == desc.external.relocatedDebugData) && (nullptr == desc.external.igcInfoForGtpin);
+    }
+    return cacheable;
+}
+
+std::vector<uint8_t> DecodedProgramCache::serialize(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary) {
+    DecodedProgramWriter writer;
+    writer.write(formatVersion);
+    writer.write(layoutFingerprint);
+    writer.write(static_cast<uint64_t>(deviceBinary.size()));
+
+    for (const auto *globalSurface : {&programInfo.globalConstants, &programInfo.globalVariables, &programInfo.globalStrings}) {
+        writer.writeBinaryOffset(globalSurface->initData, deviceBinary);
+        writer.write(static_cast<uint64_t>(globalSurface->size));
+        writer.write(static_cast<uint64_t>(globalSurface->zeroInitSize));
+    }
+    writer.write(static_cast<uint64_t>(programInfo.kernelMiscInfoPos));
+
+    writer.writeArray(programInfo.globalsDeviceToHostNameMap, [&](const auto &names) {
+        writer.writeString(names.first);
+        writer.writeString(names.second);
+    });
+    writer.writeArray(programInfo.externalFunctions, [&](const ExternalFunctionInfo &externalFunction) {
+        writer.writeString(externalFunction.functionName);
+        writer.write(externalFunction.barrierCount);
+        writer.write(externalFunction.numGrfRequired);
+        writer.write(externalFunction.simdSize);
+        writer.write(externalFunction.hasRTCalls);
+    });
+    writer.writeArray(programInfo.kernelInfos, [&](const KernelInfo *kernelInfo) {
+        writeKernelDescriptor(writer, kernelInfo->kernelDescriptor);
+        writer.writeBinaryOffset(kernelInfo->heapInfo.pKernelHeap, deviceBinary);
+        writer.write(kernelInfo->heapInfo.kernelHeapSize);
+        writer.write(kernelInfo->heapInfo.kernelUnpaddedSize);
+        writer.writeBinaryOffset(kernelInfo->igcInfoForGtpin, deviceBinary);
+    });
+
+    writer.write(nullptr != programInfo.linkerInput);
+    if (programInfo.linkerInput) {
+        writeLinkerInput(writer, *programInfo.linkerInput);
+    }
+    return std::move(writer.data);
+}
+
+bool DecodedProgramCache::deserialize(ProgramInfo &dst, ArrayRef<const uint8_t> cachedData, ArrayRef<const uint8_t> deviceBinary) {
+    DEBUG_BREAK_IF(false == dst.kernelInfos.empty());
+    DecodedProgramReader reader(cachedData);
+    uint32_t entryFormatVersion = 0U;
+    uint64_t entryLayoutFingerprint = 0U;
+    uint64_t deviceBinarySize = 0U;
+    reader.read(entryFormatVersion);
+    reader.read(entryLayoutFingerprint);
+    reader.read(deviceBinarySize);
+    if ((formatVersion != entryFormatVersion) || (layoutFingerprint != entryLayoutFingerprint) || (deviceBinary.size() != deviceBinarySize)) {
+        return false;
+    }
+
+    ProgramInfo decoded;
+    for (auto *globalSurface : {&decoded.globalConstants, &decoded.globalVariables, &decoded.globalStrings}) {
+        const void *initData = nullptr;
+        uint64_t size = 0U;
+        uint64_t zeroInitSize = 0U;
+        reader.readBinaryOffset(initData, deviceBinary, 0U);
+        reader.read(size);
+        reader.read(zeroInitSize);
+        if (false == isInBinary(initData, static_cast<size_t>(size), deviceBinary)) {
+            reader.invalidate();
+        }
+        globalSurface->initData = initData;
+        globalSurface->size = static_cast<size_t>(size);
+        globalSurface->zeroInitSize = static_cast<size_t>(zeroInitSize);
+    }
+    uint64_t kernelMiscInfoPos = 0U;
+    reader.read(kernelMiscInfoPos);
+    decoded.kernelMiscInfoPos = static_cast<size_t>(kernelMiscInfoPos);
+
+    for (auto namesCount = reader.readCount(); namesCount > 0; namesCount--) {
+        std::string deviceName;
+        reader.readString(deviceName);
+        reader.readString(decoded.globalsDeviceToHostNameMap[deviceName]);
+    }
+    decoded.externalFunctions.resize(reader.readCount());
+    for (auto &externalFunction : decoded.externalFunctions) {
+        reader.readString(externalFunction.functionName);
+        reader.read(externalFunction.barrierCount);
+        reader.read(externalFunction.numGrfRequired);
+        reader.read(externalFunction.simdSize);
+        reader.read(externalFunction.hasRTCalls);
+    }
+    for (auto kernelsCount = reader.readCount(); kernelsCount > 0; kernelsCount--) {
+        auto kernelInfo = new KernelInfo();
+        decoded.kernelInfos.push_back(kernelInfo);
+
+        readKernelDescriptor(reader, kernelInfo->kernelDescriptor);
+        auto &heapInfo = kernelInfo->heapInfo;
+        const void *kernelHeap = nullptr;
+        reader.readBinaryOffset(kernelHeap, deviceBinary, 0U);
+        reader.read(heapInfo.kernelHeapSize);
+        reader.read(heapInfo.kernelUnpaddedSize);
+        if (false == isInBinary(kernelHeap, heapInfo.kernelHeapSize, deviceBinary)) {
+            reader.invalidate();
+        }
+        heapInfo.pKernelHeap = kernelHeap;
+        reader.readBinaryOffset(kernelInfo->igcInfoForGtpin, deviceBinary, 0U);
+
+        auto &desc = kernelInfo->kernelDescriptor;
+        heapInfo.pSsh = desc.generatedSsh.data();
+        heapInfo.surfaceStateHeapSize = static_cast<uint32_t>(desc.generatedSsh.size());
+        heapInfo.pDsh = desc.generatedDsh.data();
+        heapInfo.dynamicStateHeapSize = static_cast<uint32_t>(desc.generatedDsh.size());
+    }
+
+    bool hasLinkerInput = false;
+    reader.read(hasLinkerInput);
+    if (hasLinkerInput) {
+        decoded.prepareLinkerInputStorage();
+        readLinkerInput(reader, *decoded.linkerInput);
+    }
+
+    if (false == reader.isFullyConsumed()) {
+        return false;
+    }
+    dst = std::move(decoded);
+    return true;
+}
+
+bool DecodedProgramCache::load(CompilerCache &cache, const std::string &cacheKey, ProgramInfo &dst, const SingleDeviceBinary &src) {
+    size_t cachedDataSize = 0U;
+    auto cachedData = cache.loadCachedBinary(cacheKey, cachedDataSize);
+    if (nullptr == cachedData) {
+        return false;
+    }
+    if (false == deserialize(dst, ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(cachedData.get()), cachedDataSize), src.deviceBinary)) {
+        return false;
+    }
+
+    // state not derived from device binary, same as in zebin decoding
+    dst.grfSize = src.targetDevice.grfSize;
+    dst.minScratchSpaceSize = src.targetDevice.minScratchSpaceSize;
+    dst.indirectDetectionVersion = src.generatorFeatureVersions.indirectMemoryAccessDetection;
+    dst.indirectAccessBufferMajorVersion = src.generatorFeatureVersions.indirectAccessBuffer;
+    dst.samplerStateSize = src.targetDevice.samplerStateSize;
+    dst.samplerBorderColorStateSize = src.targetDevice.samplerBorderColorStateSize;
+    for (auto &kernelInfo : dst.kernelInfos) {
+        kernelInfo->kernelDescriptor.kernelMetadata.isGeneratedByIgc = (src.generator == GeneratorType::igc);
+        if (KernelDescriptor::isBindlessAddressingKernel(kernelInfo->kernelDescriptor)) {
+            kernelInfo->kernelDescriptor.initBindlessOffsetToSurfaceState();
+        }
+    }
+    return true;
+}
+
+void DecodedProgramCache::store(CompilerCache &cache, const std::string &cacheKey, const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary) {
+    if (false == isCacheable(programInfo, deviceBinary)) {
+        return;
+    }
+    auto cachedData = serialize(programInfo, deviceBinary);
+    cache.cacheBinary(cacheKey, reinterpret_cast<const char *>(cachedData.data()), cachedData.size());
+}
+
+std::pair<DecodeError, DeviceBinaryFormat> DecodedProgramCache::decodeSingleDeviceBinary(CompilerCache *cache, uint32_t ipVersion, ProgramInfo &dst, const SingleDeviceBinary &src,
+                                                                                         std::string &outErrReason, std::string &outWarning, const GfxCoreHelper &gfxCoreHelper) {
+    bool useCache = (1 == debugManager.flags.EnableDecodedProgramCache.get()) &&
+                    (nullptr != cache) && cache->getConfig().enabled &&
+                    isDeviceBinaryFormat<DeviceBinaryFormat::zebin>(src.deviceBinary);
+    if (false == useCache) {
+        return NEO::decodeSingleDeviceBinary(dst, src, outErrReason, outWarning, gfxCoreHelper);
+    }
+
+    auto cacheKey = getCacheKey(src.deviceBinary, ipVersion, driverVersion);
+    if (load(*cache, cacheKey, dst, src)) {
+        return {DecodeError::success, DeviceBinaryFormat::zebin};
+    }
+
+    auto ret = NEO::decodeSingleDeviceBinary(dst, src, outErrReason, outWarning, gfxCoreHelper);
+    if ((DecodeError::success == ret.first) && (DeviceBinaryFormat::zebin == ret.second)) {
+        store(*cache, cacheKey, dst, src.deviceBinary);
+    }
+    return ret;
+}
+
+} // namespace NEO
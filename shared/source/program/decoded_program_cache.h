@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class CompilerCache;
+class GfxCoreHelper;
+struct ProgramInfo;
+
+/*
+ * Persists results of zebin decoding (kernel descriptors, linker input symbol and relocation tables,
+ * globals layout) in compiler cache, so that loading already seen binary skips zeInfo parsing and
+ * ELF symbol and relocation decoding.
+ * Pointers into device binary are stored as offsets, device binary is still needed on load.
+ * Entries are keyed by device binary hash, IP version, driver version, layout fingerprint of raw stored
+ * descriptors and debug flags affecting decoding, so entries are never shared between incompatible driver builds.
+ */
+class DecodedProgramCache {
+  public:
+    static constexpr uint32_t formatVersion = 2;
+    static constexpr ConstStringRef cacheKeySuffix = "_decoded";
+
+    static std::string getCacheKey(ArrayRef<const uint8_t> deviceBinary, uint32_t ipVersion, ConstStringRef driverVersion);
+    static bool isCacheable(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary);
+    static std::vector<uint8_t> serialize(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary);
+    static bool deserialize(ProgramInfo &dst, ArrayRef<const uint8_t> cachedData, ArrayRef<const uint8_t> deviceBinary);
+
+    static bool load(CompilerCache &cache, const std::string &cacheKey, ProgramInfo &dst, const SingleDeviceBinary &src);
+    static void store(CompilerCache &cache, const std::string &cacheKey, const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary);
+
+    // Same as decodeSingleDeviceBinary, but zebin decode results are looked up in and stored to cache when enabled
+    static std::pair<DecodeError, DeviceBinaryFormat> decodeSingleDeviceBinary(CompilerCache *cache, uint32_t ipVersion, ProgramInfo &dst, const SingleDeviceBinary &src,
+                                                                                std::string &outErrReason, std::string &outWarning, const GfxCoreHelper &gfxCoreHelper);
+};
+
+} // namespace NEO
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/isa_upload_batcher.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/product_helper.h"
+
+namespace NEO {
+
+IsaUploadBatcher::IsaUploadBatcher(const Device &device) : device(device) {
+    batchingEnabled = debugManager.flags.EnableBatchedIsaUpload.get() != 0;
+}
+
+void IsaUploadBatcher::add(GraphicsAllocation *allocation, size_t offset, const void *isa, size_t isaSize) {
+    const auto &productHelper = device.getProductHelper();
+    const bool useBlitter = productHelper.isBlitCopyRequiredForLocalMemory(device.getRootDeviceEnvironment(), *allocation);
+    if (!batchingEnabled || !useBlitter) {
+        immediateTransfersSucceeded &= MemoryTransferHelper::transferMemoryToAllocation(useBlitter, device, allocation, offset, isa, isaSize);
+        return;
+    }
+
+    if (!transfers.empty()) {
+        auto &last = transfers.back();
+        auto lastEnd = last.offset + last.size;
+        if (last.memory == allocation && offset >= lastEnd) {
+            auto gapSize = offset - lastEnd;
+            auto stagingOffset = stagingBuffer.size() + gapSize;
+            stagingBuffer.resize(stagingOffset + isaSize);
+            memcpy_s(stagingBuffer.data() + stagingOffset, isaSize, isa, isaSize);
+            last.size += gapSize + isaSize;
+            return;
+        }
+    }
+
+    auto stagingOffset = alignUp(stagingBuffer.size(), MemoryConstants::cacheLineSize);
+    stagingBuffer.resize(stagingOffset + isaSize);
+    memcpy_s(stagingBuffer.data() + stagingOffset, isaSize, isa, isaSize);
+    transfers.push_back({allocation, offset, stagingOffset, isaSize});
+}
+
+bool IsaUploadBatcher::upload() {
+    bool success = immediateTransfersSucceeded;
+    immediateTransfersSucceeded = true;
+    if (transfers.empty()) {
+        return success;
+    }
+
+    auto blitResult = BlitHelperFunctions::blitMemoryToAllocations(device, stagingBuffer.data(), stagingBuffer.size(), transfers);
+    if (blitResult != BlitOperationResult::success) {
+        for (const auto &transfer : transfers) {
+            success &= device.getMemoryManager()->copyMemoryToAllocation(transfer.memory, transfer.offset, stagingBuffer.data() + transfer.hostPtrOffset, transfer.size);
+        }
+    }
+
+    transfers.clear();
+    stagingBuffer.clear();
+    return success;
+}
+
+} // namespace NEO
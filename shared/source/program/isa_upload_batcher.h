@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/blit_helper.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace NEO {
+class Device;
+class GraphicsAllocation;
+
+/*
+ * Uploads ISA of all kernels of a program or module together.
+ * ISA going through blitter is staged in single host buffer and submitted once per upload instead of once per kernel.
+ * Consecutive ranges of the same allocation are merged into one transfer, gaps between them are zero filled,
+ * so only ranges owned by the caller may be added.
+ * ISA of allocations accessible by CPU is copied immediately, as staging would only add a copy.
+ */
+class IsaUploadBatcher : NonCopyableAndNonMovableClass {
+  public:
+    IsaUploadBatcher(const Device &device);
+
+    void add(GraphicsAllocation *allocation, size_t offset, const void *isa, size_t isaSize);
+    bool upload();
+
+    size_t getPendingTransfersCount() const {
+        return transfers.size();
+    }
+
+  protected:
+    const Device &device;
+    std::vector<std::byte> stagingBuffer;
+    BlitMemoryToAllocationEntries transfers;
+    bool batchingEnabled = true;
+    bool immediateTransfersSucceeded = true;
+};
+
+} // namespace NEO
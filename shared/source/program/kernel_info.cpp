@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/program/isa_upload_batcher.h"
 
 #include <cstdint>
 #include <unordered_map>
@@ -55,9 +56,24 @@ int32_t KernelInfo::getArgNumByName(const char *name) const {
     return -1;
 }
 
-bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa) {
+/*
+ * When batcher is passed, ISA is only queued and is written to allocation by IsaUploadBatcher::upload.
+ */
+bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa, IsaUploadBatcher *isaUploadBatcher) {
     UNRECOVERABLE_IF(kernelAllocation);
     auto kernelIsaSize = heapInfo.kernelHeapSize;
+    auto transferIsa = [&]() {
+        if (isaUploadBatcher) {
+            isaUploadBatcher->add(kernelAllocation, 0, heapInfo.pKernelHeap, static_cast<size_t>(kernelIsaSize));
+            return true;
+        }
+        auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
+        auto &productHelper = device.getProductHelper();
+
+        return MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelAllocation),
+                                                                device, kernelAllocation, 0, heapInfo.pKernelHeap,
+                                                                static_cast<size_t>(kernelIsaSize));
+    };
     const auto allocType = internalIsa ? AllocationType::kernelIsaInternal : AllocationType::kernelIsa;
 
     AllocationProperties properties = {device.getRootDeviceIndex(), kernelIsaSize, allocType, device.getDeviceBitfield()};
@@ -74,12 +90,7 @@ bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa)
         if (kernelAllocations != storedAllocations.end()) {
             kernelAllocation = kernelAllocations->second.kernelAllocation;
             kernelAllocations->second.reuseCounter++;
-            auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
-            auto &productHelper = device.getProductHelper();
-
-            return MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelAllocation),
-                                                                    device, kernelAllocation, 0, heapInfo.pKernelHeap,
-                                                                    static_cast<size_t>(kernelIsaSize));
+            return transferIsa();
         } else {
             kernelAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
             storedAllocations.insert(std::make_pair(kernelName, MemoryManager::KernelAllocationInfo(kernelAllocation, 1u)));
@@ -92,12 +103,7 @@ bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa)
         return false;
     }
 
-    auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
-    auto &productHelper = device.getProductHelper();
-
-    return MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelAllocation),
-                                                            device, kernelAllocation, 0, heapInfo.pKernelHeap,
-                                                            static_cast<size_t>(kernelIsaSize));
+    return transferIsa();
 }
 
 void KernelInfo::apply(const DeviceInfoKernelPayloadConstants &constants) {
@@ -29,6 +29,7 @@ struct KernelInfo;
 class DispatchInfo;
 struct KernelArgumentType;
 class GraphicsAllocation;
+class IsaUploadBatcher;
 class MemoryManager;
 
 static const float yTilingRatioValue = 1.3862943611198906188344642429164f;
@@ -80,7 +81,7 @@ struct KernelInfo : NEO::NonCopyableAndNonMovableClass {
     uint32_t getConstantBufferSize() const;
     int32_t getArgNumByName(const char *name) const;
 
-    bool createKernelAllocation(const Device &device, bool internalIsa);
+    bool createKernelAllocation(const Device &device, bool internalIsa, IsaUploadBatcher *isaUploadBatcher = nullptr);
     void apply(const DeviceInfoKernelPayloadConstants &constants);
 
     HeapInfo heapInfo = {};
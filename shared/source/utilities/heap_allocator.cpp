@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/utilities/heap_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/logger.h"
 
@@ -40,13 +41,23 @@ uint64_t HeapAllocator::allocateWithCustomAlignmentWithStartAddressHint(const ui
 
             const uint64_t misalignment = requiredStartAddress - pLeftBound;
             if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
-                if (misalignment) {
-                    storeInFreedChunks(pLeftBound, static_cast<size_t>(misalignment), freedChunksBig);
-                    pLeftBound += misalignment;
-                }
+                const uint64_t misalignedChunkStart = pLeftBound;
+                pLeftBound += misalignment;
                 ptrReturn = pLeftBound;
                 pLeftBound += sizeToAllocate;
                 availableSize -= sizeToAllocate;
+                if (misalignment) {
+                    if (useFreeRangeIndex) {
+                        insertFreeRange(misalignedChunkStart, static_cast<size_t>(misalignment));
+                    } else {
+                        storeInFreedChunks(misalignedChunkStart, static_cast<size_t>(misalignment), freedChunksBig);
+                    }
+                }
+            }
+        } else if (useFreeRangeIndex) {
+            ptrReturn = getFromFreeRangeIndexWithStartAddressHint(requiredStartAddress, sizeToAllocate);
+            if (ptrReturn != 0llu) {
+                availableSize -= sizeToAllocate;
             }
         } else { // Try to find in freed chunks
 
@@ -88,6 +99,10 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
         return 0llu;
     }
 
+    if (useFreeRangeIndex) {
+        return allocateWithFreeRangeIndex(sizeToAllocate, alignment);
+    }
+
     std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
     uint32_t defragmentCount = 0;
 
@@ -151,6 +166,12 @@ void HeapAllocator::free(uint64_t ptr, size_t size) {
     std::lock_guard<std::mutex> lock(mtx);
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 
+    if (useFreeRangeIndex) {
+        insertFreeRange(ptr, size);
+        availableSize += size;
+        return;
+    }
+
     if (ptr == pRightBound) {
         pRightBound = ptr + size;
         mergeLastFreedSmall();
@@ -299,4 +320,129 @@ void HeapAllocator::defragment() {
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 }
 
+void HeapAllocator::initFreeRangeIndex() {
+    if (debugManager.flags.EnableHeapAllocatorFreeRangeIndex.get() != -1) {
+        useFreeRangeIndex = !!debugManager.flags.EnableHeapAllocatorFreeRangeIndex.get();
+    }
+}
+
+uint64_t HeapAllocator::allocateWithFreeRangeIndex(size_t &sizeToAllocate, size_t alignment) {
+    const bool allocateFromLeftBound = sizeToAllocate > sizeThreshold;
+
+    for (;;) {
+        uint64_t ptrReturn = getFromFreeRangeIndex(sizeToAllocate, alignment, !allocateFromLeftBound);
+
+        if (ptrReturn == 0llu && allocateFromLeftBound) {
+            const uint64_t misalignment = alignUp(pLeftBound, alignment) - pLeftBound;
+            if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
+                const uint64_t misalignedChunkStart = pLeftBound;
+                pLeftBound += misalignment;
+                ptrReturn = pLeftBound;
+                pLeftBound += sizeToAllocate;
+                if (misalignment) {
+                    insertFreeRange(misalignedChunkStart, static_cast<size_t>(misalignment));
+                }
+            }
+        } else if (ptrReturn == 0llu) {
+            const uint64_t pStart = pRightBound - sizeToAllocate;
+            const uint64_t misalignment = pStart - alignDown(pStart, alignment);
+            if (pLeftBound + sizeToAllocate + misalignment <= pRightBound) {
+                pRightBound -= misalignment;
+                const uint64_t misalignedChunkStart = pRightBound;
+                pRightBound -= sizeToAllocate;
+                ptrReturn = pRightBound;
+                if (misalignment) {
+                    insertFreeRange(misalignedChunkStart, static_cast<size_t>(misalignment));
+                }
+            }
+        }
+
+        if (ptrReturn != 0llu) {
+            availableSize -= sizeToAllocate;
+            UNRECOVERABLE_IF(!isAligned(ptrReturn, alignment));
+            return ptrReturn;
+        }
+
+        if (alignment > 2 * MemoryConstants::megaByte && pRightBound - pLeftBound >= sizeToAllocate) {
+            alignment = Math::prevPowerOfTwo(static_cast<size_t>(pRightBound - pLeftBound - 1 - sizeToAllocate + 2 * MemoryConstants::pageSize64k));
+        } else {
+            return 0llu;
+        }
+    }
+}
+
+uint64_t HeapAllocator::getFromFreeRangeIndex(size_t size, size_t requiredAlignment, bool placeAtRangeEnd) {
+    // Ranges are visited from the smallest one that can hold the size; any range of at least
+    // size + requiredAlignment - allocationAlignment fits regardless of its start, which bounds the scan.
+    for (auto it = freeRangesBySize.lower_bound({size, 0llu}); it != freeRangesBySize.end(); ++it) {
+        const uint64_t rangeStart = it->second;
+        const uint64_t rangeEnd = rangeStart + it->first;
+        const uint64_t ptr = placeAtRangeEnd ? alignDown(rangeEnd - size, requiredAlignment) : alignUp(rangeStart, requiredAlignment);
+        if (ptr < rangeStart || ptr + size > rangeEnd) {
+            continue;
+        }
+
+        freeRangesByAddress.erase(rangeStart);
+        freeRangesBySize.erase(it);
+        if (ptr > rangeStart) {
+            addFreeRange(rangeStart, static_cast<size_t>(ptr - rangeStart));
+        }
+        if (ptr + size < rangeEnd) {
+            addFreeRange(ptr + size, static_cast<size_t>(rangeEnd - ptr - size));
+        }
+        return ptr;
+    }
+    return 0llu;
+}
+
+uint64_t HeapAllocator::getFromFreeRangeIndexWithStartAddressHint(const uint64_t requiredStartAddress, size_t size) {
+    auto it = freeRangesByAddress.upper_bound(requiredStartAddress);
+    if (it == freeRangesByAddress.begin()) {
+        return 0llu;
+    }
+    --it;
+
+    const uint64_t rangeStart = it->first;
+    const uint64_t rangeEnd = rangeStart + it->second;
+    if (requiredStartAddress + size > rangeEnd) {
+        return 0llu;
+    }
+
+    removeFreeRange(it);
+    if (requiredStartAddress > rangeStart) {
+        addFreeRange(rangeStart, static_cast<size_t>(requiredStartAddress - rangeStart));
+    }
+    if (requiredStartAddress + size < rangeEnd) {
+        addFreeRange(requiredStartAddress + size, static_cast<size_t>(rangeEnd - requiredStartAddress - size));
+    }
+    return requiredStartAddress;
+}
+
+void HeapAllocator::insertFreeRange(uint64_t ptr, size_t size) {
+    uint64_t rangeStart = ptr;
+    uint64_t rangeEnd = ptr + size;
+
+    auto next = freeRangesByAddress.lower_bound(rangeStart);
+    if (next != freeRangesByAddress.end() && next->first == rangeEnd) {
+        rangeEnd += next->second;
+        auto toRemove = next++;
+        removeFreeRange(toRemove);
+    }
+    if (next != freeRangesByAddress.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == rangeStart) {
+            rangeStart = prev->first;
+            removeFreeRange(prev);
+        }
+    }
+
+    if (rangeEnd == pLeftBound) {
+        pLeftBound = rangeStart;
+    } else if (rangeStart == pRightBound) {
+        pRightBound = rangeEnd;
+    } else {
+        addFreeRange(rangeStart, static_cast<size_t>(rangeEnd - rangeStart));
+    }
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,10 @@
 #include "shared/source/helpers/constants.h"
 
 #include <cstdint>
+#include <map>
 #include <mutex>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace NEO {
@@ -36,6 +39,7 @@ class HeapAllocator {
         pRightBound = address + size;
         freedChunksBig.reserve(10);
         freedChunksSmall.reserve(50);
+        initFreeRangeIndex();
     }
 
     MOCKABLE_VIRTUAL ~HeapAllocator() = default;
@@ -84,6 +88,26 @@ class HeapAllocator {
     std::vector<HeapChunk> freedChunksBig;
     std::mutex mtx;
 
+    // Free range index used instead of freedChunks vectors when enabled.
+    // Ranges are kept fully coalesced, ranges adjacent to pLeftBound/pRightBound are merged back into bounds.
+    bool useFreeRangeIndex = false;
+    std::map<uint64_t, size_t> freeRangesByAddress;
+    std::set<std::pair<size_t, uint64_t>> freeRangesBySize;
+
+    void initFreeRangeIndex();
+    uint64_t allocateWithFreeRangeIndex(size_t &sizeToAllocate, size_t alignment);
+    uint64_t getFromFreeRangeIndex(size_t size, size_t requiredAlignment, bool placeAtRangeEnd);
+    uint64_t getFromFreeRangeIndexWithStartAddressHint(const uint64_t requiredStartAddress, size_t size);
+    void insertFreeRange(uint64_t ptr, size_t size);
+    void addFreeRange(uint64_t ptr, size_t size) {
+        freeRangesByAddress.emplace(ptr, size);
+        freeRangesBySize.emplace(size, ptr);
+    }
+    void removeFreeRange(std::map<uint64_t, size_t>::iterator it) {
+        freeRangesBySize.erase({it->second, it->first});
+        freeRangesByAddress.erase(it);
+    }
+
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
     MOCKABLE_VIRTUAL uint64_t getFromFreedChunksWithStartAddressHint(const uint64_t requiredStartAddress, size_t size, std::vector<HeapChunk> &freedChunks);
 
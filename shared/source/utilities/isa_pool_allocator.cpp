@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/utilities/isa_pool_allocator.h"
 
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
@@ -63,7 +64,8 @@ ISAPoolAllocator::ISAPoolAllocator(Device *device) : device(device) {
 /**
  * @brief This method allocates SharedIsaAllocation object for a single user (module or program).
  * In first step, it checks if requested size for the ISA is higher than default pool size
- * and creates new ISA pool if it is.
+ * and creates new ISA pool if it is. Such pool is rounded up to multiple of default pool size,
+ * so the remaining space is shared with subsequent requests.
  * Next, it tries to allocate using existing pools.
  * If failed, all existing pools are drained and performs allocation again.
  * If failed, creates another ISA pool and tries to allocate again.
@@ -79,7 +81,7 @@ SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBu
     auto maxAllocationSize = getAllocationSize(isBuiltin);
 
     if (sizeWithPadding > maxAllocationSize) {
-        addNewBufferPool(ISAPool(device, isBuiltin, sizeWithPadding));
+        addNewBufferPool(ISAPool(device, isBuiltin, alignUp(sizeWithPadding, maxAllocationSize)));
     }
 
     auto sharedIsaAllocation = tryAllocateISA(isBuiltin, sizeWithPadding);
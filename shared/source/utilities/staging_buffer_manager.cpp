@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,8 +16,11 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <thread>
+
 namespace NEO {
 
 StagingBuffer::StagingBuffer(void *baseAddress, size_t size) : baseAddress(baseAddress) {
@@ -36,12 +39,98 @@ void StagingBufferTracker::freeChunk() const {
     allocator->free(chunkAddress, size);
 }
 
+StagingBufferCopyWorkers::StagingBufferCopyWorkers(uint32_t threadsCount) : threadsCount(threadsCount) {
+    for (auto i = 1u; i < threadsCount; i++) {
+        workers.push_back(Thread::createFunc(workerLoop, this));
+    }
+}
+
+StagingBufferCopyWorkers::~StagingBufferCopyWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        active = false;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+void *StagingBufferCopyWorkers::workerLoop(void *arg) {
+    auto self = reinterpret_cast<StagingBufferCopyWorkers *>(arg);
+    while (true) {
+        CopyPart part{};
+        {
+            std::unique_lock<std::mutex> lock(self->mtx);
+            self->condition.wait(lock, [self] { return !self->active || !self->queuedParts.empty(); });
+            if (self->queuedParts.empty()) {
+                return nullptr;
+            }
+            part = self->queuedParts.front();
+            self->queuedParts.pop_front();
+        }
+        runPart(part);
+    }
+}
+
+bool StagingBufferCopyWorkers::tryRunQueuedPart() {
+    CopyPart part{};
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (queuedParts.empty()) {
+            return false;
+        }
+        part = queuedParts.front();
+        queuedParts.pop_front();
+    }
+    runPart(part);
+    return true;
+}
+
+void StagingBufferCopyWorkers::runPart(const CopyPart &part) {
+    memcpy(part.dst, part.src, part.size);
+    part.pendingParts->fetch_sub(1, std::memory_order_release);
+}
+
+/*
+ * Parts are aligned to cacheline, first part is copied by calling thread.
+ * While waiting for workers, calling thread helps with any queued part, including parts of concurrent copies.
+ */
+void StagingBufferCopyWorkers::copy(void *dst, const void *src, size_t size) {
+    auto partsCount = std::min(static_cast<size_t>(threadsCount), size / minPartSize);
+    if (partsCount <= 1) {
+        memcpy(dst, src, size);
+        return;
+    }
+    auto partSize = alignUp(size / partsCount, MemoryConstants::cacheLineSize);
+    std::atomic<uint32_t> pendingParts{0};
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (auto offset = partSize; offset < size; offset += partSize) {
+            pendingParts++;
+            queuedParts.push_back({ptrOffset(dst, offset), ptrOffset(src, offset), std::min(partSize, size - offset), &pendingParts});
+        }
+    }
+    condition.notify_all();
+
+    memcpy(dst, src, partSize);
+    while (pendingParts.load(std::memory_order_acquire) != 0) {
+        if (!tryRunQueuedPart()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
 StagingBufferManager::StagingBufferManager(SVMAllocsManager *svmAllocsManager, const RootDeviceIndicesContainer &rootDeviceIndices, const std::map<uint32_t, DeviceBitfield> &deviceBitfields, bool requiresWritable)
     : svmAllocsManager(svmAllocsManager), rootDeviceIndices(rootDeviceIndices), deviceBitfields(deviceBitfields), requiresWritable(requiresWritable) {
     chunkSize = getDefaultStagingBufferSize();
     if (debugManager.flags.StagingBufferSize.get() != -1) {
         chunkSize = debugManager.flags.StagingBufferSize.get() * MemoryConstants::kiloByte;
     }
+    if (debugManager.flags.StagingBufferCopyThreads.get() > 1) {
+        copyWorkers = std::make_unique<StagingBufferCopyWorkers>(static_cast<uint32_t>(debugManager.flags.StagingBufferCopyThreads.get()));
+    }
 }
 
 StagingBufferManager::~StagingBufferManager() {
@@ -74,7 +163,7 @@ StagingTransferStatus StagingBufferManager::performChunkTransfer(size_t chunkTra
 
     auto stagingBuffer = addrToPtr(tracker.chunkAddress);
     if (!isRead) {
-        memcpy(stagingBuffer, userData.ptr, userData.size);
+        copyChunkData(stagingBuffer, userData.ptr, userData.size);
     }
 
     result.chunkCopyStatus = func(stagingBuffer, args...);
@@ -282,7 +371,7 @@ void StagingBufferManager::copyImageToHost(void *dst, const void *stagingBuffer,
             }
         }
     } else {
-        memcpy(dst, stagingBuffer, size);
+        copyChunkData(dst, stagingBuffer, size);
     }
 }
 
@@ -306,10 +395,18 @@ WaitStatus StagingBufferManager::copyStagingToHost(const std::pair<UserData, Sta
         return WaitStatus::ready;
     }
 
-    memcpy(userDst, stagingBuffer, userData.size);
+    copyChunkData(userDst, stagingBuffer, userData.size);
     return WaitStatus::ready;
 }
 
+void StagingBufferManager::copyChunkData(void *dst, const void *src, size_t size) const {
+    if (copyWorkers) {
+        copyWorkers->copy(dst, src, size);
+        return;
+    }
+    memcpy(dst, src, size);
+}
+
 /*
  * Waits for all pending transfers to finish.
  * Releases staging buffers back to pool for reuse.
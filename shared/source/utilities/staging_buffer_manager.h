@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,9 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
@@ -24,6 +27,7 @@ class SVMAllocsManager;
 class CommandStreamReceiver;
 class Device;
 class HeapAllocator;
+class Thread;
 
 using ChunkCopyFunction = std::function<int32_t(void *, void *, size_t)>;
 using ChunkTransferImageFunc = std::function<int32_t(void *, const size_t *, const size_t *)>;
@@ -81,6 +85,44 @@ struct StagingTransferStatus {
     WaitStatus waitStatus = WaitStatus::ready;
 };
 
+/*
+ * Splits large host <-> staging memcpy into parts executed by persistent worker threads.
+ * Calling thread takes part in the copy and returns once all parts are completed.
+ */
+class StagingBufferCopyWorkers : NEO::NonCopyableAndNonMovableClass {
+  public:
+    StagingBufferCopyWorkers(uint32_t threadsCount);
+    ~StagingBufferCopyWorkers();
+
+    void copy(void *dst, const void *src, size_t size);
+
+    uint32_t getThreadsCount() const {
+        return threadsCount;
+    }
+
+  protected:
+    struct CopyPart {
+        void *dst = nullptr;
+        const void *src = nullptr;
+        size_t size = 0;
+        std::atomic<uint32_t> *pendingParts = nullptr;
+    };
+
+    static void *workerLoop(void *arg);
+    bool tryRunQueuedPart();
+    static void runPart(const CopyPart &part);
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::deque<CopyPart> queuedParts;
+    std::mutex mtx;
+    std::condition_variable condition;
+    const uint32_t threadsCount;
+    size_t minPartSize = MemoryConstants::pageSize64k;
+    bool active = true;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<StagingBufferCopyWorkers>);
+
 constexpr size_t maxInFlightReads = 2u;
 using StagingQueue = StackVec<std::pair<UserData, StagingBufferTracker>, maxInFlightReads>;
 
@@ -102,6 +144,9 @@ class StagingBufferManager : NEO::NonCopyableAndNonMovableClass {
     bool registerHostPtr(const void *ptr);
     void resetDetectedPtrs();
 
+  protected:
+    std::unique_ptr<StagingBufferCopyWorkers> copyWorkers;
+
   private:
     std::pair<HeapAllocator *, uint64_t> getExistingBuffer(size_t &size);
     void *allocateStagingBuffer(size_t size);
@@ -118,6 +163,7 @@ class StagingBufferManager : NEO::NonCopyableAndNonMovableClass {
     void copyImageToHost(void *dst, const void *stagingBuffer, size_t size, const ImageMetadata &imageData) const;
 
     bool isValidForStaging(const Device &device, const void *ptr, size_t size, bool hasDependencies);
+    void copyChunkData(void *dst, const void *src, size_t size) const;
 
     size_t chunkSize = 0;
     std::mutex mtx;
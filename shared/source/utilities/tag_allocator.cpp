@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/utilities/tag_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
@@ -17,6 +18,10 @@ TagAllocatorBase::TagAllocatorBase(const RootDeviceIndicesContainer &rootDeviceI
 
     this->tagSize = alignUp(tagSize, tagAlignment);
     maxRootDeviceIndex = *std::max_element(std::begin(rootDeviceIndices), std::end(rootDeviceIndices));
+
+    if (debugManager.flags.TagAllocatorMagazineSize.get() > 0) {
+        magazineSize = static_cast<size_t>(debugManager.flags.TagAllocatorMagazineSize.get());
+    }
 }
 
 void TagAllocatorBase::cleanUpResources() {
@@ -29,6 +34,12 @@ void TagAllocatorBase::cleanUpResources() {
     gfxAllocations.clear();
 }
 
+uint32_t TagAllocatorBase::getMagazineIndexForCurrentThread() {
+    static std::atomic<uint32_t> threadsCount{0};
+    thread_local uint32_t magazineIndex = threadsCount.fetch_add(1u, std::memory_order_relaxed) % magazinesCount;
+    return magazineIndex;
+}
+
 MultiGraphicsAllocation *TagNodeBase::getBaseGraphicsAllocation() const {
     return gfxAllocation;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/spinlock.h"
 
 #include "metrics_library_api_1_0.h"
 
@@ -93,6 +94,7 @@ class TagNodeBase : public NonCopyableAndNonMovableClass {
     uint64_t gpuAddress = 0;
     std::atomic<uint32_t> refCount{0};
     uint32_t packetsUsed = 1;
+    uint32_t magazineIndex = 0;
     bool doNotReleaseNodes = false;
     bool profilingCapable = true;
 
@@ -153,6 +155,12 @@ class TagAllocatorBase {
 
     const std::vector<std::unique_ptr<MultiGraphicsAllocation>> &getGfxAllocations() const { return gfxAllocations; }
 
+    uint64_t getMagazineHitsCount() const { return magazineHitsCount.load(std::memory_order_relaxed); }
+    uint64_t getMagazineMissesCount() const { return magazineMissesCount.load(std::memory_order_relaxed); }
+    uint64_t getCrossThreadReturnsCount() const { return crossThreadReturnsCount.load(std::memory_order_relaxed); }
+
+    static constexpr uint32_t magazinesCount = 16u;
+
   protected:
     TagAllocatorBase() = delete;
 
@@ -168,6 +176,8 @@ class TagAllocatorBase {
 
     void cleanUpResources();
 
+    static uint32_t getMagazineIndexForCurrentThread();
+
     std::vector<std::unique_ptr<MultiGraphicsAllocation>> gfxAllocations;
     const DeviceBitfield deviceBitfield;
     RootDeviceIndicesContainer rootDeviceIndices;
@@ -175,9 +185,14 @@ class TagAllocatorBase {
     MemoryManager *memoryManager;
     size_t tagCount;
     size_t tagSize;
+    size_t magazineSize = 0;
     bool doNotReleaseNodes = false;
 
     std::mutex allocatorMutex;
+
+    std::atomic<uint64_t> magazineHitsCount{0};
+    std::atomic<uint64_t> magazineMissesCount{0};
+    std::atomic<uint64_t> crossThreadReturnsCount{0};
 };
 
 template <typename TagType>
@@ -205,11 +220,27 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
+    NodeType *getTagFromFreePool();
+
+    NodeType *getTagFromMagazine();
+
+    void takeFreeTagsBatch(IDList<NodeType, false> &batch, size_t maxCount);
+
+    void returnTagToMagazine(NodeType *node);
+
+    // Small per-thread cache of free nodes, refilled from and drained to freeTags in bounded batches
+    struct Magazine {
+        SpinLock mtx;
+        IDList<NodeType, false> nodes;
+        size_t nodesCount = 0;
+    };
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
+    std::unique_ptr<Magazine[]> magazines;
 
     const ValueT initialValue;
     bool initializeTags = true;
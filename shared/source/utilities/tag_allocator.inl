@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2025 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,11 +17,37 @@ TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDevice
                                     size_t tagSize, ValueT initialValue, bool doNotReleaseNodes, bool initializeTags, DeviceBitfield deviceBitfield)
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield), initialValue(initialValue), initializeTags(initializeTags) {
 
+    if (magazineSize > 0) {
+        magazines = std::make_unique<Magazine[]>(magazinesCount);
+    }
+
     populateFreeTags();
 }
 
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
+    NodeType *node = nullptr;
+    if (magazines) {
+        node = getTagFromMagazine();
+    } else {
+        node = getTagFromFreePool();
+        usedTags.pushFrontOne(*node);
+    }
+    node->incRefCount();
+
+    if (initializeTags) {
+        node->initialize();
+    }
+
+    if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
+        printf("\nPID: %u, TSP taken from pool and initialized(%d): 0x%" PRIX64, SysCalls::getProcessId(), initializeTags, node->getGpuAddress());
+    }
+
+    return node;
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getTagFromFreePool() {
     if (freeTags.peekIsEmpty()) {
         releaseDeferredTags();
     }
@@ -31,39 +57,128 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
         populateFreeTags();
         node = freeTags.removeFrontOne().release();
     }
-    usedTags.pushFrontOne(*node);
-    node->incRefCount();
+    return node;
+}
 
-    if (initializeTags) {
-        node->initialize();
-    }
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getTagFromMagazine() {
+    auto magazineIndex = getMagazineIndexForCurrentThread();
+    auto &magazine = magazines[magazineIndex];
+    std::unique_lock<SpinLock> lock(magazine.mtx);
+
+    NodeType *node = nullptr;
+    if (magazine.nodesCount > 0) {
+        magazineHitsCount.fetch_add(1u, std::memory_order_relaxed);
+        node = magazine.nodes.removeFrontOne().release();
+        magazine.nodesCount--;
+    } else {
+        magazineMissesCount.fetch_add(1u, std::memory_order_relaxed);
+        lock.unlock();
+
+        IDList<NodeType, false> refillNodes;
+        takeFreeTagsBatch(refillNodes, std::max(magazineSize / 2, static_cast<size_t>(1u)));
+        node = refillNodes.removeFrontOne().release();
+
+        lock.lock();
+        while (magazine.nodesCount < magazineSize) {
+            auto refillNode = refillNodes.removeFrontOne().release();
+            if (refillNode == nullptr) {
+                break;
+            }
+            magazine.nodes.pushTailOne(*refillNode);
+            magazine.nodesCount++;
+        }
+        lock.unlock();
 
-    if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
-        printf("\nPID: %u, TSP taken from pool and initialized(%d): 0x%" PRIX64, SysCalls::getProcessId(), initializeTags, node->getGpuAddress());
+        if (!refillNodes.peekIsEmpty()) {
+            freeTags.splice(*refillNodes.detachNodes());
+        }
     }
 
+    node->magazineIndex = magazineIndex;
     return node;
 }
 
+/*
+ * Takes up to maxCount nodes one by one, so other threads refilling their magazines still find free nodes.
+ * A new pool is allocated only when no free node is left after releasing deferred tags under allocatorMutex.
+ */
+template <typename TagType>
+void TagAllocator<TagType>::takeFreeTagsBatch(IDList<NodeType, false> &batch, size_t maxCount) {
+    size_t nodesCount = 0;
+    while (nodesCount < maxCount) {
+        auto node = freeTags.removeFrontOne().release();
+        if (node == nullptr) {
+            if (nodesCount > 0) {
+                break;
+            }
+            releaseDeferredTags();
+            node = freeTags.removeFrontOne().release();
+        }
+        if (node == nullptr) {
+            std::unique_lock<std::mutex> allocatorLock(allocatorMutex);
+            releaseDeferredTags();
+            if (freeTags.peekIsEmpty()) {
+                populateFreeTags();
+            }
+            continue;
+        }
+        batch.pushTailOne(*node);
+        nodesCount++;
+    }
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::returnTagToMagazine(NodeType *node) {
+    auto magazineIndex = getMagazineIndexForCurrentThread();
+    if (node->magazineIndex != magazineIndex) {
+        crossThreadReturnsCount.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    auto &magazine = magazines[magazineIndex];
+    std::unique_lock<SpinLock> lock(magazine.mtx);
+    magazine.nodes.pushFrontOne(*node);
+    magazine.nodesCount++;
+
+    if (magazine.nodesCount > magazineSize) {
+        IDList<NodeType, false> drainedNodes;
+        while (magazine.nodesCount > magazineSize / 2) {
+            auto drainedNode = magazine.nodes.peekTail();
+            magazine.nodes.removeOne(*drainedNode).release();
+            drainedNodes.pushFrontOne(*drainedNode);
+            magazine.nodesCount--;
+        }
+        freeTags.splice(*drainedNodes.detachNodes());
+    }
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
 
     if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
         printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
     }
 
+    if (magazines) {
+        returnTagToMagazine(nodeT);
+        return;
+    }
+
+    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+    DEBUG_BREAK_IF(usedNode == nullptr);
+
     freeTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(!usedNode);
-    deferredTags.pushFrontOne(*usedNode);
+    if (!magazines) {
+        [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+        DEBUG_BREAK_IF(!usedNode);
+    }
+    deferredTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
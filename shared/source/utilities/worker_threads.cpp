@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_threads.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+void *workerThreadEntry(void *arg) {
+    auto &func = *reinterpret_cast<const std::function<void()> *>(arg);
+    func();
+    return nullptr;
+}
+} // namespace
+
+uint32_t getWorkerThreadsCount(size_t requestedThreadsCount) {
+    return static_cast<uint32_t>(std::clamp(requestedThreadsCount, static_cast<size_t>(1u), static_cast<size_t>(maxWorkerThreadsCount)));
+}
+
+void runOnWorkerThreads(size_t requestedThreadsCount, const std::function<void()> &func) {
+    auto threadsCount = getWorkerThreadsCount(requestedThreadsCount);
+    std::vector<std::unique_ptr<Thread>> workers;
+    workers.reserve(threadsCount - 1);
+    for (auto i = 1u; i < threadsCount; i++) {
+        workers.push_back(Thread::createFunc(workerThreadEntry, const_cast<std::function<void()> *>(&func)));
+    }
+    func();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace NEO {
+
+inline constexpr uint32_t maxWorkerThreadsCount = 16u;
+
+uint32_t getWorkerThreadsCount(size_t requestedThreadsCount);
+
+// Runs func on the calling thread and on up to maxWorkerThreadsCount - 1 additional threads, then joins them.
+// func has to pull its work items from shared state, so all work is done even if no additional thread gets to run.
+void runOnWorkerThreads(size_t requestedThreadsCount, const std::function<void()> &func);
+
+} // namespace NEO
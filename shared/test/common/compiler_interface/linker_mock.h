@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@ struct WhiteBox<NEO::LinkerInput> : NEO::LinkerInput {
     using BaseClass::extFunDependencies;
     using BaseClass::kernelDependencies;
     using BaseClass::parseRelocationForExtFuncUsage;
+    using BaseClass::rebuildRelocationPlan;
     using BaseClass::symbols;
     using BaseClass::textRelocations;
     using BaseClass::traits;
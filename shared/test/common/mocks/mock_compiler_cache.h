@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,11 +43,22 @@ class CompilerCacheMock : public CompilerCache {
         }
     }
 
+    std::unique_ptr<CachedBinaryView> mapCachedBinary(const std::string &kernelFileHash) override {
+        mapInvoked++;
+        auto it = hashToBinaryMap.find(kernelFileHash);
+        if (false == mapResult || it == hashToBinaryMap.end()) {
+            return nullptr;
+        }
+        return std::make_unique<CachedBinaryView>(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(it->second.data()), it->second.size()));
+    }
+
     std::vector<std::string> cacheBinaryKernelFileHashes{};
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
     bool loadResult = false;
     uint32_t numberOfLoadResult = 0u;
+    bool mapResult = false;
+    uint32_t mapInvoked = 0u;
     std::unordered_map<std::string, std::string> hashToBinaryMap;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,6 +59,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::isDisablePrefetcherRequired;
     using BaseClass::lastSubmittedThrottle;
     using BaseClass::miMemFenceRequired;
+    using BaseClass::multiProducerAppend;
     using BaseClass::notifyKmdDuringMonitorFence;
     using BaseClass::osContext;
     using BaseClass::partitionConfigSet;
@@ -66,11 +67,13 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::pciBarrierPtr;
     using BaseClass::preinitializedRelaxedOrderingScheduler;
     using BaseClass::preinitializedTaskStoreSection;
+    using BaseClass::publishedDispatches;
     using BaseClass::relaxedOrderingEnabled;
     using BaseClass::relaxedOrderingInitialized;
     using BaseClass::relaxedOrderingSchedulerAllocation;
     using BaseClass::relaxedOrderingSchedulerRequired;
     using BaseClass::reserved;
+    using BaseClass::reservedDispatches;
     using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
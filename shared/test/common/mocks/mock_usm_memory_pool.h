@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,11 +31,13 @@ class MockUsmMemAllocPool : public UsmMemAllocPool {
 
 class MockUsmMemAllocPoolsManager : public UsmMemAllocPoolsManager {
   public:
+    using UsmMemAllocPoolsManager::adaptivePools;
     using UsmMemAllocPoolsManager::canBePooled;
     using UsmMemAllocPoolsManager::device;
     using UsmMemAllocPoolsManager::getPoolContainingAlloc;
     using UsmMemAllocPoolsManager::memoryManager;
     using UsmMemAllocPoolsManager::pools;
+    using UsmMemAllocPoolsManager::sizeHistogram;
     using UsmMemAllocPoolsManager::totalSize;
     using UsmMemAllocPoolsManager::UsmMemAllocPoolsManager;
     uint64_t getFreeMemory() override {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,7 @@ int mkstempCalled = 0;
 int renameCalled = 0;
 int pathFileExistsCalled = 0;
 int flockCalled = 0;
+int flockOperationPassed = 0;
 int opendirCalled = 0;
 int readdirCalled = 0;
 int closedirCalled = 0;
@@ -436,6 +437,7 @@ int mkstemp(char *fileName) {
 
 int flock(int fd, int flag) {
     flockCalled++;
+    flockOperationPassed = flag;
 
     if (fd >= 0 && flockRetVal == 0) {
         return 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,9 @@
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <algorithm>
+#include <thread>
+
 using namespace NEO;
 
 constexpr uint32_t defaultNumIddsPerBlock = 64;
@@ -421,7 +424,10 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenInitializeThenCmdBuffersAr
     EXPECT_EQ(cmdContainer.getResidencyContainer().size(), cmdContainer.getCmdBufferAllocations().size());
 }
 
-TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAllocationAndDuplicatesRemovedThenExpectedSizeIsReturned) {
+TEST_F(CommandContainerTest, givenDedupOnAppendDisabledWhenWantToAddAlreadyAddedAllocationAndDuplicatesRemovedThenExpectedSizeIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableResidencyContainerDedupOnAppend.set(0);
+
     CommandContainer cmdContainer;
     cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
     MockGraphicsAllocation mockAllocation;
@@ -444,6 +450,155 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     EXPECT_EQ(sizeAfterFirstAdd, sizeAfterDuplicatesRemoved);
 }
 
+TEST_F(CommandContainerTest, givenCommandContainerWhenAlreadyAddedAllocationIsAddedAgainThenResidencyContainerIsNotChanged) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
+    MockGraphicsAllocation mockAllocation;
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    auto sizeAfterFirstAdd = cmdContainer.getResidencyContainer().size();
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    EXPECT_EQ(sizeAfterFirstAdd, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&mockAllocation, cmdContainer.getResidencyContainer().back());
+}
+
+TEST_F(CommandContainerTest, givenAllocationAddedToOtherContainerWhenAddedToCommandContainerThenItIsAddedToResidencyContainer) {
+    CommandContainer cmdContainer;
+    CommandContainer otherCmdContainer;
+    MockGraphicsAllocation mockAllocation;
+    MockGraphicsAllocation otherMockAllocation;
+
+    cmdContainer.addToResidencyContainer(&otherMockAllocation);
+    otherCmdContainer.addToResidencyContainer(&mockAllocation);
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+
+    ASSERT_EQ(2u, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&otherMockAllocation, cmdContainer.getResidencyContainer()[0]);
+    EXPECT_EQ(&mockAllocation, cmdContainer.getResidencyContainer()[1]);
+    ASSERT_EQ(1u, otherCmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&mockAllocation, otherCmdContainer.getResidencyContainer()[0]);
+}
+
+TEST_F(CommandContainerTest, givenResidencyContainerClearedWhenAllocationIsAddedAgainThenItIsAddedToResidencyContainer) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation mockAllocation;
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    cmdContainer.getResidencyContainer().clear();
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+
+    ASSERT_EQ(1u, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&mockAllocation, cmdContainer.getResidencyContainer()[0]);
+}
+
+TEST_F(CommandContainerTest, givenDuplicatesPushedDirectlyToResidencyContainerWhenDuplicatesRemovedThenContainerIsSortedAndHintsAreRefreshed) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation mockAllocations[3];
+
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    residencyContainer.push_back(&mockAllocations[2]);
+    residencyContainer.push_back(&mockAllocations[0]);
+    residencyContainer.push_back(&mockAllocations[2]);
+    residencyContainer.push_back(&mockAllocations[1]);
+    residencyContainer.push_back(&mockAllocations[0]);
+
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+
+    ASSERT_EQ(3u, residencyContainer.size());
+    EXPECT_TRUE(std::is_sorted(residencyContainer.begin(), residencyContainer.end()));
+
+    for (auto &mockAllocation : mockAllocations) {
+        cmdContainer.addToResidencyContainer(&mockAllocation);
+    }
+    EXPECT_EQ(3u, residencyContainer.size());
+}
+
+TEST_F(CommandContainerTest, givenAllocationAddedToOtherContainerInBetweenWhenDuplicatesRemovedThenAllocationIsStoredOnceAndSkippedOnNextAdd) {
+    CommandContainer cmdContainer;
+    CommandContainer otherCmdContainer;
+    MockGraphicsAllocation mockAllocation;
+    MockGraphicsAllocation otherMockAllocation;
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    otherCmdContainer.addToResidencyContainer(&otherMockAllocation);
+    otherCmdContainer.addToResidencyContainer(&mockAllocation);
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    EXPECT_EQ(2u, cmdContainer.getResidencyContainer().size());
+
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    ASSERT_EQ(1u, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&mockAllocation, cmdContainer.getResidencyContainer()[0]);
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    EXPECT_EQ(1u, cmdContainer.getResidencyContainer().size());
+    ASSERT_EQ(2u, otherCmdContainer.getResidencyContainer().size());
+}
+
+TEST_F(CommandContainerTest, givenContainersSharingAllocationsWhenDuplicatesAreRemovedConcurrentlyThenEachContainerStoresEveryAllocationOnce) {
+    constexpr size_t numAllocations = 64;
+    constexpr size_t numContainers = 4;
+    constexpr size_t numLaunches = 10000;
+
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    for (size_t i = 0; i < numAllocations; i++) {
+        allocations.push_back(std::make_unique<MockGraphicsAllocation>());
+    }
+    std::vector<std::unique_ptr<CommandContainer>> cmdContainers;
+    for (size_t i = 0; i < numContainers; i++) {
+        cmdContainers.push_back(std::make_unique<CommandContainer>());
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t containerIndex = 0; containerIndex < numContainers; containerIndex++) {
+        threads.emplace_back([&, containerIndex]() {
+            auto &cmdContainer = *cmdContainers[containerIndex];
+            for (size_t launch = 0; launch < numLaunches; launch++) {
+                cmdContainer.addToResidencyContainer(allocations[(launch * (containerIndex + 1)) % numAllocations].get());
+                if (launch % 1000 == 0) {
+                    cmdContainer.removeDuplicatesFromResidencyContainer();
+                }
+            }
+            cmdContainer.removeDuplicatesFromResidencyContainer();
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (auto &cmdContainer : cmdContainers) {
+        auto &residencyContainer = cmdContainer->getResidencyContainer();
+        EXPECT_TRUE(std::is_sorted(residencyContainer.begin(), residencyContainer.end()));
+        EXPECT_EQ(residencyContainer.end(), std::adjacent_find(residencyContainer.begin(), residencyContainer.end()));
+    }
+    EXPECT_EQ(numAllocations, cmdContainers[0]->getResidencyContainer().size());
+}
+
+TEST_F(CommandContainerTest, givenManyLaunchesReusingSameAllocationsWhenAddedToResidencyContainerThenEachAllocationIsStoredOnce) {
+    constexpr size_t numAllocations = 64;
+    constexpr size_t numLaunches = 50000;
+
+    CommandContainer cmdContainer;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> allocations;
+    for (size_t i = 0; i < numAllocations; i++) {
+        allocations.push_back(std::make_unique<MockGraphicsAllocation>());
+    }
+
+    for (size_t launch = 0; launch < numLaunches; launch++) {
+        cmdContainer.addToResidencyContainer(allocations[launch % numAllocations].get());
+        cmdContainer.addToResidencyContainer(allocations[(launch * 7) % numAllocations].get());
+    }
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    EXPECT_EQ(numAllocations, residencyContainer.size());
+
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+
+    ASSERT_EQ(numAllocations, residencyContainer.size());
+    for (auto &allocation : allocations) {
+        EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), allocation.get()));
+    }
+}
+
 HWTEST_F(CommandContainerTest, givenCmdContainerWhenInitializeCalledThenSSHHeapHasBindlessOffsetReserved) {
     std::unique_ptr<CommandContainer> cmdContainer(new CommandContainer);
     cmdContainer->setReservedSshSize(4 * MemoryConstants::pageSize);
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_index.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(CompilerCacheIndexTests, givenAddedEntriesWhenPoppingThenEntriesAreReturnedInLeastRecentlyUsedOrder) {
+    CompilerCacheIndex index;
+    index.add("a.cl_cache", 10);
+    index.add("b.cl_cache", 20);
+    index.add("c.cl_cache", 30);
+    index.touch("a.cl_cache");
+
+    EXPECT_EQ(3u, index.getEntriesCount());
+    EXPECT_EQ(60u, index.getTotalSize());
+
+    CompilerCacheIndex::Entry entry;
+    ASSERT_TRUE(index.popLeastRecentlyUsed(entry));
+    EXPECT_EQ("b.cl_cache", entry.fileName);
+    EXPECT_EQ(20u, entry.size);
+    ASSERT_TRUE(index.popLeastRecentlyUsed(entry));
+    EXPECT_EQ("c.cl_cache", entry.fileName);
+    ASSERT_TRUE(index.popLeastRecentlyUsed(entry));
+    EXPECT_EQ("a.cl_cache", entry.fileName);
+    EXPECT_FALSE(index.popLeastRecentlyUsed(entry));
+    EXPECT_EQ(0u, index.getTotalSize());
+}
+
+TEST(CompilerCacheIndexTests, givenEntryAddedTwiceWhenAddingThenSingleEntryWithLatestSizeIsKept) {
+    CompilerCacheIndex index;
+    index.add("a.cl_cache", 10);
+    index.add("a.cl_cache", 15);
+    index.remove("not_existing.cl_cache");
+    index.touch("not_existing.cl_cache");
+
+    EXPECT_EQ(1u, index.getEntriesCount());
+    EXPECT_EQ(15u, index.getTotalSize());
+}
+
+TEST(CompilerCacheIndexTests, givenLogWithAllRecordTypesWhenDeserializingThenLogIsReplayed) {
+    std::string log(CompilerCacheIndex::header);
+    log += CompilerCacheIndex::createAddRecord("a.cl_cache", 1);
+    log += CompilerCacheIndex::createAddRecord("b.cl_cache", 2);
+    log += CompilerCacheIndex::createAddRecord("c.cl_cache", 3);
+    log += CompilerCacheIndex::createTouchRecord("a.cl_cache");
+    log += CompilerCacheIndex::createRemoveRecord("b.cl_cache");
+
+    CompilerCacheIndex index;
+    ASSERT_TRUE(index.deserialize(log.data(), log.size()));
+    EXPECT_EQ(2u, index.getEntriesCount());
+    EXPECT_EQ(4u, index.getTotalSize());
+
+    std::string expectedSerialized(CompilerCacheIndex::header);
+    expectedSerialized += CompilerCacheIndex::createAddRecord("c.cl_cache", 3);
+    expectedSerialized += CompilerCacheIndex::createAddRecord("a.cl_cache", 1);
+    EXPECT_EQ(expectedSerialized, index.serialize());
+}
+
+TEST(CompilerCacheIndexTests, givenTornLastRecordWhenDeserializingThenRecordIsSkipped) {
+    std::string log(CompilerCacheIndex::header);
+    log += CompilerCacheIndex::createAddRecord("a.cl_cache", 1);
+    log += "A 12 b.cl_c";
+
+    CompilerCacheIndex index;
+    ASSERT_TRUE(index.deserialize(log.data(), log.size()));
+    EXPECT_EQ(1u, index.getEntriesCount());
+}
+
+TEST(CompilerCacheIndexTests, givenCorruptedLogWhenDeserializingThenFalseIsReturnedAndIndexIsEmpty) {
+    const std::string validRecord = CompilerCacheIndex::createAddRecord("a.cl_cache", 1);
+    const std::string corruptedLogs[] = {
+        "",
+        "not an index\n",
+        std::string(CompilerCacheIndex::header) + validRecord + "X a.cl_cache\n",
+        std::string(CompilerCacheIndex::header) + validRecord + "A abc a.cl_cache\n",
+        std::string(CompilerCacheIndex::header) + validRecord + "A 12\n",
+        std::string(CompilerCacheIndex::header) + validRecord + "T\n"};
+
+    for (const auto &log : corruptedLogs) {
+        CompilerCacheIndex index;
+        EXPECT_FALSE(index.deserialize(log.data(), log.size())) << log;
+        EXPECT_EQ(0u, index.getEntriesCount());
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -271,6 +271,18 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, WhenGettingCachedFileNameThenFull128BitHashIsReturnedAsHexString) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char input[] = "__kernel void k() {}";
+    CompilerCache cache(CompilerCacheConfig{});
+
+    auto fileName = cache.getCachedFileName(hwInfo, ArrayRef<const char>(input, sizeof(input)), ArrayRef<const char>(), ArrayRef<const char>(),
+                                            ArrayRef<const char>(), ArrayRef<const char>(), ArrayRef<const char>(), 0u, 0);
+
+    EXPECT_EQ(32u, fileName.size());
+    EXPECT_EQ(std::string::npos, fileName.find_first_not_of("0123456789abcdef"));
+}
+
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
     DebugManagerStateRestore restorer;
     debugManager.flags.BinaryCacheTrace.set(true);
@@ -643,6 +655,37 @@ TEST_F(CompilerInterfaceOclElfCacheTest, givenNonEmptyTranslationOutputWhenProce
     EXPECT_EQ(0, memcmp(nonEmptyTranslationOutput.intermediateRepresentation.mem.get(), existingIr, strlen(existingIr)));
 }
 
+TEST_F(CompilerInterfaceOclElfCacheTest, givenMappedPackedCacheBinaryWhenLoadCacheAndSetOutputThenOutputIsUnpackedFromMappingWithoutLoadingBinary) {
+    TranslationOutput outputFromCompilation;
+    outputFromCompilation.deviceBinary.mem = makeCopy<char>(reinterpret_cast<const char *>(patchtokensProgram.storage.data()), patchtokensProgram.storage.size());
+    outputFromCompilation.deviceBinary.size = patchtokensProgram.storage.size();
+
+    MockDevice device;
+    CompilerCacheHelper::packAndCacheBinary(*mockCompilerCache, "some_hash", NEO::getTargetDevice(device.getRootDeviceEnvironment()), outputFromCompilation);
+    ASSERT_EQ(1u, mockCompilerCache->hashToBinaryMap.size());
+    ASSERT_TRUE(isPackedOclElf(mockCompilerCache->hashToBinaryMap.begin()->second));
+
+    mockCompilerCache->mapResult = true;
+    mockCompilerCache->numberOfLoadResult = 0u;
+    TranslationOutput outputFromCache;
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "some_hash", outputFromCache, device));
+    EXPECT_EQ(1u, mockCompilerCache->mapInvoked);
+    ASSERT_EQ(outputFromCompilation.deviceBinary.size, outputFromCache.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(outputFromCompilation.deviceBinary.mem.get(), outputFromCache.deviceBinary.mem.get(), outputFromCache.deviceBinary.size));
+}
+
+TEST_F(CompilerInterfaceOclElfCacheTest, givenMappedUnpackedCacheBinaryWhenLoadCacheAndSetOutputThenDeviceBinaryIsCopiedFromMapping) {
+    std::string cachedBinary = "cachedDeviceBinary";
+    mockCompilerCache->hashToBinaryMap["some_hash"] = cachedBinary;
+    mockCompilerCache->mapResult = true;
+
+    MockDevice device;
+    TranslationOutput outputFromCache;
+    EXPECT_TRUE(CompilerCacheHelper::loadCacheAndSetOutput(*mockCompilerCache, "some_hash", outputFromCache, device));
+    ASSERT_EQ(cachedBinary.size(), outputFromCache.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(cachedBinary.data(), outputFromCache.deviceBinary.mem.get(), cachedBinary.size()));
+}
+
 TEST_F(CompilerInterfaceOclElfCacheTest, GivenKernelWithIncludesWhenBuildingThenPackBinaryOnCacheSaveAndUnpackBinaryOnLoadFromCache) {
     USE_REAL_FILE_SYSTEM();
 
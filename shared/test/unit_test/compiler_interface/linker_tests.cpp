@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -707,6 +707,7 @@ TEST_F(LinkerTests, GivenRelocationToInstructionSegmentWithLocalUndefinedSymbolW
     rela.relocationSegment = NEO::SegmentType::instructions;
     linkerInput.textRelocations.push_back({rela});
 
+    linkerInput.rebuildRelocationPlan();
     WhiteBox<NEO::Linker> linker(linkerInput);
 
     uint64_t instructionSegmentData{std::numeric_limits<uint64_t>::max()};
@@ -723,6 +724,161 @@ TEST_F(LinkerTests, GivenRelocationToInstructionSegmentWithLocalUndefinedSymbolW
     EXPECT_EQ(0u, unresolvedExternals.size());
 }
 
+TEST(LinkerInputTests, givenRelocationsWhenGettingRelocationPlanThenSymbolNamesAreInternedAndRelocationsAreBucketedBySegmentAndType) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::LinkerInput::RelocationInfo relocation;
+    relocation.relocationSegment = NEO::SegmentType::instructions;
+    relocation.symbolName = "A";
+    relocation.offset = 0U;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::addressLow;
+    linkerInput.textRelocations.push_back({relocation});
+    relocation.offset = 4U;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::addressHigh;
+    linkerInput.textRelocations[0].push_back(relocation);
+    relocation.offset = 8U;
+    relocation.symbolName = "";
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    linkerInput.textRelocations[0].push_back(relocation);
+    relocation.offset = 16U;
+    relocation.symbolName = implicitArgsRelocationSymbolName;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::addressLow;
+    linkerInput.textRelocations[0].push_back(relocation);
+
+    relocation.offset = 0U;
+    relocation.symbolName = "B";
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    relocation.relocationSegment = NEO::SegmentType::globalVariablesZeroInit;
+    linkerInput.dataRelocations.push_back(relocation);
+    relocation.symbolName = "A";
+    relocation.relocationSegment = NEO::SegmentType::unknown;
+    linkerInput.dataRelocations.push_back(relocation);
+
+    linkerInput.rebuildRelocationPlan();
+
+    const auto &plan = linkerInput.getRelocationPlan();
+    using RelocationPlan = NEO::LinkerInput::RelocationPlan;
+    using Type = NEO::LinkerInput::RelocationInfo::Type;
+    ASSERT_EQ(3U, plan.symbolNames.size());
+    EXPECT_EQ("A", plan.symbolNames[1]);
+    EXPECT_EQ("B", plan.symbolNames[2]);
+
+    ASSERT_EQ(1U, plan.instructionsSegments.size());
+    const auto &segmentPlan = plan.instructionsSegments[0];
+    ASSERT_EQ(1U, segmentPlan.entriesPerType[static_cast<size_t>(Type::addressLow)].size());
+    ASSERT_EQ(1U, segmentPlan.entriesPerType[static_cast<size_t>(Type::addressHigh)].size());
+    EXPECT_EQ(1U, segmentPlan.entriesPerType[static_cast<size_t>(Type::addressLow)][0].symbolId);
+    EXPECT_EQ(1U, segmentPlan.entriesPerType[static_cast<size_t>(Type::addressHigh)][0].symbolId);
+    EXPECT_EQ(1U, segmentPlan.entriesPerType[static_cast<size_t>(Type::addressHigh)][0].relocationIndex);
+    ASSERT_EQ(1U, segmentPlan.entriesPerType[static_cast<size_t>(Type::address)].size());
+    EXPECT_EQ(RelocationPlan::zeroValueSymbolId, segmentPlan.entriesPerType[static_cast<size_t>(Type::address)][0].symbolId);
+    ASSERT_EQ(1U, segmentPlan.implicitArgs.size());
+    EXPECT_EQ(3U, segmentPlan.implicitArgs[0].relocationIndex);
+
+    const auto &bssEntries = plan.dataSegments[RelocationPlan::globalVariablesZeroInit][static_cast<size_t>(Type::address)];
+    ASSERT_EQ(1U, bssEntries.size());
+    EXPECT_EQ(2U, bssEntries[0].symbolId);
+    ASSERT_EQ(1U, plan.dataRelocationsInUnsupportedSegments.size());
+    EXPECT_EQ(1U, plan.dataRelocationsInUnsupportedSegments[0]);
+}
+
+TEST(LinkerInputTests, givenRelocationsAddedThroughLinkerInputWhenGettingRelocationPlanThenPlanIsExtendedWithThem) {
+    using Type = NEO::LinkerInput::RelocationInfo::Type;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::LinkerInput::RelocationInfo relocation;
+    relocation.offset = 8U;
+    relocation.symbolName = "A";
+    relocation.type = Type::address;
+    relocation.relocationSegment = NEO::SegmentType::globalVariables;
+    linkerInput.addDataRelocationInfo(relocation);
+
+    const auto &plan = linkerInput.getRelocationPlan();
+    ASSERT_EQ(1U, plan.dataSegments[NEO::LinkerInput::RelocationPlan::globalVariables][static_cast<size_t>(Type::address)].size());
+    EXPECT_EQ(8U, plan.dataSegments[NEO::LinkerInput::RelocationPlan::globalVariables][static_cast<size_t>(Type::address)][0].offset);
+    EXPECT_TRUE(plan.instructionsSegments.empty());
+
+    relocation.symbolName = "B";
+    relocation.type = Type::addressLow;
+    linkerInput.addElfTextSegmentRelocation(relocation, 1U);
+    relocation.type = Type::addressHigh;
+    linkerInput.addElfTextSegmentRelocation(relocation, 1U);
+
+    ASSERT_EQ(2U, plan.instructionsSegments.size());
+    ASSERT_EQ(1U, plan.instructionsSegments[1].entriesPerType[static_cast<size_t>(Type::addressLow)].size());
+    ASSERT_EQ(1U, plan.instructionsSegments[1].entriesPerType[static_cast<size_t>(Type::addressHigh)].size());
+    EXPECT_EQ(1U, plan.instructionsSegments[1].entriesPerType[static_cast<size_t>(Type::addressHigh)][0].relocationIndex);
+    EXPECT_EQ(2U, plan.instructionsSegments[1].entriesPerType[static_cast<size_t>(Type::addressHigh)][0].symbolId);
+    EXPECT_EQ(3U, plan.symbolNames.size());
+}
+
+TEST(LinkerInputTests, givenDecodedStateWhenRestoringItThenRelocationPlanIsRebuiltFromRestoredRelocations) {
+    using Type = NEO::LinkerInput::RelocationInfo::Type;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::LinkerInput::RelocationInfo relocation;
+    relocation.symbolName = "stale";
+    relocation.type = Type::address;
+    relocation.relocationSegment = NEO::SegmentType::globalVariables;
+    linkerInput.addDataRelocationInfo(relocation);
+
+    relocation.symbolName = "A";
+    relocation.relocationSegment = NEO::SegmentType::instructions;
+    NEO::LinkerInput::RelocationsPerInstSegment textRelocations(1);
+    textRelocations[0].push_back(relocation);
+    linkerInput.restoreDecodedState({}, {}, {}, std::move(textRelocations), {}, {});
+
+    const auto &plan = linkerInput.getRelocationPlan();
+    EXPECT_TRUE(plan.dataSegments[NEO::LinkerInput::RelocationPlan::globalVariables][static_cast<size_t>(Type::address)].empty());
+    ASSERT_EQ(1U, plan.instructionsSegments.size());
+    EXPECT_EQ(1U, plan.instructionsSegments[0].entriesPerType[static_cast<size_t>(Type::address)].size());
+    ASSERT_EQ(2U, plan.symbolNames.size());
+    EXPECT_EQ("A", plan.symbolNames[1]);
+}
+
+TEST_F(LinkerTests, givenResolvedAndUnresolvedRelocationsOfDifferentTypesWhenPatchingInstructionsSegmentsThenUnresolvedExternalsKeepRelocationOrder) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    NEO::LinkerInput::RelocationInfo relocation;
+    relocation.relocationSegment = NEO::SegmentType::instructions;
+    relocation.symbolName = "unresolvedHigh";
+    relocation.offset = 4U;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::addressHigh;
+    linkerInput.textRelocations.push_back({relocation});
+    relocation.symbolName = "resolved";
+    relocation.offset = 0U;
+    relocation.addend = 4U;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::addressLow;
+    linkerInput.textRelocations[0].push_back(relocation);
+    relocation.symbolName = "unresolvedLow";
+    relocation.offset = 8U;
+    relocation.addend = 0U;
+    linkerInput.textRelocations[0].push_back(relocation);
+    relocation.symbolName = "resolved";
+    relocation.offset = 64U;
+    relocation.type = NEO::LinkerInput::RelocationInfo::Type::address;
+    linkerInput.textRelocations[0].push_back(relocation);
+
+    linkerInput.rebuildRelocationPlan();
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.relocatedSymbols["resolved"].gpuAddress = 0x12345678U;
+
+    uint32_t instructionSegmentData[4] = {};
+    NEO::Linker::PatchableSegment instructionSegmentToPatch;
+    instructionSegmentToPatch.hostPointer = instructionSegmentData;
+    instructionSegmentToPatch.segmentSize = sizeof(instructionSegmentData);
+
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    linker.patchInstructionsSegments({instructionSegmentToPatch}, unresolvedExternals, kernelDescriptors);
+
+    EXPECT_EQ(0x1234567cU, instructionSegmentData[0]);
+    ASSERT_EQ(3U, unresolvedExternals.size());
+    EXPECT_EQ("unresolvedHigh", unresolvedExternals[0].unresolvedRelocation.symbolName);
+    EXPECT_FALSE(unresolvedExternals[0].internalError);
+    EXPECT_EQ("unresolvedLow", unresolvedExternals[1].unresolvedRelocation.symbolName);
+    EXPECT_FALSE(unresolvedExternals[1].internalError);
+    EXPECT_EQ("resolved", unresolvedExternals[2].unresolvedRelocation.symbolName);
+    EXPECT_TRUE(unresolvedExternals[2].internalError);
+}
+
 TEST(LinkerInputTests, GivenInvalidFunctionsSymbolsUsedInFunctionsRelocationsWhenParsingRelocationsForExtFuncUsageThenDoNotAddDependency) {
     WhiteBox<NEO::LinkerInput> mockLinkerInput;
 
@@ -1343,6 +1499,7 @@ HWTEST_F(LinkerTests, givenValidStringSymbolsAndRelocationsWhenPatchingThenItIsP
 
     linkerInput.traits.requiresPatchingOfInstructionSegments = true;
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1419,6 +1576,7 @@ TEST_F(LinkerTests, givenValidStringSymbolsAndRelocationsWithWordMisalignedOffse
 
     linkerInput.traits.requiresPatchingOfInstructionSegments = true;
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1589,6 +1747,7 @@ HWTEST_F(LinkerTests, givenValidSymbolsAndRelocationsWhenPatchingDataSegmentsThe
         }
     }
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1740,6 +1899,7 @@ HWTEST_F(LinkerTests, givenValidSymbolsAndRelocationsToBssDataSectionsWhenPatchi
         linkerInput.textRelocations.push_back({relocation});
     }
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1787,6 +1947,7 @@ HWTEST_F(LinkerTests, givenInvalidSymbolWhenPatchingDataSegmentsThenRelocationIs
     relocationInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
     linkerInput.dataRelocations.push_back(relocationInfo);
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1826,6 +1987,7 @@ HWTEST_F(LinkerTests, givenInvalidRelocationOffsetWhenPatchingDataSegmentsThenRe
     relocationInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
     linkerInput.dataRelocations.push_back(relocationInfo);
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1850,6 +2012,7 @@ HWTEST_F(LinkerTests, givenInvalidRelocationSegmentWhenPatchingDataSegmentsThenR
     relocationInfo.symbolName = "symbol";
     relocationInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
     linkerInput.dataRelocations.push_back(relocationInfo);
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -1892,6 +2055,7 @@ HWTEST_F(LinkerTests, given32BitBinaryWithValidSymbolsAndRelocationsWhenPatching
     relocationInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
     linkerInput.dataRelocations.push_back(relocationInfo);
 
+    linkerInput.rebuildRelocationPlan();
     NEO::Linker linker(linkerInput);
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     NEO::Linker::KernelDescriptorsT kernelDescriptors;
@@ -2672,6 +2836,7 @@ TEST_F(LinkerTests, givenRelaWhenPatchingInstructionsSegmentThenAddendIsAdded) {
     rela.relocationSegment = NEO::SegmentType::instructions;
     linkerInput.textRelocations.push_back({rela});
 
+    linkerInput.rebuildRelocationPlan();
     WhiteBox<NEO::Linker> linker(linkerInput);
     constexpr uint64_t symValue = 64U;
     linker.relocatedSymbols[rela.symbolName].gpuAddress = symValue;
@@ -2705,6 +2870,7 @@ HWTEST_F(LinkerTests, givenRelaWhenPatchingDataSegmentThenAddendIsAdded) {
     rela.relocationSegment = NEO::SegmentType::globalConstants;
     linkerInput.dataRelocations.push_back({rela});
 
+    linkerInput.rebuildRelocationPlan();
     WhiteBox<NEO::Linker> linker(linkerInput);
     constexpr uint64_t symValue = 64U;
     linker.relocatedSymbols[rela.symbolName].gpuAddress = symValue;
@@ -2732,6 +2898,7 @@ HWTEST_F(LinkerTests, givenRelocationInfoWhenPatchingDataSegmentWithGlobalVariab
     relocationInfo.relocationSegment = NEO::SegmentType::globalVariables;
     linkerInput.dataRelocations.push_back({relocationInfo});
 
+    linkerInput.rebuildRelocationPlan();
     WhiteBox<NEO::Linker> linker(linkerInput);
     constexpr uint64_t symValue = 64U;
     linker.relocatedSymbols[relocationInfo.symbolName].gpuAddress = symValue;
@@ -2741,6 +2908,36 @@ HWTEST_F(LinkerTests, givenRelocationInfoWhenPatchingDataSegmentWithGlobalVariab
     EXPECT_EQ(static_cast<uint64_t>(relocationInfo.addend + symValue), globalVariableSegmentData);
 }
 
+HWTEST_F(LinkerTests, givenRelocationAtNonZeroOffsetInZeroInitDataSegmentWhenPatchingDataSegmentsThenValueIsWrittenAtByteOffset) {
+    uint32_t initGlobalVariablesData[2] = {0x11111111U, 0x22222222U};
+    uint32_t globalVariablesSegmentData[8] = {};
+    NEO::MockGraphicsAllocation globalVariablesPatchableSegment{globalVariablesSegmentData, sizeof(globalVariablesSegmentData)};
+
+    NEO::Linker::SegmentInfo globalVariablesSegmentInfo;
+    globalVariablesSegmentInfo.gpuAddress = static_cast<uintptr_t>(globalVariablesPatchableSegment.getGpuAddress());
+    globalVariablesSegmentInfo.segmentSize = globalVariablesPatchableSegment.getUnderlyingBufferSize();
+
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfGlobalVariablesBuffer = true;
+    NEO::LinkerInput::RelocationInfo relocationInfo;
+    relocationInfo.offset = 4U;
+    relocationInfo.type = NEO::LinkerInput::RelocationInfo::Type::addressLow;
+    relocationInfo.symbolName = "symbol";
+    relocationInfo.relocationSegment = NEO::SegmentType::globalVariablesZeroInit;
+    linkerInput.dataRelocations.push_back({relocationInfo});
+    linkerInput.rebuildRelocationPlan();
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    linker.relocatedSymbols[relocationInfo.symbolName].gpuAddress = 0xABCD1234U;
+
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    linker.patchDataSegments(globalVariablesSegmentInfo, {}, &globalVariablesPatchableSegment, {}, unresolvedExternals, pDevice, nullptr, 0, initGlobalVariablesData, sizeof(initGlobalVariablesData));
+    EXPECT_EQ(0U, unresolvedExternals.size());
+
+    uint32_t expectedSegmentData[8] = {0x11111111U, 0x22222222U, 0U, 0xABCD1234U, 0U, 0U, 0U, 0U};
+    EXPECT_EQ(0, memcmp(expectedSegmentData, globalVariablesSegmentData, sizeof(expectedSegmentData)));
+}
+
 TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstructionSegmentsThenPatchItWithCTDSize) {
     WhiteBox<NEO::LinkerInput> linkerInput;
     linkerInput.traits.requiresPatchingOfInstructionSegments = true;
@@ -2756,6 +2953,7 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstruction
     kd.kernelAttributes.inlineDataPayloadSize = 0x20;
     kernelDescriptors.push_back(&kd);
 
+    linkerInput.rebuildRelocationPlan();
     WhiteBox<NEO::Linker> linker(linkerInput);
 
     uint64_t segmentData{0};
@@ -2785,6 +2983,7 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationAndCrossThreadDataSmall
     kd.kernelAttributes.inlineDataPayloadSize = 64u;
     kernelDescriptors.push_back(&kd);
 
+    linkerInput.rebuildRelocationPlan();
     WhiteBox<NEO::Linker> linker(linkerInput);
 
     uint64_t segmentData{0};
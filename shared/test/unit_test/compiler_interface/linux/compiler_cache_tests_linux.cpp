@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_index.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
@@ -29,6 +30,7 @@
 #include <array>
 #include <list>
 #include <memory>
+#include <sys/file.h>
 
 using namespace NEO;
 
@@ -139,6 +141,116 @@ TEST(CompilerCacheTests, GivenCompilerCacheWithWhenScandirFailThenEvictCacheFail
     EXPECT_FALSE(cache.evictCache(bytesEvicted));
 }
 
+namespace CacheIndexMocks {
+constexpr int indexFd = 77;
+constexpr int tmpIndexFd = 78;
+std::string indexContent;
+std::string writtenContent;
+std::vector<std::string> unlinkedFiles;
+std::vector<std::string> renamedFiles;
+
+decltype(NEO::SysCalls::sysCallsOpen) mockOpen = [](const char *pathname, int flags) -> int {
+    if (std::string_view(pathname).find(CompilerCacheIndex::indexFileName) != std::string_view::npos) {
+        return indexFd;
+    }
+    return -1;
+};
+
+decltype(NEO::SysCalls::sysCallsOpen) mockOpenIndexMissing = [](const char *pathname, int flags) -> int {
+    return -1;
+};
+
+decltype(NEO::SysCalls::sysCallsOpenWithMode) mockOpenWithMode = [](const char *pathname, int flags, int mode) -> int {
+    return tmpIndexFd;
+};
+
+decltype(NEO::SysCalls::sysCallsFstat) mockFstat = [](int fd, struct stat *buf) -> int {
+    buf->st_size = fd == indexFd ? static_cast<off_t>(indexContent.size()) : 0;
+    return 0;
+};
+
+decltype(NEO::SysCalls::sysCallsPread) mockPread = [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+    memcpy(buf, indexContent.data() + offset, count);
+    return count;
+};
+
+decltype(NEO::SysCalls::sysCallsWrite) mockWrite = [](int fd, const void *buf, size_t count) -> ssize_t {
+    writtenContent.append(reinterpret_cast<const char *>(buf), count);
+    return count;
+};
+
+decltype(NEO::SysCalls::sysCallsUnlink) mockUnlink = [](const std::string &pathname) -> int {
+    unlinkedFiles.push_back(pathname);
+    return 0;
+};
+
+decltype(NEO::SysCalls::sysCallsRename) mockRename = [](const char *currName, const char *dstName) -> int {
+    renamedFiles.push_back(dstName);
+    return 0;
+};
+
+struct CacheIndexMocksRestorer {
+    CacheIndexMocksRestorer() {
+        indexContent.clear();
+        writtenContent.clear();
+        unlinkedFiles.clear();
+        renamedFiles.clear();
+    }
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup{&NEO::SysCalls::sysCallsOpen, mockOpen};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openWithModeBackup{&NEO::SysCalls::sysCallsOpenWithMode, mockOpenWithMode};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup{&NEO::SysCalls::sysCallsFstat, mockFstat};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup{&NEO::SysCalls::sysCallsPread, mockPread};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsWrite)> writeBackup{&NEO::SysCalls::sysCallsWrite, mockWrite};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsUnlink)> unlinkBackup{&NEO::SysCalls::sysCallsUnlink, mockUnlink};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsRename)> renameBackup{&NEO::SysCalls::sysCallsRename, mockRename};
+    VariableBackup<int> scandirCalledBackup{&NEO::SysCalls::scandirCalled, 0};
+};
+} // namespace CacheIndexMocks
+
+TEST(CompilerCacheTests, GivenValidCacheIndexWhenEvictCacheIsCalledThenLeastRecentlyUsedEntriesAreUnlinkedWithoutListingDirectory) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    CacheIndexMocks::indexContent = std::string(CompilerCacheIndex::header) +
+                                    CompilerCacheIndex::createAddRecord("file1.cl_cache", 400) +
+                                    CompilerCacheIndex::createAddRecord("file2.cl_cache", 400) +
+                                    CompilerCacheIndex::createAddRecord("file3.cl_cache", 400) +
+                                    CompilerCacheIndex::createTouchRecord("file1.cl_cache");
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", 1500});
+
+    uint64_t bytesEvicted{0u};
+    EXPECT_TRUE(cache.evictCache(bytesEvicted));
+
+    EXPECT_EQ(0, NEO::SysCalls::scandirCalled);
+    EXPECT_EQ(800u, bytesEvicted);
+    ASSERT_EQ(2u, CacheIndexMocks::unlinkedFiles.size());
+    EXPECT_NE(std::string::npos, CacheIndexMocks::unlinkedFiles[0].find("file2.cl_cache"));
+    EXPECT_NE(std::string::npos, CacheIndexMocks::unlinkedFiles[1].find("file3.cl_cache"));
+
+    EXPECT_EQ(std::string(CompilerCacheIndex::header) + CompilerCacheIndex::createAddRecord("file1.cl_cache", 400), CacheIndexMocks::writtenContent);
+    ASSERT_EQ(1u, CacheIndexMocks::renamedFiles.size());
+    EXPECT_NE(std::string::npos, CacheIndexMocks::renamedFiles[0].find(CompilerCacheIndex::indexFileName));
+}
+
+TEST(CompilerCacheTests, GivenCacheIndexNotCoveringEnoughFilesWhenEvictCacheIsCalledThenIndexIsRebuiltFromDirectory) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    CacheIndexMocks::indexContent = std::string(CompilerCacheIndex::header) +
+                                    CompilerCacheIndex::createAddRecord("file6.cl_cache", 10);
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsScandir)> scandirBackup(&NEO::SysCalls::sysCallsScandir, EvictCachePass::mockScandir);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, EvictCachePass::mockStat);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte - 2u});
+
+    uint64_t bytesEvicted{0u};
+    EXPECT_TRUE(cache.evictCache(bytesEvicted));
+
+    EXPECT_EQ(1, NEO::SysCalls::scandirCalled);
+    ASSERT_EQ(3u, CacheIndexMocks::unlinkedFiles.size());
+    EXPECT_NE(std::string::npos, CacheIndexMocks::unlinkedFiles[0].find("file6"));
+    EXPECT_NE(std::string::npos, CacheIndexMocks::unlinkedFiles[1].find("file3"));
+    EXPECT_NE(std::string::npos, CacheIndexMocks::unlinkedFiles[2].find("file4"));
+}
+
 namespace CreateUniqueTempFilePass {
 decltype(NEO::SysCalls::sysCallsMkstemp) mockMkstemp = [](char *fileName) -> int {
     memcpy_s(&fileName[22], 20, "123456", sizeof("123456"));
@@ -523,6 +635,49 @@ TEST(CompilerCacheTests, GivenCacheDirectoryFilledToTheLimitWhenNewBinaryFitsAft
     EXPECT_EQ(expectedDirectorySize, PWriteCallsCountedAndDirSizeWritten::dirSize);
 }
 
+TEST(CompilerCacheTests, GivenExistingCacheIndexWhenCacheBinarySucceedsThenAddRecordIsAppendedToIndex) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    CacheIndexMocks::indexContent = std::string(CompilerCacheIndex::header);
+
+    CompilerCacheEvictionTestsMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    cache.lockConfigFileAndReadSizeFd = 1;
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int { return -1; });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPwrite)> pWriteBackup(&NEO::SysCalls::sysCallsPwrite, PWriteCallsCountedAndDirSizeWritten::mockPwrite);
+
+    EXPECT_TRUE(cache.cacheBinary("7e3291364d8df42", "123456", 6));
+
+    EXPECT_EQ(CompilerCacheIndex::createAddRecord("7e3291364d8df42.cl_cache", 6), CacheIndexMocks::writtenContent);
+    EXPECT_TRUE(CacheIndexMocks::renamedFiles.empty());
+    EXPECT_EQ(0, NEO::SysCalls::scandirCalled);
+}
+
+TEST(CompilerCacheTests, GivenMissingCacheIndexWhenCacheBinarySucceedsThenIndexIsRebuiltFromDirectory) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, CacheIndexMocks::mockOpenIndexMissing);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsScandir)> scandirBackup(&NEO::SysCalls::sysCallsScandir, EvictCachePass::mockScandir);
+
+    CompilerCacheEvictionTestsMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    cache.lockConfigFileAndReadSizeFd = 1;
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int {
+        if (filePath.find("7e3291364d8df42") != filePath.npos) {
+            return -1;
+        }
+        return EvictCachePass::mockStat(filePath, statbuf);
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPwrite)> pWriteBackup(&NEO::SysCalls::sysCallsPwrite, PWriteCallsCountedAndDirSizeWritten::mockPwrite);
+
+    EXPECT_TRUE(cache.cacheBinary("7e3291364d8df42", "123456", 6));
+
+    EXPECT_EQ(1, NEO::SysCalls::scandirCalled);
+    CompilerCacheIndex rebuiltIndex;
+    ASSERT_TRUE(rebuiltIndex.deserialize(CacheIndexMocks::writtenContent.data(), CacheIndexMocks::writtenContent.size()));
+    EXPECT_EQ(6u, rebuiltIndex.getEntriesCount());
+    ASSERT_EQ(1u, CacheIndexMocks::renamedFiles.size());
+    EXPECT_NE(std::string::npos, CacheIndexMocks::renamedFiles[0].find(CompilerCacheIndex::indexFileName));
+}
+
 TEST(CompilerCacheTests, GivenCacheBinaryWhenBinaryDoesntFitAfterEvictionThenWriteToConfigAndReturnFalse) {
     const size_t cacheSize = 10;
     CompilerCacheEvictionTestsMockLinux cache({true, ".cl_cache", "/home/cl_cache/", cacheSize});
@@ -1088,3 +1243,159 @@ TEST(CompilerCacheHelper, GivenNotExistingPathWhenGettingFileSizeThenZeroIsRetur
 
     EXPECT_EQ(getFileSize("/tmp/file1"), 0u);
 }
+
+namespace NEO {
+namespace SysCalls {
+extern bool failMmap;
+}
+} // namespace NEO
+
+namespace MapCachedBinaryMocks {
+constexpr int cacheFileFd = 79;
+constexpr off_t cacheFileSize = 4096;
+
+decltype(NEO::SysCalls::sysCallsOpen) mockOpen = [](const char *pathname, int flags) -> int {
+    if (std::string_view(pathname).find(".cl_cache") != std::string_view::npos) {
+        return cacheFileFd;
+    }
+    return -1;
+};
+
+decltype(NEO::SysCalls::sysCallsFstat) mockFstat = [](int fd, struct stat *buf) -> int {
+    buf->st_size = fd == cacheFileFd ? cacheFileSize : 0;
+    return 0;
+};
+} // namespace MapCachedBinaryMocks
+
+TEST(CompilerCacheTests, GivenExistingCacheFileWhenMapCachedBinaryIsCalledThenFileIsMappedAndUnmappedWhenViewIsReleased) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, MapCachedBinaryMocks::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, MapCachedBinaryMocks::mockFstat);
+    VariableBackup<uint32_t> mmapCalledBackup(&NEO::SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> munmapCalledBackup(&NEO::SysCalls::munmapFuncCalled, 0u);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    auto mappedBinary = cache.mapCachedBinary("file1");
+    ASSERT_NE(nullptr, mappedBinary);
+    EXPECT_EQ(1u, NEO::SysCalls::mmapFuncCalled);
+    EXPECT_EQ(static_cast<size_t>(MapCachedBinaryMocks::cacheFileSize), mappedBinary->getData().size());
+    EXPECT_NE(nullptr, mappedBinary->getData().begin());
+
+    mappedBinary.reset();
+    EXPECT_EQ(1u, NEO::SysCalls::munmapFuncCalled);
+}
+
+TEST(CompilerCacheTests, GivenMissingOrEmptyCacheFileWhenMapCachedBinaryIsCalledThenNullptrIsReturnedWithoutMapping) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, CacheIndexMocks::mockOpenIndexMissing);
+    VariableBackup<uint32_t> mmapCalledBackup(&NEO::SysCalls::mmapFuncCalled, 0u);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ(nullptr, cache.mapCachedBinary("file1"));
+
+    NEO::SysCalls::sysCallsOpen = MapCachedBinaryMocks::mockOpen;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        buf->st_size = 0;
+        return 0;
+    });
+    EXPECT_EQ(nullptr, cache.mapCachedBinary("file1"));
+    EXPECT_EQ(0u, NEO::SysCalls::mmapFuncCalled);
+}
+
+TEST(CompilerCacheTests, GivenFailingMmapWhenMapCachedBinaryIsCalledThenNullptrIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, MapCachedBinaryMocks::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, MapCachedBinaryMocks::mockFstat);
+    VariableBackup<bool> failMmapBackup(&NEO::SysCalls::failMmap, true);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ(nullptr, cache.mapCachedBinary("file1"));
+}
+
+namespace TouchRecordMocks {
+constexpr int configFd = 80;
+bool configFileExists = true;
+
+decltype(NEO::SysCalls::sysCallsOpen) mockOpen = [](const char *pathname, int flags) -> int {
+    std::string_view path(pathname);
+    if (path.find("config.file") != std::string_view::npos) {
+        return configFileExists ? configFd : -1;
+    }
+    if (path.find(CompilerCacheIndex::indexFileName) != std::string_view::npos) {
+        return CacheIndexMocks::indexFd;
+    }
+    return MapCachedBinaryMocks::mockOpen(pathname, flags);
+};
+} // namespace TouchRecordMocks
+
+TEST(CompilerCacheTests, GivenExistingConfigFileWhenMapCachedBinaryIsCalledThenTouchRecordIsAppendedUnderConfigFileLock) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, TouchRecordMocks::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, MapCachedBinaryMocks::mockFstat);
+    VariableBackup<bool> configFileExistsBackup(&TouchRecordMocks::configFileExists, true);
+    VariableBackup<int> flockCalledBackup(&NEO::SysCalls::flockCalled, 0);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    auto mappedBinary = cache.mapCachedBinary("file1");
+    ASSERT_NE(nullptr, mappedBinary);
+
+    EXPECT_EQ(CompilerCacheIndex::createTouchRecord("file1.cl_cache"), CacheIndexMocks::writtenContent);
+    EXPECT_EQ(2, NEO::SysCalls::flockCalled);
+    EXPECT_TRUE(CacheIndexMocks::renamedFiles.empty());
+}
+
+TEST(CompilerCacheTests, GivenExistingConfigFileWhenMapCachedBinaryIsCalledThenConfigFileLockIsNotWaitedFor) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, TouchRecordMocks::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, MapCachedBinaryMocks::mockFstat);
+    VariableBackup<bool> configFileExistsBackup(&TouchRecordMocks::configFileExists, true);
+    VariableBackup<int> flockCalledBackup(&NEO::SysCalls::flockCalled, 0);
+    VariableBackup<int> flockOperationPassedBackup(&NEO::SysCalls::flockOperationPassed, 0);
+    VariableBackup<int> flockRetValBackup(&NEO::SysCalls::flockRetVal, -1);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_NE(nullptr, cache.mapCachedBinary("file1"));
+
+    EXPECT_EQ(1, NEO::SysCalls::flockCalled);
+    EXPECT_EQ(LOCK_EX | LOCK_NB, NEO::SysCalls::flockOperationPassed);
+    EXPECT_TRUE(CacheIndexMocks::writtenContent.empty());
+}
+
+TEST(CompilerCacheTests, GivenCacheIndexOverCompactionThresholdWhenMapCachedBinaryIsCalledThenIndexIsCompactedAfterTouch) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    CacheIndexMocks::indexContent = std::string(CompilerCacheIndex::header) + CompilerCacheIndex::createAddRecord("file1.cl_cache", 400);
+    const auto touchRecord = CompilerCacheIndex::createTouchRecord("file1.cl_cache");
+    while (CacheIndexMocks::indexContent.size() <= 4 * MemoryConstants::megaByte) {
+        CacheIndexMocks::indexContent += touchRecord;
+    }
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, TouchRecordMocks::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        if (fd == CacheIndexMocks::indexFd) {
+            return CacheIndexMocks::mockFstat(fd, buf);
+        }
+        return MapCachedBinaryMocks::mockFstat(fd, buf);
+    });
+    VariableBackup<bool> configFileExistsBackup(&TouchRecordMocks::configFileExists, true);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_NE(nullptr, cache.mapCachedBinary("file1"));
+
+    EXPECT_EQ(0, NEO::SysCalls::scandirCalled);
+    EXPECT_EQ(touchRecord + std::string(CompilerCacheIndex::header) + CompilerCacheIndex::createAddRecord("file1.cl_cache", 400), CacheIndexMocks::writtenContent);
+    ASSERT_EQ(1u, CacheIndexMocks::renamedFiles.size());
+    EXPECT_NE(std::string::npos, CacheIndexMocks::renamedFiles[0].find(CompilerCacheIndex::indexFileName));
+}
+
+TEST(CompilerCacheTests, GivenMissingOrUnlockableConfigFileWhenMapCachedBinaryIsCalledThenTouchRecordIsNotAppended) {
+    CacheIndexMocks::CacheIndexMocksRestorer mocksRestorer;
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, TouchRecordMocks::mockOpen);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, MapCachedBinaryMocks::mockFstat);
+    VariableBackup<bool> configFileExistsBackup(&TouchRecordMocks::configFileExists, false);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_NE(nullptr, cache.mapCachedBinary("file1"));
+    EXPECT_TRUE(CacheIndexMocks::writtenContent.empty());
+
+    TouchRecordMocks::configFileExists = true;
+    VariableBackup<int> flockRetValBackup(&NEO::SysCalls::flockRetVal, -1);
+    EXPECT_NE(nullptr, cache.mapCachedBinary("file1"));
+    EXPECT_TRUE(CacheIndexMocks::writtenContent.empty());
+}
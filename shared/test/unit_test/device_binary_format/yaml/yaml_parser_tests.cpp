@@ -1,13 +1,15 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -223,7 +225,8 @@ TEST(YamlConsumeNameIdentifier, GivenInvalidNameIdentifierBeginningCharacterThen
         bool isNameIndentifierBeginChar = NEO::Yaml::isNameIdentifierBeginningCharacter(static_cast<char>(c));
         char nameIdentifierStr[] = {static_cast<char>(c), '\0'};
         auto expected = nameIdentifierStr + (isNameIndentifierBeginChar ? 1 : 0);
-        EXPECT_EQ(expected, NEO::Yaml::consumeNameIdentifier(ConstStringRef::fromArray(nameIdentifierStr), nameIdentifierStr)) << c;
+        NEO::Yaml::TokenizerContext context{ConstStringRef::fromArray(nameIdentifierStr)};
+        EXPECT_EQ(expected, NEO::Yaml::consumeNameIdentifier(context)) << c;
     }
 }
 
@@ -233,7 +236,8 @@ TEST(YamlConsumeNameIdentifier, GivenNameIdentifierBeginningCharacterThenConsume
         isNameOrSeparationWhitespaceIndentifierChar |= NEO::Yaml::isSeparationWhitespace(static_cast<char>(c));
         char nameIdentifierStr[] = {'A', static_cast<char>(c)};
         auto expected = nameIdentifierStr + (isNameOrSeparationWhitespaceIndentifierChar ? 2 : 1);
-        EXPECT_EQ(expected, NEO::Yaml::consumeNameIdentifier(ConstStringRef::fromArray(nameIdentifierStr), nameIdentifierStr)) << c;
+        NEO::Yaml::TokenizerContext context{ConstStringRef::fromArray(nameIdentifierStr)};
+        EXPECT_EQ(expected, NEO::Yaml::consumeNameIdentifier(context)) << c;
     }
 }
 
@@ -247,16 +251,20 @@ TEST(YamlConsumeStringLiteral, GivenQuotedStringThenConsumeUntilEndingMarkIsMet)
     ConstStringRef mixedQuoteOuterSingle = "\'abc de\" fg\'ijkl";
     ConstStringRef unterminatedSingleQuote = "\'abc de";
     ConstStringRef unterminatedDoubleQuote = "\"abc de";
+    auto consumeStringLiteral = [](ConstStringRef text) {
+        NEO::Yaml::TokenizerContext context{text};
+        return NEO::Yaml::consumeStringLiteral(context);
+    };
 
-    EXPECT_EQ(notQuoted.begin(), NEO::Yaml::consumeStringLiteral(notQuoted, notQuoted.begin())) << notQuoted.data();
-    EXPECT_EQ(singleQuote.begin() + 11, NEO::Yaml::consumeStringLiteral(singleQuote, singleQuote.begin())) << singleQuote.data();
-    EXPECT_EQ(doubleQuote.begin() + 11, NEO::Yaml::consumeStringLiteral(doubleQuote, doubleQuote.begin())) << doubleQuote.data();
-    EXPECT_EQ(escapeSingleQuote.begin() + 13, NEO::Yaml::consumeStringLiteral(escapeSingleQuote, escapeSingleQuote.begin())) << escapeSingleQuote.data();
-    EXPECT_EQ(escapeDoubleQuote.begin() + 13, NEO::Yaml::consumeStringLiteral(escapeDoubleQuote, escapeDoubleQuote.begin())) << escapeDoubleQuote.data();
-    EXPECT_EQ(mixedQuoteOuterDouble.begin() + 12, NEO::Yaml::consumeStringLiteral(mixedQuoteOuterDouble, mixedQuoteOuterDouble.begin())) << mixedQuoteOuterDouble.data();
-    EXPECT_EQ(mixedQuoteOuterSingle.begin() + 12, NEO::Yaml::consumeStringLiteral(mixedQuoteOuterSingle, mixedQuoteOuterSingle.begin())) << mixedQuoteOuterSingle.data();
-    EXPECT_EQ(unterminatedSingleQuote.begin(), NEO::Yaml::consumeStringLiteral(unterminatedSingleQuote, unterminatedSingleQuote.begin())) << unterminatedSingleQuote.data();
-    EXPECT_EQ(unterminatedDoubleQuote.begin(), NEO::Yaml::consumeStringLiteral(unterminatedDoubleQuote, unterminatedDoubleQuote.begin())) << unterminatedDoubleQuote.data();
+    EXPECT_EQ(notQuoted.begin(), consumeStringLiteral(notQuoted)) << notQuoted.data();
+    EXPECT_EQ(singleQuote.begin() + 11, consumeStringLiteral(singleQuote)) << singleQuote.data();
+    EXPECT_EQ(doubleQuote.begin() + 11, consumeStringLiteral(doubleQuote)) << doubleQuote.data();
+    EXPECT_EQ(escapeSingleQuote.begin() + 13, consumeStringLiteral(escapeSingleQuote)) << escapeSingleQuote.data();
+    EXPECT_EQ(escapeDoubleQuote.begin() + 13, consumeStringLiteral(escapeDoubleQuote)) << escapeDoubleQuote.data();
+    EXPECT_EQ(mixedQuoteOuterDouble.begin() + 12, consumeStringLiteral(mixedQuoteOuterDouble)) << mixedQuoteOuterDouble.data();
+    EXPECT_EQ(mixedQuoteOuterSingle.begin() + 12, consumeStringLiteral(mixedQuoteOuterSingle)) << mixedQuoteOuterSingle.data();
+    EXPECT_EQ(unterminatedSingleQuote.begin(), consumeStringLiteral(unterminatedSingleQuote)) << unterminatedSingleQuote.data();
+    EXPECT_EQ(unterminatedDoubleQuote.begin(), consumeStringLiteral(unterminatedDoubleQuote)) << unterminatedDoubleQuote.data();
 }
 
 TEST(YamlToken, WhenConstructedThenSetsUpProperDefaults) {
@@ -1118,6 +1126,89 @@ TEST(YamlTokenize, GivenHexadecimalNumbersThenTokenizesThemProperly) {
     }
 }
 
+TEST(YamlCharacterClassMasks, givenAnyCharacterAtAnyPositionWhenClassifyingBlockThenSelectedImplementationMatchesScalarReference) {
+    char block[CharacterClassMasks::blockSize];
+    for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c) {
+        for (auto i = 0u; i < CharacterClassMasks::blockSize; ++i) {
+            block[i] = static_cast<char>(c + i);
+        }
+        CharacterClassMasks expected;
+        CharacterClassMasks::classifyScalar(block, expected);
+        CharacterClassMasks selected;
+        CharacterClassMasks::classify(block, selected);
+        EXPECT_EQ(expected.newline, selected.newline) << c;
+        EXPECT_EQ(expected.space, selected.space) << c;
+        EXPECT_EQ(expected.nameIdentifier, selected.nameIdentifier) << c;
+        EXPECT_EQ(expected.singleQuote, selected.singleQuote) << c;
+        EXPECT_EQ(expected.doubleQuote, selected.doubleQuote) << c;
+    }
+
+    std::memset(block, ' ', sizeof(block));
+    block[0] = '\n';
+    block[5] = '\'';
+    block[31] = '"';
+    block[7] = 'a';
+    CharacterClassMasks masks;
+    CharacterClassMasks::classifyScalar(block, masks);
+    EXPECT_EQ(1u, masks.newline);
+    EXPECT_EQ(1u << 5, masks.singleQuote);
+    EXPECT_EQ(1u << 31, masks.doubleQuote);
+    EXPECT_EQ(~((1u << 0) | (1u << 5) | (1u << 7) | (1u << 31)), masks.space);
+    EXPECT_EQ(~((1u << 0) | (1u << 5) | (1u << 31)), masks.nameIdentifier);
+}
+
+TEST(YamlTokenize, givenRunsCrossingClassificationBlocksWhenTokenizingThenTokensAndLinesAreSameAsForScalarClassification) {
+    std::string yaml = "# " + std::string(70, 'c') + "\n";
+    yaml += "kernels:\n";
+    yaml += std::string(40, ' ') + "- name : " + std::string(45, 'k') + "_with-long.identifier and spaces\n";
+    yaml += std::string(33, ' ') + "  str : '" + std::string(40, 's') + "\\' still string'\n";
+    yaml += "  dstr : \"" + std::string(31, 'd') + "\"\n";
+    yaml += "  arr : [ 1, 2,    3 ]\n";
+    yaml += "  tabs :\t\tvalue\n";
+    yaml += "  last : " + std::string(29, 'x');
+
+    for (size_t textSize : {yaml.size(), yaml.size() - 1, yaml.size() - 17}) {
+        ConstStringRef text(yaml.data(), textSize);
+        NEO::Yaml::LinesCache selectedLines;
+        NEO::Yaml::TokensCache selectedTokens;
+        std::string selectedErrors, selectedWarnings;
+        bool selectedSuccess = NEO::Yaml::tokenize(text, selectedLines, selectedTokens, selectedErrors, selectedWarnings);
+
+        VariableBackup<CharacterClassMasks::ClassifyFunc> classifyBackup(&CharacterClassMasks::classify, CharacterClassMasks::classifyScalar);
+        NEO::Yaml::LinesCache scalarLines;
+        NEO::Yaml::TokensCache scalarTokens;
+        std::string scalarErrors, scalarWarnings;
+        bool scalarSuccess = NEO::Yaml::tokenize(text, scalarLines, scalarTokens, scalarErrors, scalarWarnings);
+
+        EXPECT_EQ(scalarSuccess, selectedSuccess);
+        EXPECT_EQ(scalarErrors, selectedErrors);
+        EXPECT_EQ(scalarWarnings, selectedWarnings);
+        ASSERT_EQ(scalarTokens.size(), selectedTokens.size());
+        for (size_t i = 0; i < scalarTokens.size(); ++i) {
+            EXPECT_EQ(scalarTokens[i].pos, selectedTokens[i].pos) << i;
+            EXPECT_EQ(scalarTokens[i].len, selectedTokens[i].len) << i;
+            EXPECT_EQ(scalarTokens[i].traits.type, selectedTokens[i].traits.type) << i;
+        }
+        ASSERT_EQ(scalarLines.size(), selectedLines.size());
+        for (size_t i = 0; i < scalarLines.size(); ++i) {
+            EXPECT_EQ(scalarLines[i].lineType, selectedLines[i].lineType) << i;
+            EXPECT_EQ(scalarLines[i].indent, selectedLines[i].indent) << i;
+            EXPECT_EQ(scalarLines[i].first, selectedLines[i].first) << i;
+            EXPECT_EQ(scalarLines[i].last, selectedLines[i].last) << i;
+        }
+    }
+
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string errors, warnings;
+    ASSERT_TRUE(NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings));
+    EXPECT_EQ(40u, lines[2].indent);
+    EXPECT_EQ(35u, lines[3].indent);
+    EXPECT_EQ(" " + std::string(70, 'c'), tokens[1].cstrref().str());
+    EXPECT_EQ(std::string(45, 'k') + "_with-long.identifier and spaces", tokens[lines[2].first + 3].cstrref().str());
+    EXPECT_EQ("'" + std::string(40, 's') + "\\' still string'", tokens[lines[3].first + 2].cstrref().str());
+}
+
 TEST(YamlParserReadValueCheckedInt64, GivenHexadecimalIntegerThenParsesItCorrectly) {
     ConstStringRef yaml = "hex_value : 0x123456789ABCDEF";
     int64_t expectedInt64 = 0x123456789ABCDEF;
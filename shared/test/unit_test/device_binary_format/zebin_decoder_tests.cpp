@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/worker_threads.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
@@ -3541,6 +3542,93 @@ kernels:
     EXPECT_EQ(DeviceBinaryFormat::zebin, programInfo.kernelInfos[1]->kernelDescriptor.kernelAttributes.binaryFormat);
 }
 
+namespace {
+std::string createZeInfoWithKernels(size_t kernelsCount, size_t invalidKernelId) {
+    std::string zeinfo = std::string("version :\'") + versionToString(Zebin::ZeInfo::zeInfoDecoderVersion) + "\'\nkernels:\n";
+    for (auto kernelId = 0u; kernelId < kernelsCount; kernelId++) {
+        if (kernelId == invalidKernelId) {
+            zeinfo += "    - name : invalid_kernel\n      execution_env :\n        simd_size : not_a_number\n";
+            continue;
+        }
+        zeinfo += "    - name : kernel_" + std::to_string(kernelId) + "\n      execution_env :\n        simd_size : " + std::to_string((kernelId % 2) ? 16 : 32) + "\n";
+        if (kernelId % 3 == 0) {
+            zeinfo += "        unknown_attribute_" + std::to_string(kernelId) + " : 1\n";
+        }
+    }
+    return zeinfo;
+}
+} // namespace
+
+TEST(DecodeZeInfoKernels, givenZeInfoDecodeThreadsWhenDecodingManyKernelsThenKernelsErrorsAndWarningsMatchSerialDecoding) {
+    DebugManagerStateRestore dbgRestore;
+    debugManager.flags.IgnoreZebinUnknownAttributes.set(true);
+    auto zeinfo = createZeInfoWithKernels(97, std::numeric_limits<size_t>::max());
+
+    NEO::ProgramInfo serialProgramInfo;
+    std::string serialErrors, serialWarnings;
+    auto serialError = Zebin::ZeInfo::decodeZeInfo(serialProgramInfo, zeinfo, serialErrors, serialWarnings);
+    EXPECT_EQ(NEO::DecodeError::success, serialError);
+    EXPECT_FALSE(serialWarnings.empty());
+
+    for (auto threadsCount : {2, 4, 200}) {
+        debugManager.flags.ZeInfoDecodeThreads.set(threadsCount);
+        NEO::ProgramInfo parallelProgramInfo;
+        std::string parallelErrors, parallelWarnings;
+        auto parallelError = Zebin::ZeInfo::decodeZeInfo(parallelProgramInfo, zeinfo, parallelErrors, parallelWarnings);
+        EXPECT_EQ(serialError, parallelError);
+        EXPECT_EQ(serialErrors, parallelErrors);
+        EXPECT_EQ(serialWarnings, parallelWarnings);
+
+        ASSERT_EQ(serialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+        for (auto i = 0u; i < serialProgramInfo.kernelInfos.size(); i++) {
+            auto &serialDescriptor = serialProgramInfo.kernelInfos[i]->kernelDescriptor;
+            auto &parallelDescriptor = parallelProgramInfo.kernelInfos[i]->kernelDescriptor;
+            EXPECT_EQ(serialDescriptor.kernelMetadata.kernelName, parallelDescriptor.kernelMetadata.kernelName);
+            EXPECT_EQ(serialDescriptor.kernelAttributes.simdSize, parallelDescriptor.kernelAttributes.simdSize);
+            EXPECT_EQ(DeviceBinaryFormat::zebin, parallelDescriptor.kernelAttributes.binaryFormat);
+        }
+    }
+}
+
+TEST(DecodeZeInfoKernels, givenZeInfoDecodeThreadsAndInvalidKernelWhenDecodingThenFirstErrorAndPrecedingWarningsAreReportedAsInSerialDecoding) {
+    DebugManagerStateRestore dbgRestore;
+    debugManager.flags.IgnoreZebinUnknownAttributes.set(true);
+    auto zeinfo = createZeInfoWithKernels(64, 20);
+
+    NEO::ProgramInfo serialProgramInfo;
+    std::string serialErrors, serialWarnings;
+    auto serialError = Zebin::ZeInfo::decodeZeInfo(serialProgramInfo, zeinfo, serialErrors, serialWarnings);
+    EXPECT_EQ(NEO::DecodeError::invalidBinary, serialError);
+    EXPECT_EQ(20u, serialProgramInfo.kernelInfos.size());
+    EXPECT_EQ(std::string::npos, serialWarnings.find("unknown_attribute_21"));
+
+    debugManager.flags.ZeInfoDecodeThreads.set(8);
+    NEO::ProgramInfo parallelProgramInfo;
+    std::string parallelErrors, parallelWarnings;
+    auto parallelError = Zebin::ZeInfo::decodeZeInfo(parallelProgramInfo, zeinfo, parallelErrors, parallelWarnings);
+    EXPECT_EQ(serialError, parallelError);
+    EXPECT_EQ(serialErrors, parallelErrors);
+    EXPECT_EQ(serialWarnings, parallelWarnings);
+    EXPECT_EQ(serialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+}
+
+TEST(DecodeZeInfoKernels, whenGettingKernelsDecodeThreadsCountThenValueIsBoundedByDebugFlagKernelsCountAndWorkerThreadsLimit) {
+    DebugManagerStateRestore dbgRestore;
+    EXPECT_EQ(1u, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(100));
+
+    debugManager.flags.ZeInfoDecodeThreads.set(1);
+    EXPECT_EQ(1u, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(100));
+
+    debugManager.flags.ZeInfoDecodeThreads.set(8);
+    EXPECT_EQ(8u, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(100));
+    EXPECT_EQ(3u, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(3));
+    EXPECT_EQ(1u, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(1));
+
+    debugManager.flags.ZeInfoDecodeThreads.set(200);
+    EXPECT_EQ(maxWorkerThreadsCount, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(100));
+    EXPECT_EQ(3u, Zebin::ZeInfo::getZeInfoKernelsDecodeThreadsCount(3));
+}
+
 TEST(DecodeSingleDeviceBinaryZebin, GivenValidZeInfoAndExternalFunctionsMetadataThenPopulatesExternalFunctionMetadataProperly) {
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &gfxCoreHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::GfxCoreHelper>();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,8 +11,11 @@
 
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::adaptiveIdleDetection;
+    using DirectSubmissionController::adaptiveSleepValue;
     using DirectSubmissionController::bcsTimeoutDivisor;
     using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::checkNewSubmissionsAdaptive;
     using DirectSubmissionController::condVarMutex;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
@@ -24,6 +27,8 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::lowestThrottleSubmitted;
     using DirectSubmissionController::maxTimeout;
     using DirectSubmissionController::pagingFenceRequests;
+    using DirectSubmissionController::restartedRings;
+    using DirectSubmissionController::ringRestartNotified;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
     using DirectSubmissionController::timeSinceLastCheck;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2025 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -337,6 +337,197 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenCheckTi
     EXPECT_EQ(TimeoutElapsedMode::notElapsed, controller.timeoutElapsed());
 }
 
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdleDetectionDebugFlagWhenCreateObjectThenAdaptiveIdleDetectionIsSet) {
+    DebugManagerStateRestore restorer;
+    DirectSubmissionControllerMock defaultController;
+    EXPECT_FALSE(defaultController.adaptiveIdleDetection);
+
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.set(1);
+    DirectSubmissionControllerMock controller;
+    EXPECT_TRUE(controller.adaptiveIdleDetection);
+    EXPECT_EQ(DirectSubmissionController::adaptiveIdleSleepTimeout, controller.getSleepValue());
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdleDetectionWhenRingTimeoutElapsesThenOnlyThatRingIsStoppedAndSleepValueIsNearestDeadline) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.set(1);
+    debugManager.flags.DirectSubmissionControllerIdleDetection.set(0);
+    debugManager.flags.DirectSubmissionControllerTimeout.set(100);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+    MockCommandStreamReceiver csr1(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext1(OsContext::create(nullptr, 0, 0,
+                                                            EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS1, EngineUsage::regular},
+                                                                                                         PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr1.setupContext(*osContext1.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.cpuTimestamp = SteadyClock::time_point{std::chrono::seconds(1)};
+    controller.registerDirectSubmission(&csr);
+    controller.registerDirectSubmission(&csr1);
+
+    csr.taskCount.store(5u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_TRUE(controller.directSubmissions[&csr1].isStopped);
+    EXPECT_EQ(std::chrono::microseconds(100), controller.getSleepValue());
+
+    controller.cpuTimestamp += std::chrono::microseconds(60);
+    csr1.taskCount.store(3u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_FALSE(controller.directSubmissions[&csr1].isStopped);
+    EXPECT_EQ(std::chrono::microseconds(40), controller.getSleepValue());
+
+    controller.cpuTimestamp += std::chrono::microseconds(40);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_FALSE(controller.directSubmissions[&csr1].isStopped);
+    EXPECT_EQ(std::chrono::microseconds(60), controller.getSleepValue());
+
+    controller.cpuTimestamp += std::chrono::microseconds(60);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_TRUE(controller.directSubmissions[&csr1].isStopped);
+    EXPECT_EQ(DirectSubmissionController::adaptiveIdleSleepTimeout, controller.getSleepValue());
+
+    controller.checkNewSubmissions();
+    EXPECT_EQ(5u, controller.getWakeupsCount());
+    EXPECT_EQ(1u, controller.getIdleWakeupsCount());
+
+    controller.unregisterDirectSubmission(&csr);
+    controller.unregisterDirectSubmission(&csr1);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdleDetectionWhenRingIsRestartedShortlyAfterStopThenRingTimeoutIsIncreased) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.set(1);
+    debugManager.flags.DirectSubmissionControllerIdleDetection.set(0);
+    debugManager.flags.DirectSubmissionControllerTimeout.set(100);
+    debugManager.flags.DirectSubmissionControllerMaxTimeout.set(1000);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.cpuTimestamp = SteadyClock::time_point{std::chrono::seconds(1)};
+    controller.registerDirectSubmission(&csr);
+
+    csr.taskCount.store(5u);
+    controller.checkNewSubmissions();
+    controller.cpuTimestamp += std::chrono::microseconds(100);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(std::chrono::microseconds(100), controller.directSubmissions[&csr].timeout);
+
+    controller.cpuTimestamp += std::chrono::microseconds(200);
+    csr.taskCount.store(6u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(std::chrono::microseconds(300), controller.directSubmissions[&csr].timeout);
+    EXPECT_EQ(std::chrono::microseconds(300), controller.getSleepValue());
+
+    controller.cpuTimestamp += std::chrono::microseconds(300);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    controller.cpuTimestamp += std::chrono::seconds(1);
+    csr.taskCount.store(7u);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(std::chrono::microseconds(100), controller.directSubmissions[&csr].timeout);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdleDetectionWhenNotifyRingRestartThenControllerIsWokenUp) {
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, DeviceBitfield(1))));
+    DirectSubmissionControllerMock defaultController;
+    defaultController.notifyRingRestart(*osContext);
+    EXPECT_EQ(1u, defaultController.getRingRestartsCount());
+    EXPECT_FALSE(defaultController.ringRestartNotified);
+    EXPECT_TRUE(defaultController.restartedRings.empty());
+
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.set(1);
+    DirectSubmissionControllerMock controller;
+    controller.notifyRingRestart(*osContext);
+    controller.notifyRingRestart(*osContext);
+    EXPECT_EQ(2u, controller.getRingRestartsCount());
+    EXPECT_TRUE(controller.ringRestartNotified);
+    ASSERT_EQ(1u, controller.restartedRings.size());
+    EXPECT_EQ(osContext.get(), controller.restartedRings[0]);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveIdleDetectionWhenRingRestartIsNotifiedBeforeTaskCountIsUpdatedThenRingIsMarkedActiveAndDeadlineIsArmed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerAdaptiveIdleDetection.set(1);
+    debugManager.flags.DirectSubmissionControllerIdleDetection.set(0);
+    debugManager.flags.DirectSubmissionControllerTimeout.set(100);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.cpuTimestamp = SteadyClock::time_point{std::chrono::seconds(1)};
+    controller.registerDirectSubmission(&csr);
+
+    csr.taskCount.store(5u);
+    controller.checkNewSubmissions();
+    controller.cpuTimestamp += std::chrono::microseconds(100);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(DirectSubmissionController::adaptiveIdleSleepTimeout, controller.getSleepValue());
+
+    controller.cpuTimestamp += std::chrono::seconds(2);
+    controller.notifyRingRestart(*osContext);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_TRUE(controller.restartedRings.empty());
+    EXPECT_EQ(std::chrono::microseconds(100), controller.getSleepValue());
+
+    csr.taskCount.store(6u);
+    controller.cpuTimestamp += std::chrono::microseconds(50);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(6u, controller.directSubmissions[&csr].taskCount);
+
+    controller.cpuTimestamp += std::chrono::microseconds(100);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 struct TagUpdateMockCommandStreamReceiver : public MockCommandStreamReceiver {
 
     TagUpdateMockCommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex, const DeviceBitfield deviceBitfield)
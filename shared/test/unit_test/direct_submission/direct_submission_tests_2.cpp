@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2025 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/direct_submission/direct_submission_publish_scope.h"
 #include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
@@ -35,6 +36,8 @@
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/unit_test/fixtures/direct_submission_fixture.h"
 
+#include <thread>
+
 namespace CpuIntrinsicsTests {
 extern std::atomic<uint32_t> sfenceCounter;
 extern std::atomic<uint32_t> mfenceCounter;
@@ -334,6 +337,166 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenCopyCommandBufferIntoRingWhenD
     EXPECT_EQ(nullptr, bbStart);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenMultiProducerAppendDebugFlagWhenDirectSubmissionIsCreatedThenMultiProducerAppendIsSet) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    MockDirectSubmissionHw<FamilyType, Dispatcher> defaultDirectSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_FALSE(defaultDirectSubmission.multiProducerAppend);
+
+    debugManager.flags.DirectSubmissionMultiProducerAppend.set(1);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.multiProducerAppend);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenMultiProducerAppendWhenCommandBufferCannotBeCopiedIntoRingThenDispatchIsNotReserved) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionMultiProducerAppend.set(1);
+    debugManager.flags.DirectSubmissionRelaxedOrdering.set(0);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true));
+
+    EXPECT_FALSE(directSubmission.copyCommandBufferIntoRing(batchBuffer));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(0u, directSubmission.reservedDispatches);
+    EXPECT_EQ(2u, directSubmission.currentQueueWorkCount);
+
+    debugManager.flags.DirectSubmissionFlatRingBuffer.set(-1);
+    batchBuffer.endCmdPtr = batchBuffer.stream->getCpuBase();
+    EXPECT_TRUE(directSubmission.copyCommandBufferIntoRing(batchBuffer));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, directSubmission.reservedDispatches);
+    EXPECT_EQ(1u, directSubmission.publishedDispatches.load());
+    EXPECT_EQ(3u, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(2u, directSubmission.semaphoreData->queueWorkCount);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenMultiProducerAppendAndPublishScopeWhenCommandBufferIsDispatchedThenCopyAndSemaphoreReleaseAreDeferredToScope) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionFlatRingBuffer.set(-1);
+    debugManager.flags.DirectSubmissionMultiProducerAppend.set(1);
+    debugManager.flags.DirectSubmissionRelaxedOrdering.set(0);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true));
+
+    batchBuffer.endCmdPtr = ptrOffset(batchBuffer.stream->getCpuBase(), batchBuffer.stream->getUsed() - sizeof(MI_BATCH_BUFFER_START));
+    ASSERT_TRUE(directSubmission.copyCommandBufferIntoRing(batchBuffer));
+
+    {
+        DirectSubmissionPublishScope publishScope;
+        EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+        EXPECT_EQ(1u, directSubmission.reservedDispatches);
+        EXPECT_EQ(0u, directSubmission.publishedDispatches.load());
+        EXPECT_EQ(0u, directSubmission.semaphoreData->queueWorkCount);
+
+        {
+            DirectSubmissionPublishScope nestedPublishScope;
+        }
+        EXPECT_EQ(0u, directSubmission.publishedDispatches.load());
+
+        EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+        EXPECT_EQ(2u, directSubmission.reservedDispatches);
+        EXPECT_EQ(1u, directSubmission.publishedDispatches.load());
+        EXPECT_EQ(1u, directSubmission.semaphoreData->queueWorkCount);
+    }
+    EXPECT_EQ(2u, directSubmission.publishedDispatches.load());
+    EXPECT_EQ(2u, directSubmission.semaphoreData->queueWorkCount);
+}
+
+namespace {
+thread_local bool producerOwnsCsr = false;
+
+template <typename GfxFamily, typename Dispatcher>
+struct MultiProducerMockDirectSubmissionHw : public MockDirectSubmissionHw<GfxFamily, Dispatcher> {
+    using BaseClass = MockDirectSubmissionHw<GfxFamily, Dispatcher>;
+    using BaseClass::BaseClass;
+
+    void publishReservation(const RingReservation &reservation) override {
+        if (producerOwnsCsr) {
+            publishedUnderCsrOwnership++;
+        }
+        BaseClass::publishReservation(reservation);
+    }
+
+    std::atomic<uint32_t> publishedUnderCsrOwnership{0u};
+};
+} // namespace
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenMultiProducerAppendWhenProducersDispatchConcurrentlyUnderCsrOwnershipThenRingIsPublishedInOrderAfterOwnershipIsReleased) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionFlatRingBuffer.set(-1);
+    debugManager.flags.DirectSubmissionMultiProducerAppend.set(1);
+    debugManager.flags.DirectSubmissionRelaxedOrdering.set(0);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MultiProducerMockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(csr);
+    EXPECT_TRUE(directSubmission.initialize(true));
+    size_t sizeUsed = directSubmission.ringCommandStream.getUsed();
+
+    memset(batchBuffer.stream->getCpuBase(), 0, batchBuffer.stream->getUsed());
+    batchBuffer.endCmdPtr = ptrOffset(batchBuffer.stream->getCpuBase(), batchBuffer.stream->getUsed() - sizeof(MI_BATCH_BUFFER_START));
+    ASSERT_TRUE(directSubmission.copyCommandBufferIntoRing(batchBuffer));
+
+    constexpr uint32_t producersCount = 8u;
+    constexpr uint32_t dispatchesPerProducer = 16u;
+    std::atomic<uint32_t> failedDispatches{0u};
+    std::vector<std::thread> producers;
+    for (uint32_t i = 0; i < producersCount; i++) {
+        producers.emplace_back([&]() {
+            BatchBuffer producerBatchBuffer = batchBuffer;
+            FlushStampTracker flushStamp(true);
+            for (uint32_t j = 0; j < dispatchesPerProducer; j++) {
+                DirectSubmissionPublishScope publishScope;
+                auto csrOwnership = csr.obtainUniqueOwnership();
+                producerOwnsCsr = true;
+                if (!directSubmission.dispatchCommandBuffer(producerBatchBuffer, flushStamp)) {
+                    failedDispatches++;
+                }
+                producerOwnsCsr = false;
+                csrOwnership.unlock();
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    constexpr uint32_t dispatchesCount = producersCount * dispatchesPerProducer;
+    EXPECT_EQ(0u, failedDispatches.load());
+    EXPECT_EQ(0u, directSubmission.publishedUnderCsrOwnership.load());
+    EXPECT_EQ(dispatchesCount, directSubmission.reservedDispatches);
+    EXPECT_EQ(dispatchesCount, directSubmission.publishedDispatches.load());
+    EXPECT_EQ(dispatchesCount + 1, directSubmission.currentQueueWorkCount);
+    EXPECT_EQ(dispatchesCount, directSubmission.semaphoreData->queueWorkCount);
+    EXPECT_EQ(1u, directSubmission.submitCount);
+    ASSERT_EQ(0u, directSubmission.currentRingBuffer);
+
+    HardwareParse hwParse;
+    hwParse.parseCommands<FamilyType>(directSubmission.ringCommandStream, sizeUsed);
+    uint32_t expectedSemaphoreValue = 2u;
+    for (auto &cmd : hwParse.cmdList) {
+        auto semaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(cmd);
+        if (semaphore && semaphore->getSemaphoreGraphicsAddress() == directSubmission.semaphoreGpuVa) {
+            EXPECT_EQ(expectedSemaphoreValue, semaphore->getSemaphoreDataDword());
+            expectedSemaphoreValue++;
+        }
+    }
+    EXPECT_EQ(dispatchesCount + 2, expectedSemaphoreValue);
+}
+
 HWTEST_F(DirectSubmissionDispatchBufferTest, givenDefaultDirectSubmissionFlatRingBufferAndSingleTileDirectSubmissionWhenSubmitSystemMemNotChainedBatchBufferWithoutRelaxingDependenciesThenCopyIntoRing) {
     using Dispatcher = RenderDispatcher<FamilyType>;
 
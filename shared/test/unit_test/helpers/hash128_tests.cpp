@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<char> createHashInput(size_t size) {
+    std::vector<char> input(size);
+    uint32_t state = 0x12345678u;
+    for (auto &byte : input) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<char>(state >> 24);
+    }
+    return input;
+}
+} // namespace
+
+TEST(Hash128Tests, givenSameInputWhenHashIsCalculatedThenSameValueIsReturned) {
+    auto input = createHashInput(3000);
+    EXPECT_EQ(Hash128::hash(input.data(), input.size()), Hash128::hash(input.data(), input.size()));
+}
+
+TEST(Hash128Tests, givenInputsDifferingOnlyByTrailingZerosWhenHashIsCalculatedThenValuesAreDifferent) {
+    std::vector<char> input(Hash128::stripeSize + 1, 0);
+    auto emptyHash = Hash128::hash(input.data(), 0);
+    Hash128Value previousHash = emptyHash;
+    for (auto size = 1u; size <= input.size(); size++) {
+        auto currentHash = Hash128::hash(input.data(), size);
+        EXPECT_NE(emptyHash, currentHash) << size;
+        EXPECT_NE(previousHash, currentHash) << size;
+        previousHash = currentHash;
+    }
+}
+
+TEST(Hash128Tests, givenSingleBitFlippedWhenHashIsCalculatedThenBothHalvesChange) {
+    auto input = createHashInput(5 * Hash128::stripeSize * Hash128::stripesPerBlock + 17);
+    auto baseHash = Hash128::hash(input.data(), input.size());
+    for (auto position : {size_t{0}, size_t{63}, size_t{64}, size_t{1024}, input.size() - 1}) {
+        input[position] ^= 1;
+        auto modifiedHash = Hash128::hash(input.data(), input.size());
+        input[position] ^= 1;
+        EXPECT_NE(baseHash.high, modifiedHash.high) << position;
+        EXPECT_NE(baseHash.low, modifiedHash.low) << position;
+    }
+}
+
+TEST(Hash128Tests, givenSwappedStripesWhenHashIsCalculatedThenValuesAreDifferent) {
+    auto input = createHashInput(4 * Hash128::stripeSize);
+    auto baseHash = Hash128::hash(input.data(), input.size());
+    std::swap_ranges(input.begin(), input.begin() + Hash128::stripeSize, input.begin() + Hash128::stripeSize);
+    EXPECT_NE(baseHash, Hash128::hash(input.data(), input.size()));
+}
+
+TEST(Hash128Tests, givenInputSplitIntoMultipleUpdatesWhenHashIsCalculatedThenValueMatchesSingleUpdate) {
+    auto input = createHashInput(3 * Hash128::stripeSize * Hash128::stripesPerBlock + 45);
+    auto expectedHash = Hash128::hash(input.data(), input.size());
+
+    for (auto chunkSize : {size_t{1}, size_t{3}, size_t{63}, size_t{64}, size_t{65}, size_t{1000}}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < input.size(); offset += chunkSize) {
+            hash.update(input.data() + offset, std::min(chunkSize, input.size() - offset));
+        }
+        EXPECT_EQ(expectedHash, hash.finish()) << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenNullptrWhenUpdateIsCalledThenStateIsNotChanged) {
+    Hash128 hash;
+    auto emptyHash = hash.finish();
+    hash.update(nullptr, 10);
+    EXPECT_EQ(emptyHash, hash.finish());
+}
+
+TEST(Hash128Tests, givenHashAfterResetWhenHashIsCalculatedThenValueMatchesFreshHash) {
+    auto input = createHashInput(200);
+    Hash128 hash;
+    hash.update(input.data(), 100);
+    hash.reset();
+    hash.update(input.data(), input.size());
+    EXPECT_EQ(Hash128::hash(input.data(), input.size()), hash.finish());
+}
+
+TEST(Hash128Tests, givenSelectedStripeAccumulationWhenComparedWithScalarReferenceThenResultsAreIdentical) {
+    auto input = createHashInput(7 * Hash128::stripeSize * Hash128::stripesPerBlock + 33);
+    auto selectedHash = Hash128::hash(input.data(), input.size());
+
+    VariableBackup<Hash128::AccumulateStripesFunc> accumulateStripesBackup(&Hash128::accumulateStripes, Hash128::accumulateStripesScalar);
+    EXPECT_EQ(selectedHash, Hash128::hash(input.data(), input.size()));
+}
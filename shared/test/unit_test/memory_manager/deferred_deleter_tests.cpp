@@ -1,16 +1,45 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/memory_manager/deferrable_deletion.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_deferred_deleter.h"
 
 #include "gtest/gtest.h"
 
 using namespace NEO;
 
+namespace {
+struct ControlledDeferrableDeletion : public DeferrableDeletion {
+    ControlledDeferrableDeletion(bool isHostptr, int &appliedCount) : appliedCount(appliedCount) {
+        externalHostptr = isHostptr;
+    }
+    bool apply() override {
+        applyCalled++;
+        if (canBeApplied) {
+            appliedCount++;
+        }
+        return canBeApplied;
+    }
+    int &appliedCount;
+    int applyCalled = 0;
+    bool canBeApplied = true;
+};
+
+struct BatchedDeferredDeleter : public DeferredDeleter {
+    using DeferredDeleter::elementsToRelease;
+    using DeferredDeleter::hostptrQueue;
+    using DeferredDeleter::hostptrsToRelease;
+    using DeferredDeleter::maxDeferralLatencyUs;
+    using DeferredDeleter::processDeletions;
+    using DeferredDeleter::queue;
+};
+} // namespace
+
 TEST(DeferredDeleter, WhenDeferredDeleterIsCreatedThenItIsNotMoveableOrCopyable) {
     EXPECT_FALSE(std::is_move_constructible<DeferredDeleter>::value);
     EXPECT_FALSE(std::is_copy_constructible<DeferredDeleter>::value);
@@ -43,3 +72,80 @@ TEST(DeferredDeleter, givenDeferredDeleterWhenNonBlockingDrainIsCalledThenArElem
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+TEST(DeferredDeleter, givenDefaultSettingsWhenDeferredDeleterIsCreatedThenMaxDeferralLatencyIsNotSet) {
+    BatchedDeferredDeleter deleter;
+    EXPECT_EQ(-1, deleter.maxDeferralLatencyUs);
+}
+
+TEST(DeferredDeleter, givenMaxLatencyDebugFlagWhenDeferredDeleterIsCreatedThenMaxDeferralLatencyIsSet) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DeferredDeleterMaxLatencyUs.set(250);
+    BatchedDeferredDeleter deleter;
+    EXPECT_EQ(250, deleter.maxDeferralLatencyUs);
+}
+
+TEST(DeferredDeleter, givenHostptrAndNonHostptrDeletionsWhenDeferredThenTheyArePlacedInSeparateQueues) {
+    int appliedCount = 0;
+    BatchedDeferredDeleter deleter;
+    auto deletion = new ControlledDeferrableDeletion(false, appliedCount);
+    auto hostptrDeletion = new ControlledDeferrableDeletion(true, appliedCount);
+
+    deleter.deferDeletion(deletion);
+    deleter.deferDeletion(hostptrDeletion);
+
+    EXPECT_TRUE(deleter.queue.peekContains(*deletion));
+    EXPECT_FALSE(deleter.queue.peekContains(*hostptrDeletion));
+    EXPECT_TRUE(deleter.hostptrQueue.peekContains(*hostptrDeletion));
+    EXPECT_EQ(2, deleter.elementsToRelease);
+    EXPECT_EQ(1, deleter.hostptrsToRelease);
+
+    deleter.drain(true, false);
+    EXPECT_EQ(2, appliedCount);
+    EXPECT_TRUE(deleter.areElementsReleased(false));
+}
+
+TEST(DeferredDeleter, givenNotCompletedDeletionWhenDrainingOnlyHostptrsThenNonHostptrDeletionIsNotApplied) {
+    int appliedCount = 0;
+    BatchedDeferredDeleter deleter;
+    auto deletion = new ControlledDeferrableDeletion(false, appliedCount);
+    deletion->canBeApplied = false;
+    deleter.deferDeletion(deletion);
+    deleter.deferDeletion(new ControlledDeferrableDeletion(true, appliedCount));
+
+    deleter.drain(true, true);
+    EXPECT_EQ(1, appliedCount);
+    EXPECT_EQ(0, deletion->applyCalled);
+    EXPECT_TRUE(deleter.areElementsReleased(true));
+    EXPECT_FALSE(deleter.areElementsReleased(false));
+    EXPECT_TRUE(deleter.queue.peekContains(*deletion));
+
+    deletion->canBeApplied = true;
+    deleter.drain(true, false);
+    EXPECT_EQ(2, appliedCount);
+    EXPECT_TRUE(deleter.areElementsReleased(false));
+}
+
+TEST(DeferredDeleter, givenCompletedAndNotCompletedDeletionsWhenBatchIsProcessedThenCompletedAreReleasedAndRemainingStayInOrder) {
+    int appliedCount = 0;
+    BatchedDeferredDeleter deleter;
+    ControlledDeferrableDeletion *deletions[4];
+    for (auto i = 0; i < 4; i++) {
+        deletions[i] = new ControlledDeferrableDeletion(false, appliedCount);
+        deletions[i]->canBeApplied = (i % 2 == 0);
+        deleter.deferDeletion(deletions[i]);
+    }
+
+    deleter.processDeletions(false);
+    EXPECT_EQ(2, appliedCount);
+    EXPECT_EQ(2, deleter.elementsToRelease);
+    EXPECT_EQ(deletions[1], deleter.queue.peekHead());
+    EXPECT_EQ(deletions[3], deleter.queue.peekTail());
+    EXPECT_EQ(1, deletions[1]->applyCalled);
+
+    deletions[1]->canBeApplied = true;
+    deletions[3]->canBeApplied = true;
+    deleter.drain(true, false);
+    EXPECT_EQ(4, appliedCount);
+    EXPECT_TRUE(deleter.queue.peekIsEmpty());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,16 @@ namespace NEO {
 
 extern ApiSpecificConfig::ApiType apiTypeForUlts;
 
+SVMAllocsManager::SvmCacheAllocationInfo &getCachedAllocation(SVMAllocsManager::SvmAllocationCache &allocationCache, size_t index) {
+    for (auto &bucket : allocationCache.buckets) {
+        if (index < bucket.allocations.size()) {
+            return bucket.allocations[index];
+        }
+        index -= bucket.allocations.size();
+    }
+    return allocationCache.buckets[0].allocations.at(index);
+}
+
 TEST(SortedVectorBasedAllocationTrackerTests, givenSortedVectorBasedAllocationTrackerWhenInsertRemoveAndGetThenStoreDataProperly) {
     SvmAllocationData data(1u);
     SVMAllocsManager::SortedVectorBasedAllocationTracker tracker;
@@ -189,19 +199,19 @@ TEST(SvmAllocationCacheSimpleTest, givenAllocationsWhenInsertingAllocationThenDo
         svmAllocData.isImportedAllocation = false;
         svmAllocData.isInternalAllocation = false;
         EXPECT_TRUE(allocationCache.insert(1u, ptr, &svmAllocData, false));
-        allocationCache.allocations.clear();
+        allocationCache.buckets[0].allocations.clear();
     }
     {
         svmAllocData.isImportedAllocation = true;
         svmAllocData.isInternalAllocation = false;
         EXPECT_FALSE(allocationCache.insert(1u, ptr, &svmAllocData, false));
-        allocationCache.allocations.clear();
+        allocationCache.buckets[0].allocations.clear();
     }
     {
         svmAllocData.isImportedAllocation = false;
         svmAllocData.isInternalAllocation = true;
         EXPECT_FALSE(allocationCache.insert(1u, ptr, &svmAllocData, false));
-        allocationCache.allocations.clear();
+        allocationCache.buckets[0].allocations.clear();
     }
 }
 
@@ -238,7 +248,7 @@ TEST(SvmAllocationCacheSimpleTest, givenAllocationsWhenGettingAllocationThenUpda
         auto allocMapEntry = svmAllocsManager.internalAllocationsMap.find(1u);
         EXPECT_EQ(&gpuGfxAllocation, allocMapEntry->second);
         EXPECT_EQ(0u, svmAllocsManager.internalAllocationsMap.count(2u));
-        allocationCache.allocations.clear();
+        allocationCache.buckets[0].allocations.clear();
         svmAllocsManager.internalAllocationsMap.clear();
     }
 
@@ -258,10 +268,79 @@ TEST(SvmAllocationCacheSimpleTest, givenAllocationsWhenGettingAllocationThenUpda
         EXPECT_EQ(1u, svmAllocsManager.internalAllocationsMap.count(2u));
         auto allocMapEntry = svmAllocsManager.internalAllocationsMap.find(2u);
         EXPECT_EQ(&gpuGfxAllocation, allocMapEntry->second);
-        allocationCache.allocations.clear();
+        allocationCache.buckets[0].allocations.clear();
+    }
+}
+
+TEST(SvmAllocationCacheSimpleTest, givenAllocationSizesWhenGettingSizeClassIndexThenPowerOfTwoSizeClassIsReturned) {
+    using SvmAllocationCache = SVMAllocsManager::SvmAllocationCache;
+    EXPECT_EQ(13u, SvmAllocationCache::sizeClassesCount);
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeClassIndex(1u));
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeClassIndex(MemoryConstants::pageSize64k));
+    EXPECT_EQ(0u, SvmAllocationCache::getSizeClassIndex(2 * MemoryConstants::pageSize64k - 1));
+    EXPECT_EQ(1u, SvmAllocationCache::getSizeClassIndex(2 * MemoryConstants::pageSize64k));
+    EXPECT_EQ(5u, SvmAllocationCache::getSizeClassIndex(2 * MemoryConstants::megaByte + 1));
+    EXPECT_EQ(SvmAllocationCache::sizeClassesCount - 1, SvmAllocationCache::getSizeClassIndex(SvmAllocationCache::maxServicedSize));
+}
+
+TEST(SvmAllocationCacheSimpleTest, givenAllocationsOfDifferentSizesWhenInsertingThenTheyAreStoredInTheirSizeClassBuckets) {
+    SVMAllocsManager::SvmAllocationCache allocationCache;
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmAllocsManager(&memoryManager);
+
+    allocationCache.memoryManager = &memoryManager;
+    allocationCache.svmAllocsManager = &svmAllocsManager;
+    memoryManager.usmReuseInfo.init(1 * MemoryConstants::gigaByte, UsmReuseInfo::notLimited);
+
+    MockGraphicsAllocation gpuGfxAllocations[3];
+    SvmAllocationData svmAllocDatas[3] = {SvmAllocationData(mockRootDeviceIndex), SvmAllocationData(mockRootDeviceIndex), SvmAllocationData(mockRootDeviceIndex)};
+    const size_t sizes[3] = {3 * MemoryConstants::pageSize64k, MemoryConstants::pageSize64k, 4 * MemoryConstants::megaByte};
+    for (auto i = 0u; i < 3u; ++i) {
+        svmAllocDatas[i].gpuAllocations.addAllocation(&gpuGfxAllocations[i]);
+        EXPECT_TRUE(allocationCache.insert(sizes[i], addrToPtr(0x10000ULL * (i + 1)), &svmAllocDatas[i], false));
+    }
+
+    EXPECT_EQ(3u, allocationCache.getAllocationsCount());
+    EXPECT_EQ(1u, allocationCache.buckets[0].allocations.size());
+    EXPECT_EQ(1u, allocationCache.buckets[1].allocations.size());
+    EXPECT_EQ(1u, allocationCache.buckets[6].allocations.size());
+    EXPECT_EQ(MemoryConstants::pageSize64k, getCachedAllocation(allocationCache, 0).allocationSize);
+    EXPECT_EQ(3 * MemoryConstants::pageSize64k, getCachedAllocation(allocationCache, 1).allocationSize);
+    EXPECT_EQ(4 * MemoryConstants::megaByte, getCachedAllocation(allocationCache, 2).allocationSize);
+
+    for (auto &bucket : allocationCache.buckets) {
+        bucket.allocations.clear();
     }
 }
 
+TEST(SvmAllocationCacheSimpleTest, givenAllocationCachedInHigherSizeClassWhenGettingAllocationWithinUtilizationLimitThenItIsReused) {
+    SVMAllocsManager::SvmAllocationCache allocationCache;
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmAllocsManager(&memoryManager);
+
+    allocationCache.memoryManager = &memoryManager;
+    allocationCache.svmAllocsManager = &svmAllocsManager;
+    memoryManager.usmReuseInfo.init(1 * MemoryConstants::gigaByte, UsmReuseInfo::notLimited);
+
+    void *ptr = addrToPtr(0x10000ULL);
+    MockGraphicsAllocation gpuGfxAllocation;
+    SvmAllocationData svmAllocData(mockRootDeviceIndex);
+    svmAllocData.gpuAllocations.addAllocation(&gpuGfxAllocation);
+    EXPECT_TRUE(allocationCache.insert(5 * MemoryConstants::pageSize64k, ptr, &svmAllocData, false));
+    EXPECT_EQ(1u, allocationCache.buckets[2].allocations.size());
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+
+    EXPECT_EQ(nullptr, allocationCache.get(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties));
+    EXPECT_EQ(1u, allocationCache.getAllocationsCount());
+
+    EXPECT_EQ(ptr, allocationCache.get(3 * MemoryConstants::pageSize64k, unifiedMemoryProperties));
+    EXPECT_EQ(0u, allocationCache.getAllocationsCount());
+    EXPECT_EQ(3 * MemoryConstants::pageSize64k, svmAllocData.size);
+}
+
 struct SvmAllocationCacheTestFixture {
     SvmAllocationCacheTestFixture() : executionEnvironment(defaultHwInfo.get()) {}
     void setUp() {
@@ -449,26 +528,26 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDevic
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), ++expectedCacheSize);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), ++expectedCacheSize);
         bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache->allocations.size(); ++i) {
-            if (svmManager->usmDeviceAllocationsCache->allocations[i].allocation == testData.allocation) {
+        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache->getAllocationsCount(); ++i) {
+            if (getCachedAllocation(*svmManager->usmDeviceAllocationsCache, i).allocation == testData.allocation) {
                 foundInCache = true;
                 auto svmData = svmManager->getSVMAlloc(testData.allocation);
                 EXPECT_NE(nullptr, svmData);
-                EXPECT_EQ(svmData, svmManager->usmDeviceAllocationsCache->allocations[i].svmData);
+                EXPECT_EQ(svmData, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, i).svmData);
                 EXPECT_EQ(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getUnderlyingBufferSize(),
-                          svmManager->usmDeviceAllocationsCache->allocations[i].allocationSize);
+                          getCachedAllocation(*svmManager->usmDeviceAllocationsCache, i).allocationSize);
                 break;
             }
         }
         EXPECT_TRUE(foundInCache);
     }
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), testDataset.size());
 
     svmManager->cleanupUSMAllocCaches();
     EXPECT_EQ(nullptr, svmManager->usmDeviceAllocationsCache);
@@ -492,13 +571,13 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingSameP
     ASSERT_NE(allocation, nullptr);
     auto svmData = svmManager->getSVMAlloc(allocation);
 
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
     EXPECT_FALSE(svmData->isSavedForReuse);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
     EXPECT_TRUE(svmData->isSavedForReuse);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
     EXPECT_TRUE(svmData->isSavedForReuse);
 
     svmManager->cleanupUSMAllocCaches();
@@ -531,13 +610,13 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenRequestingSp
     EXPECT_EQ(reinterpret_cast<void *>(0xff0000), allocation);
 
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
 
     unifiedMemoryProperties.alignment = MemoryConstants::pageSize2M;
     EXPECT_FALSE(SVMAllocsManager::SvmAllocationCache::alignmentAllows(allocation, unifiedMemoryProperties.alignment));
     auto differentAlignmentAlloc = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_NE(differentAlignmentAlloc, allocation);
-    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
     svmManager->freeSVMAlloc(differentAlignmentAlloc);
 
     svmManager->cleanupUSMAllocCaches();
@@ -577,26 +656,26 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDevic
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(recycledAllocation);
 
         svmManager->trimUSMDeviceAllocCache();
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
     {
@@ -604,26 +683,26 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDevic
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAllocDefer(allocation);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAllocDefer(allocation2);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAllocDefer(recycledAllocation);
 
         svmManager->trimUSMDeviceAllocCache();
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
 }
@@ -653,22 +732,22 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledAndMultipleSVMMa
         ASSERT_NE(allocation2, nullptr);
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         secondSvmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(0u, secondSvmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, secondSvmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = svmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(recycledAllocation);
 
         svmManager->trimUSMDeviceAllocCache();
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
     {
@@ -678,22 +757,22 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledAndMultipleSVMMa
         ASSERT_NE(allocation2, nullptr);
 
         secondSvmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(1u, secondSvmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, secondSvmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = secondSvmManager->createUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation2);
-        EXPECT_EQ(0u, secondSvmManager->usmDeviceAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, secondSvmManager->usmDeviceAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         secondSvmManager->freeSVMAlloc(recycledAllocation);
 
         secondSvmManager->trimUSMDeviceAllocCache();
-        EXPECT_EQ(secondSvmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(secondSvmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, device->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
 }
@@ -725,22 +804,22 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), testDataset.size());
     }
 
     svmManager->cleanupUSMAllocCaches();
@@ -769,21 +848,21 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationWithDifferentSizeWhenAllocat
     EXPECT_NE(allocation, nullptr);
 
     size_t expectedCacheSize = 0u;
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     svmManager->freeSVMAlloc(allocation);
 
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
 
     SvmAllocationData *svmData = svmManager->getSVMAlloc(allocation);
     EXPECT_EQ(svmData->size, firstAllocationSize);
 
     auto secondAllocation = svmManager->createUnifiedMemoryAllocation(secondAllocationSize, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
     EXPECT_EQ(secondAllocation, allocation);
 
     svmManager->freeSVMAlloc(secondAllocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
 
     svmData = svmManager->getSVMAlloc(secondAllocation);
     EXPECT_EQ(svmData->size, secondAllocationSize);
@@ -811,7 +890,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
 
     svmManager->freeSVMAlloc(allocation);
 
-    ASSERT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    ASSERT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     constexpr auto allowedSizeForReuse = static_cast<size_t>(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization * SVMAllocsManager::SvmAllocationCache::minimalAllocUtilization);
     constexpr auto notAllowedSizeDueToMemoryWastage = allowedSizeForReuse - 1u;
@@ -819,12 +898,12 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAlloc
     auto notReusedDueToMemoryWastage = svmManager->createUnifiedMemoryAllocation(notAllowedSizeDueToMemoryWastage, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_NE(notReusedDueToMemoryWastage, allocation);
-    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     auto reused = svmManager->createUnifiedMemoryAllocation(allowedSizeForReuse, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_EQ(reused, allocation);
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     svmManager->freeSVMAlloc(notReusedDueToMemoryWastage);
     svmManager->freeSVMAlloc(reused);
@@ -859,7 +938,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationOverSizeLimitWhenAllocatingA
 
     svmManager->freeSVMAlloc(allocation);
 
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 }
 
 TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -888,29 +967,29 @@ TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfter
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -991,12 +1070,12 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAlloc
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), testDataset.size());
 
         auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -1009,7 +1088,7 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAlloc
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMDeviceAllocCache();
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
     }
 }
 
@@ -1036,18 +1115,18 @@ TEST_F(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCac
     auto allocationInCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->cleanupUSMAllocCaches();
@@ -1071,17 +1150,17 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationWithIsInternalAllocationSetW
     auto allocation = svmManager->createUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
     EXPECT_NE(allocation, nullptr);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
 
     unifiedMemoryProperties.isInternalAllocation = true;
     auto testedAllocation = svmManager->createUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
     auto svmData = svmManager->getSVMAlloc(testedAllocation);
     EXPECT_NE(nullptr, svmData);
     EXPECT_TRUE(svmData->isInternalAllocation);
 
     svmManager->freeSVMAlloc(testedAllocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -1103,17 +1182,17 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationInUsageWhenAllocatingAfterFr
     auto allocation = svmManager->createUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
     EXPECT_NE(allocation, nullptr);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
 
     MockMemoryManager *mockMemoryManager = reinterpret_cast<MockMemoryManager *>(device->getMemoryManager());
     mockMemoryManager->deferAllocInUse = true;
     auto testedAllocation = svmManager->createUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 1u);
     auto svmData = svmManager->getSVMAlloc(testedAllocation);
     EXPECT_NE(nullptr, svmData);
 
     svmManager->freeSVMAlloc(testedAllocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 2u);
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -1146,27 +1225,27 @@ TEST_F(SvmDeviceAllocationCacheTest, givenUsmReuseCleanerWhenTrimOldInCachesCall
     EXPECT_NE(allocation2, nullptr);
     svmManager->freeSVMAlloc(allocation);
     svmManager->freeSVMAlloc(allocation2);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 2u);
 
     const auto baseTimePoint = std::chrono::high_resolution_clock::now();
     const auto oldTimePoint = baseTimePoint - UnifiedMemoryReuseCleaner::maxHoldTime;
     const auto notTrimmedTimePoint = baseTimePoint + std::chrono::hours(24);
 
-    svmManager->usmDeviceAllocationsCache->allocations[0].saveTime = oldTimePoint;
-    svmManager->usmDeviceAllocationsCache->allocations[1].saveTime = notTrimmedTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime = oldTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 1).saveTime = notTrimmedTimePoint;
 
     memoryManager->setDeferredDeleter(new MockDeferredDeleter);
     mockUnifiedMemoryReuseCleaner->trimOldInCaches();
-    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     mockUnifiedMemoryReuseCleaner->trimOldInCaches();
-    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
-    EXPECT_EQ(notTrimmedTimePoint, svmManager->usmDeviceAllocationsCache->allocations[0].saveTime);
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(notTrimmedTimePoint, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime);
 
-    svmManager->usmDeviceAllocationsCache->allocations[0].saveTime = oldTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime = oldTimePoint;
     memoryManager->setDeferredDeleter(nullptr);
     mockUnifiedMemoryReuseCleaner->trimOldInCaches();
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     svmManager->cleanupUSMAllocCaches();
     EXPECT_EQ(0u, mockUnifiedMemoryReuseCleaner->svmAllocationCaches.size());
@@ -1200,16 +1279,16 @@ TEST_F(SvmDeviceAllocationCacheTest, givenDirectSubmissionLightWhenTrimOldInCach
     EXPECT_NE(allocation2, nullptr);
     svmManager->freeSVMAlloc(allocation);
     svmManager->freeSVMAlloc(allocation2);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 2u);
 
     const auto baseTimePoint = std::chrono::high_resolution_clock::now();
     const auto oldTimePoint = baseTimePoint - UnifiedMemoryReuseCleaner::maxHoldTime;
 
-    svmManager->usmDeviceAllocationsCache->allocations[0].saveTime = oldTimePoint;
-    svmManager->usmDeviceAllocationsCache->allocations[1].saveTime = oldTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime = oldTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 1).saveTime = oldTimePoint;
 
     mockUnifiedMemoryReuseCleaner->trimOldInCaches();
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     svmManager->cleanupUSMAllocCaches();
     EXPECT_EQ(0u, mockUnifiedMemoryReuseCleaner->svmAllocationCaches.size());
@@ -1243,18 +1322,18 @@ TEST_F(SvmDeviceAllocationCacheTest, givenUsmReuseCleanerWhenTrimOldInCachesCall
     EXPECT_NE(allocation2, nullptr);
     svmManager->freeSVMAlloc(allocation);
     svmManager->freeSVMAlloc(allocation2);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->allocations.size(), 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache->getAllocationsCount(), 2u);
 
     const auto baseTimePoint = std::chrono::high_resolution_clock::now();
     const auto oldTimePoint = baseTimePoint - UnifiedMemoryReuseCleaner::limitedHoldTime;
 
-    svmManager->usmDeviceAllocationsCache->allocations[0].saveTime = oldTimePoint;
-    svmManager->usmDeviceAllocationsCache->allocations[1].saveTime = oldTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime = oldTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 1).saveTime = oldTimePoint;
 
     memoryManager->setDeferredDeleter(new MockDeferredDeleter);
     memoryManager->usmReuseInfo.init(1 * MemoryConstants::gigaByte, alwaysLimited);
     mockUnifiedMemoryReuseCleaner->trimOldInCaches();
-    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -1282,30 +1361,30 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsInReuseWhenTrimOldAllocsCal
     svmManager->freeSVMAlloc(allocation);
     svmManager->freeSVMAlloc(allocation2);
     svmManager->freeSVMAlloc(allocation3);
-    EXPECT_EQ(3u, svmManager->usmDeviceAllocationsCache->allocations.size());
-    EXPECT_EQ(1 * MemoryConstants::pageSize64k, svmManager->usmDeviceAllocationsCache->allocations[0].allocationSize);
-    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->usmDeviceAllocationsCache->allocations[1].allocationSize);
-    EXPECT_EQ(3 * MemoryConstants::pageSize64k, svmManager->usmDeviceAllocationsCache->allocations[2].allocationSize);
+    EXPECT_EQ(3u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(1 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).allocationSize);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 1).allocationSize);
+    EXPECT_EQ(3 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 2).allocationSize);
 
     const auto baseTimePoint = std::chrono::high_resolution_clock::now();
     const auto timeDiff = std::chrono::microseconds(1);
 
-    svmManager->usmDeviceAllocationsCache->allocations[0].saveTime = baseTimePoint;
-    svmManager->usmDeviceAllocationsCache->allocations[1].saveTime = baseTimePoint + timeDiff * 2;
-    svmManager->usmDeviceAllocationsCache->allocations[2].saveTime = baseTimePoint + timeDiff;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime = baseTimePoint;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 1).saveTime = baseTimePoint + timeDiff * 2;
+    getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 2).saveTime = baseTimePoint + timeDiff;
 
     svmManager->usmDeviceAllocationsCache->trimOldAllocs(baseTimePoint + timeDiff, false);
-    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache->allocations.size());
-    EXPECT_EQ(1 * MemoryConstants::pageSize64k, svmManager->usmDeviceAllocationsCache->allocations[0].allocationSize);
-    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->usmDeviceAllocationsCache->allocations[1].allocationSize);
+    EXPECT_EQ(2u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(1 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).allocationSize);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 1).allocationSize);
 
     svmManager->usmDeviceAllocationsCache->trimOldAllocs(baseTimePoint + timeDiff, false);
-    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
-    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->usmDeviceAllocationsCache->allocations[0].allocationSize);
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).allocationSize);
 
     svmManager->usmDeviceAllocationsCache->trimOldAllocs(baseTimePoint + timeDiff, false);
-    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->allocations.size());
-    EXPECT_EQ(baseTimePoint + timeDiff * 2, svmManager->usmDeviceAllocationsCache->allocations[0].saveTime);
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(baseTimePoint + timeDiff * 2, getCachedAllocation(*svmManager->usmDeviceAllocationsCache, 0).saveTime);
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -1454,26 +1533,26 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAll
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), ++expectedCacheSize);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), ++expectedCacheSize);
         bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmHostAllocationsCache->allocations.size(); ++i) {
-            if (svmManager->usmHostAllocationsCache->allocations[i].allocation == testData.allocation) {
+        for (auto i = 0u; i < svmManager->usmHostAllocationsCache->getAllocationsCount(); ++i) {
+            if (getCachedAllocation(*svmManager->usmHostAllocationsCache, i).allocation == testData.allocation) {
                 foundInCache = true;
                 auto svmData = svmManager->getSVMAlloc(testData.allocation);
                 EXPECT_NE(nullptr, svmData);
-                EXPECT_EQ(svmData, svmManager->usmHostAllocationsCache->allocations[i].svmData);
+                EXPECT_EQ(svmData, getCachedAllocation(*svmManager->usmHostAllocationsCache, i).svmData);
                 EXPECT_EQ(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getUnderlyingBufferSize(),
-                          svmManager->usmHostAllocationsCache->allocations[i].allocationSize);
+                          getCachedAllocation(*svmManager->usmHostAllocationsCache, i).allocationSize);
                 break;
             }
         }
         EXPECT_TRUE(foundInCache);
     }
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), testDataset.size());
 
     svmManager->cleanupUSMAllocCaches();
     EXPECT_EQ(nullptr, svmManager->usmHostAllocationsCache);
@@ -1512,26 +1591,26 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAll
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(recycledAllocation);
 
         svmManager->trimUSMHostAllocCache();
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
     {
@@ -1539,26 +1618,26 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAll
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = svmManager->createHostUnifiedMemoryAllocation(1u, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAllocDefer(allocation);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAllocDefer(allocation2);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAllocDefer(recycledAllocation);
 
         svmManager->trimUSMHostAllocCache();
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
 }
@@ -1581,16 +1660,16 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAll
     ASSERT_NE(allocation, nullptr);
     auto allocation2 = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
     ASSERT_NE(allocation2, nullptr);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
     EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
     EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
     memoryManager->usmReuseInfo.init(1 * MemoryConstants::gigaByte, alwaysLimited);
     svmManager->freeSVMAlloc(allocation2);
-    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
     EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
     svmManager->cleanupUSMAllocCaches();
@@ -1619,27 +1698,27 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledAndMultipleSVMMana
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = secondSvmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
-        EXPECT_EQ(0u, secondSvmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
+        EXPECT_EQ(0u, secondSvmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         secondSvmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(0u, secondSvmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, secondSvmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(recycledAllocation);
 
         svmManager->trimUSMHostAllocCache();
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
     {
@@ -1647,27 +1726,27 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheEnabledAndMultipleSVMMana
         ASSERT_NE(allocation, nullptr);
         auto allocation2 = secondSvmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         ASSERT_NE(allocation2, nullptr);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
-        EXPECT_EQ(0u, secondSvmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
+        EXPECT_EQ(0u, secondSvmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         secondSvmManager->freeSVMAlloc(allocation2);
-        EXPECT_EQ(1u, secondSvmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(1u, secondSvmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         svmManager->freeSVMAlloc(allocation);
-        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
+        EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
         EXPECT_EQ(allocationSize, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         auto recycledAllocation = secondSvmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
         EXPECT_EQ(recycledAllocation, allocation2);
-        EXPECT_EQ(secondSvmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(secondSvmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
 
         secondSvmManager->freeSVMAlloc(recycledAllocation);
 
         secondSvmManager->trimUSMHostAllocCache();
-        EXPECT_EQ(secondSvmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        EXPECT_EQ(secondSvmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
         EXPECT_EQ(0u, memoryManager->usmReuseInfo.getAllocationsSavedForReuseSize());
     }
 }
@@ -1702,32 +1781,34 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     constexpr auto allBanks = std::numeric_limits<uint32_t>::max();
-    for (auto allocInfo : svmManager->usmHostAllocationsCache->allocations) {
-        allocInfo.svmData->gpuAllocations.getDefaultGraphicsAllocation()->setAubWritable(false, allBanks);
-        allocInfo.svmData->gpuAllocations.getDefaultGraphicsAllocation()->setTbxWritable(false, allBanks);
+    for (auto &bucket : svmManager->usmHostAllocationsCache->buckets) {
+        for (auto allocInfo : bucket.allocations) {
+            allocInfo.svmData->gpuAllocations.getDefaultGraphicsAllocation()->setAubWritable(false, allBanks);
+            allocInfo.svmData->gpuAllocations.getDefaultGraphicsAllocation()->setTbxWritable(false, allBanks);
+        }
     }
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         auto allocData = svmManager->getSVMAlloc(secondAllocation);
         EXPECT_NE(nullptr, allocData);
         EXPECT_TRUE(allocData->gpuAllocations.getDefaultGraphicsAllocation()->isAubWritable(allBanks));
         EXPECT_TRUE(allocData->gpuAllocations.getDefaultGraphicsAllocation()->isTbxWritable(allBanks));
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), testDataset.size());
     }
 
     svmManager->cleanupUSMAllocCaches();
@@ -1753,7 +1834,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
 
     svmManager->freeSVMAlloc(allocation);
 
-    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
 
     constexpr auto allowedSizeForReuse = static_cast<size_t>(SVMAllocsManager::SvmAllocationCache::minimalSizeToCheckUtilization * SVMAllocsManager::SvmAllocationCache::minimalAllocUtilization);
     constexpr auto notAllowedSizeDueToMemoryWastage = allowedSizeForReuse - 1u;
@@ -1761,12 +1842,12 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     auto notReusedDueToMemoryWastage = svmManager->createHostUnifiedMemoryAllocation(notAllowedSizeDueToMemoryWastage, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_NE(notReusedDueToMemoryWastage, allocation);
-    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
 
     auto reused = svmManager->createHostUnifiedMemoryAllocation(allowedSizeForReuse, unifiedMemoryProperties);
     EXPECT_NE(nullptr, notReusedDueToMemoryWastage);
     EXPECT_EQ(reused, allocation);
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
 
     svmManager->freeSVMAlloc(notReusedDueToMemoryWastage);
     svmManager->freeSVMAlloc(reused);
@@ -1800,7 +1881,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationOverSizeLimitWhenAllocatingAft
 
     svmManager->freeSVMAlloc(allocation);
 
-    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache->getAllocationsCount());
 }
 
 TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -1829,29 +1910,29 @@ TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -1923,12 +2004,12 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createHostUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), testDataset.size());
 
         auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -1941,7 +2022,7 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMHostAllocCache();
-        ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
     }
 }
 
@@ -1966,18 +2047,18 @@ TEST_F(SvmHostAllocationCacheTest, givenHostOutOfMemoryWhenAllocatingThenCacheIs
     auto allocationInCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache3 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
     svmManager->freeSVMAllocDefer(allocationInCache3);
 
-    ASSERT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 3u);
+    ASSERT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 3u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache3), nullptr);
     auto ptr = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->cleanupUSMAllocCaches();
@@ -2001,16 +2082,16 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationInUsageWhenAllocatingAfterFree
     auto allocation = svmManager->createHostUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
     EXPECT_NE(allocation, nullptr);
     svmManager->freeSVMAlloc(allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 1u);
 
     memoryManager->deferAllocInUse = true;
     auto testedAllocation = svmManager->createHostUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 1u);
     auto svmData = svmManager->getSVMAlloc(testedAllocation);
     EXPECT_NE(nullptr, svmData);
 
     svmManager->freeSVMAlloc(testedAllocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 2u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 2u);
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -2034,20 +2115,20 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationMarkedCompletedWhenAllocatingA
     EXPECT_EQ(0u, memoryManager->waitForEnginesCompletionCalled);
     svmManager->freeSVMAlloc(allocation, true);
     EXPECT_EQ(1u, memoryManager->waitForEnginesCompletionCalled);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 1u);
 
-    auto &svmAllocCacheInfo = svmManager->usmHostAllocationsCache->allocations[0];
+    auto &svmAllocCacheInfo = getCachedAllocation(*svmManager->usmHostAllocationsCache, 0);
     EXPECT_TRUE(svmAllocCacheInfo.completed);
 
     memoryManager->deferAllocInUse = true;
     auto testedAllocation = svmManager->createHostUnifiedMemoryAllocation(10u, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 0u);
     auto svmData = svmManager->getSVMAlloc(testedAllocation);
     EXPECT_EQ(0u, memoryManager->allocInUseCalled);
     EXPECT_NE(nullptr, svmData);
 
     svmManager->freeSVMAlloc(testedAllocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache->allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache->getAllocationsCount(), 1u);
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -2075,30 +2156,30 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsInReuseWhenTrimOldAllocsCalle
     svmManager->freeSVMAlloc(allocation);
     svmManager->freeSVMAlloc(allocation2);
     svmManager->freeSVMAlloc(allocation3);
-    EXPECT_EQ(3u, svmManager->usmHostAllocationsCache->allocations.size());
-    EXPECT_EQ(1 * MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache->allocations[0].allocationSize);
-    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache->allocations[1].allocationSize);
-    EXPECT_EQ(3 * MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache->allocations[2].allocationSize);
+    EXPECT_EQ(3u, svmManager->usmHostAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(1 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmHostAllocationsCache, 0).allocationSize);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmHostAllocationsCache, 1).allocationSize);
+    EXPECT_EQ(3 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmHostAllocationsCache, 2).allocationSize);
 
     auto baseTimePoint = std::chrono::high_resolution_clock::now();
     auto timeDiff = std::chrono::microseconds(1);
 
-    svmManager->usmHostAllocationsCache->allocations[0].saveTime = baseTimePoint;
-    svmManager->usmHostAllocationsCache->allocations[1].saveTime = baseTimePoint + timeDiff * 2;
-    svmManager->usmHostAllocationsCache->allocations[2].saveTime = baseTimePoint + timeDiff;
+    getCachedAllocation(*svmManager->usmHostAllocationsCache, 0).saveTime = baseTimePoint;
+    getCachedAllocation(*svmManager->usmHostAllocationsCache, 1).saveTime = baseTimePoint + timeDiff * 2;
+    getCachedAllocation(*svmManager->usmHostAllocationsCache, 2).saveTime = baseTimePoint + timeDiff;
 
     svmManager->usmHostAllocationsCache->trimOldAllocs(baseTimePoint + timeDiff, false);
-    EXPECT_EQ(2u, svmManager->usmHostAllocationsCache->allocations.size());
-    EXPECT_EQ(1 * MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache->allocations[0].allocationSize);
-    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache->allocations[1].allocationSize);
+    EXPECT_EQ(2u, svmManager->usmHostAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(1 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmHostAllocationsCache, 0).allocationSize);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmHostAllocationsCache, 1).allocationSize);
 
     svmManager->usmHostAllocationsCache->trimOldAllocs(baseTimePoint + timeDiff, false);
-    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
-    EXPECT_EQ(2 * MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache->allocations[0].allocationSize);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, getCachedAllocation(*svmManager->usmHostAllocationsCache, 0).allocationSize);
 
     svmManager->usmHostAllocationsCache->trimOldAllocs(baseTimePoint + timeDiff, false);
-    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->allocations.size());
-    EXPECT_EQ(baseTimePoint + timeDiff * 2, svmManager->usmHostAllocationsCache->allocations[0].saveTime);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache->getAllocationsCount());
+    EXPECT_EQ(baseTimePoint + timeDiff * 2, getCachedAllocation(*svmManager->usmHostAllocationsCache, 0).saveTime);
 
     svmManager->cleanupUSMAllocCaches();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,10 @@
 
 #include "gtest/gtest.h"
 
+#include <cinttypes>
+#include <shared_mutex>
+#include <thread>
+
 using namespace NEO;
 
 TEST(SvmDeviceAllocationTest, givenGivenSvmAllocsManagerWhenObtainOwnershipCalledThenLockedUniqueLockReturned) {
@@ -720,4 +724,189 @@ TEST_F(SVMLocalMemoryAllocatorTest, givenLocalMemoryEnabledAndCompressionEnabled
     EXPECT_TRUE(svmData->gpuAllocations.getDefaultGraphicsAllocation()->isCompressionEnabled());
 
     svmManager->freeSVMAlloc(ptr);
-}
\ No newline at end of file
+}
+
+TEST(SvmAllocLookupCacheTest, givenLookupCacheEnabledWhenPointerWithinLastFoundAllocationIsQueriedThenCachedDataIsReturnedWithoutSearchingContainer) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableSvmAllocLookupCache.set(1);
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmManager(&memoryManager);
+
+    MockGraphicsAllocation gpuAllocation(addrToPtr(0x10000ULL), MemoryConstants::pageSize64k);
+    SvmAllocationData svmAllocData(mockRootDeviceIndex);
+    svmAllocData.gpuAllocations.addAllocation(&gpuAllocation);
+    svmAllocData.size = MemoryConstants::pageSize64k;
+    svmManager.insertSVMAlloc(addrToPtr(0x10000ULL), svmAllocData);
+
+    auto svmData = svmManager.getSVMAlloc(addrToPtr(0x10000ULL));
+    ASSERT_NE(nullptr, svmData);
+
+    svmManager.svmAllocs.allocations.clear();
+    EXPECT_EQ(svmData, svmManager.getSVMAlloc(addrToPtr(0x10000ULL)));
+    EXPECT_EQ(svmData, svmManager.getSVMAlloc(addrToPtr(0x10000ULL + MemoryConstants::pageSize64k - 1)));
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(addrToPtr(0x10000ULL + MemoryConstants::pageSize64k)));
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(addrToPtr(0x10000ULL - 1)));
+}
+
+TEST(SvmAllocLookupCacheTest, givenLookupCacheEnabledWhenAllocationIsRemovedThenCachedDataIsNotReturned) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableSvmAllocLookupCache.set(1);
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmManager(&memoryManager);
+
+    MockGraphicsAllocation gpuAllocation(addrToPtr(0x10000ULL), MemoryConstants::pageSize64k);
+    SvmAllocationData svmAllocData(mockRootDeviceIndex);
+    svmAllocData.gpuAllocations.addAllocation(&gpuAllocation);
+    svmAllocData.size = MemoryConstants::pageSize64k;
+    svmManager.insertSVMAlloc(addrToPtr(0x10000ULL), svmAllocData);
+
+    auto svmData = svmManager.getSVMAlloc(addrToPtr(0x10100ULL));
+    ASSERT_NE(nullptr, svmData);
+
+    svmManager.removeSVMAlloc(*svmData);
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(addrToPtr(0x10100ULL)));
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(addrToPtr(0x10000ULL)));
+}
+
+TEST(SvmAllocLookupCacheTest, givenLookupCacheDisabledByDefaultWhenAllocationIsQueriedThenContainerIsSearched) {
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmManager(&memoryManager);
+
+    MockGraphicsAllocation gpuAllocation(addrToPtr(0x10000ULL), MemoryConstants::pageSize64k);
+    SvmAllocationData svmAllocData(mockRootDeviceIndex);
+    svmAllocData.gpuAllocations.addAllocation(&gpuAllocation);
+    svmAllocData.size = MemoryConstants::pageSize64k;
+    svmManager.insertSVMAlloc(addrToPtr(0x10000ULL), svmAllocData);
+
+    EXPECT_NE(nullptr, svmManager.getSVMAlloc(addrToPtr(0x10000ULL)));
+
+    svmManager.svmAllocs.allocations.clear();
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(addrToPtr(0x10000ULL)));
+}
+
+TEST(SvmAllocLookupCacheTest, givenLookupCacheEnabledWhenManagerIsDestroyedAndNewOneIsCreatedAtSameAddressThenStaleEntryIsNotReturned) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableSvmAllocLookupCache.set(1);
+    MockMemoryManager memoryManager;
+
+    alignas(MockSVMAllocsManager) uint8_t storage[sizeof(MockSVMAllocsManager)];
+    auto svmManager = new (storage) MockSVMAllocsManager(&memoryManager);
+
+    MockGraphicsAllocation gpuAllocation(addrToPtr(0x10000ULL), MemoryConstants::pageSize64k);
+    SvmAllocationData svmAllocData(mockRootDeviceIndex);
+    svmAllocData.gpuAllocations.addAllocation(&gpuAllocation);
+    svmAllocData.size = MemoryConstants::pageSize64k;
+    svmManager->insertSVMAlloc(addrToPtr(0x10000ULL), svmAllocData);
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(addrToPtr(0x10000ULL)));
+
+    svmManager->~MockSVMAllocsManager();
+    svmManager = new (storage) MockSVMAllocsManager(&memoryManager);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(addrToPtr(0x10000ULL)));
+    svmManager->~MockSVMAllocsManager();
+}
+
+TEST(SvmAllocLookupCacheTest, givenLookupCacheEnabledWhenCachedAllocationIsReusedWithSmallerSizeThenStaleEntryIsNotReturned) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableSvmAllocLookupCache.set(1);
+    MockMemoryManager memoryManager;
+    MockSVMAllocsManager svmManager(&memoryManager);
+    memoryManager.usmReuseInfo.init(1 * MemoryConstants::gigaByte, UsmReuseInfo::notLimited);
+
+    SVMAllocsManager::SvmAllocationCache allocationCache;
+    allocationCache.memoryManager = &memoryManager;
+    allocationCache.svmAllocsManager = &svmManager;
+    allocationCache.requireUpdatingAllocsForIndirectAccess = false;
+
+    void *ptr = addrToPtr(0x10000ULL);
+    MockGraphicsAllocation gpuAllocation(ptr, MemoryConstants::pageSize64k);
+    SvmAllocationData svmAllocData(mockRootDeviceIndex);
+    svmAllocData.gpuAllocations.addAllocation(&gpuAllocation);
+    svmAllocData.size = MemoryConstants::pageSize64k;
+    svmManager.insertSVMAlloc(ptr, svmAllocData);
+
+    auto svmData = svmManager.getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize * 2));
+    ASSERT_NE(nullptr, svmData);
+
+    EXPECT_TRUE(allocationCache.insert(MemoryConstants::pageSize64k, ptr, svmData, false));
+    EXPECT_EQ(svmData, svmManager.getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize * 2)));
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    EXPECT_EQ(ptr, allocationCache.get(MemoryConstants::pageSize, unifiedMemoryProperties));
+    EXPECT_EQ(MemoryConstants::pageSize, svmData->size);
+
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize * 2)));
+    EXPECT_EQ(svmData, svmManager.getSVMAlloc(ptr));
+}
+
+TEST(SvmAllocLookupCacheTest, DISABLED_profilingGetSVMAllocWithLookupCacheVsMapBasedTracker) {
+    constexpr uint32_t allocationsCount = 1024u;
+    constexpr uint32_t threadsCount = 8u;
+    constexpr uint32_t lookupsPerThread = 1'000'000u;
+    constexpr uint32_t lookupsPerAllocation = 16u;
+    constexpr uint64_t baseAddress = 0x100000000ULL;
+
+    MockMemoryManager memoryManager;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> gpuAllocations;
+    std::vector<SvmAllocationData> allocationsData;
+    allocationsData.reserve(allocationsCount);
+    for (uint32_t i = 0; i < allocationsCount; i++) {
+        auto address = baseAddress + i * MemoryConstants::pageSize64k;
+        gpuAllocations.push_back(std::make_unique<MockGraphicsAllocation>(addrToPtr(address), MemoryConstants::pageSize64k));
+        allocationsData.emplace_back(mockRootDeviceIndex);
+        allocationsData.back().gpuAllocations.addAllocation(gpuAllocations.back().get());
+        allocationsData.back().size = MemoryConstants::pageSize64k;
+    }
+
+    auto lookupPtr = [&](uint32_t threadId, uint32_t lookup) {
+        auto allocationIndex = ((lookup / lookupsPerAllocation) * (threadId + 1)) % allocationsCount;
+        auto offset = (lookup % lookupsPerAllocation) * MemoryConstants::pageSize;
+        return addrToPtr(baseAddress + allocationIndex * MemoryConstants::pageSize64k + offset);
+    };
+
+    auto measure = [&](auto &&getAllocation) {
+        std::atomic<uint32_t> misses{0u};
+        std::vector<std::thread> threads;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t threadId = 0; threadId < threadsCount; threadId++) {
+            threads.emplace_back([&, threadId]() {
+                for (uint32_t lookup = 0; lookup < lookupsPerThread; lookup++) {
+                    if (!getAllocation(lookupPtr(threadId, lookup))) {
+                        misses++;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(0u, misses.load());
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    };
+
+    SVMAllocsManager::MapBasedAllocationTracker mapTracker;
+    std::shared_mutex mapTrackerMutex;
+    for (auto &allocationData : allocationsData) {
+        mapTracker.insert(allocationData);
+    }
+    auto mapTrackerTime = measure([&](void *ptr) {
+        std::shared_lock<std::shared_mutex> lock(mapTrackerMutex);
+        return mapTracker.get(ptr);
+    });
+
+    DebugManagerStateRestore restore;
+    int64_t managerTimes[2] = {};
+    for (int32_t lookupCacheEnabled = 0; lookupCacheEnabled <= 1; lookupCacheEnabled++) {
+        debugManager.flags.EnableSvmAllocLookupCache.set(lookupCacheEnabled);
+        MockSVMAllocsManager svmManager(&memoryManager);
+        for (auto &allocationData : allocationsData) {
+            svmManager.insertSVMAlloc(allocationData);
+        }
+        managerTimes[lookupCacheEnabled] = measure([&](void *ptr) { return svmManager.getSVMAlloc(ptr); });
+    }
+
+    printf("\ngetSVMAlloc %u threads x %u lookups: std::map tracker %" PRId64 " us, sorted vector %" PRId64 " us, sorted vector with lookup cache %" PRId64 " us\n",
+           threadsCount, lookupsPerThread, static_cast<int64_t>(mapTrackerTime), static_cast<int64_t>(managerTimes[0]), static_cast<int64_t>(managerTimes[1]));
+}
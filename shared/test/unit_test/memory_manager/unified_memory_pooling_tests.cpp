@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -613,4 +613,100 @@ TEST_P(UnifiedMemoryPoolingManagerTest, givenInitializedPoolsManagerWhenAllocati
 
     EXPECT_EQ(nullptr, usmMemAllocPoolsManager->getPoolContainingAlloc(constPtr));
     usmMemAllocPoolsManager->cleanup();
-}
\ No newline at end of file
+}
+
+TEST_F(UnifiedMemoryPoolingManagerStaticTest, givenAllocationSizeWhenGettingSizeHistogramBucketIndexThenCeilOfLog2IsReturned) {
+    EXPECT_EQ(0u, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(0u));
+    EXPECT_EQ(0u, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(1u));
+    EXPECT_EQ(12u, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(4 * MemoryConstants::kiloByte));
+    EXPECT_EQ(13u, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(4 * MemoryConstants::kiloByte + 1));
+    EXPECT_EQ(17u, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(72 * MemoryConstants::kiloByte));
+    EXPECT_EQ(22u, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(3 * MemoryConstants::megaByte));
+    EXPECT_EQ(UsmMemAllocPoolsManager::sizeHistogramBucketsCount - 1, UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(UsmMemAllocPoolsManager::maxPoolableSize));
+}
+
+TEST_P(UnifiedMemoryPoolingManagerTest, givenAdaptiveSizingDisabledWhenSizeRangeIsMissedRepeatedlyThenNoAdaptivePoolIsCreated) {
+    EXPECT_TRUE(usmMemAllocPoolsManager->ensureInitialized(svmManager.get()));
+    usmMemAllocPoolsManager->mockFreeMemory = 8 * MemoryConstants::gigaByte;
+    poolMemoryProperties->alignment = UsmMemAllocPool::chunkAlignment;
+
+    const size_t allocSize = 3 * MemoryConstants::megaByte;
+    for (auto i = 0u; i < 2 * UsmMemAllocPoolsManager::adaptivePoolCreationThreshold; ++i) {
+        EXPECT_EQ(nullptr, usmMemAllocPoolsManager->createUnifiedMemoryAllocation(allocSize, *poolMemoryProperties.get()));
+    }
+    for (const auto &bucketPools : usmMemAllocPoolsManager->adaptivePools) {
+        EXPECT_TRUE(bucketPools.empty());
+    }
+    auto statistics = usmMemAllocPoolsManager->getStatistics();
+    EXPECT_EQ(0u, statistics.pooledAllocationsCount);
+    EXPECT_EQ(2 * UsmMemAllocPoolsManager::adaptivePoolCreationThreshold, statistics.notPooledAllocationsCount);
+    EXPECT_EQ(0u, statistics.adaptivePoolsCount);
+    EXPECT_EQ(0.0, statistics.getHitRatio());
+    usmMemAllocPoolsManager->cleanup();
+}
+
+TEST_P(UnifiedMemoryPoolingManagerTest, givenAdaptiveSizingEnabledWhenSizeRangeIsMissedRepeatedlyThenDedicatedPoolIsCreatedAndReleasedOnTrimWhenIdle) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableUsmPoolsManagerAdaptiveSizing.set(1);
+    EXPECT_TRUE(usmMemAllocPoolsManager->ensureInitialized(svmManager.get()));
+    usmMemAllocPoolsManager->mockFreeMemory = 8 * MemoryConstants::gigaByte;
+    poolMemoryProperties->alignment = UsmMemAllocPool::chunkAlignment;
+
+    const size_t allocSize = 3 * MemoryConstants::megaByte;
+    const auto bucketIndex = UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(allocSize);
+    for (auto i = 1u; i < UsmMemAllocPoolsManager::adaptivePoolCreationThreshold; ++i) {
+        EXPECT_EQ(nullptr, usmMemAllocPoolsManager->createUnifiedMemoryAllocation(allocSize, *poolMemoryProperties.get()));
+    }
+    EXPECT_TRUE(usmMemAllocPoolsManager->adaptivePools[bucketIndex].empty());
+    EXPECT_EQ(UsmMemAllocPoolsManager::adaptivePoolCreationThreshold - 1, usmMemAllocPoolsManager->sizeHistogram[bucketIndex].missesCount);
+
+    const auto totalSizeStart = usmMemAllocPoolsManager->totalSize;
+    auto pooledAlloc = usmMemAllocPoolsManager->createUnifiedMemoryAllocation(allocSize, *poolMemoryProperties.get());
+    EXPECT_NE(nullptr, pooledAlloc);
+    ASSERT_EQ(1u, usmMemAllocPoolsManager->adaptivePools[bucketIndex].size());
+    auto adaptivePool = reinterpret_cast<MockUsmMemAllocPool *>(usmMemAllocPoolsManager->adaptivePools[bucketIndex][0].get());
+    EXPECT_TRUE(adaptivePool->isInPool(pooledAlloc));
+    EXPECT_EQ(2 * MemoryConstants::megaByte + 1, adaptivePool->minServicedSize);
+    EXPECT_EQ(4 * MemoryConstants::megaByte, adaptivePool->maxServicedSize);
+    EXPECT_EQ(32 * MemoryConstants::megaByte, adaptivePool->getPoolSize());
+    EXPECT_EQ(totalSizeStart + 32 * MemoryConstants::megaByte, usmMemAllocPoolsManager->totalSize);
+    EXPECT_EQ(0u, usmMemAllocPoolsManager->sizeHistogram[bucketIndex].missesCount);
+    EXPECT_EQ(UsmMemAllocPoolsManager::adaptivePoolCreationThreshold, usmMemAllocPoolsManager->sizeHistogram[bucketIndex].allocationsCount);
+    EXPECT_EQ(adaptivePool, usmMemAllocPoolsManager->getPoolContainingAlloc(pooledAlloc));
+    EXPECT_EQ(allocSize, usmMemAllocPoolsManager->getPooledAllocationSize(pooledAlloc));
+
+    auto statistics = usmMemAllocPoolsManager->getStatistics();
+    EXPECT_EQ(1u, statistics.pooledAllocationsCount);
+    EXPECT_EQ(UsmMemAllocPoolsManager::adaptivePoolCreationThreshold - 1, statistics.notPooledAllocationsCount);
+    EXPECT_EQ(1u, statistics.adaptivePoolsCount);
+    EXPECT_EQ(usmMemAllocPoolsManager->totalSize, statistics.poolsSize);
+    EXPECT_EQ(allocSize, statistics.requestedBytes);
+    EXPECT_EQ(allocSize, statistics.allocatedBytes);
+    EXPECT_EQ(1.0 / UsmMemAllocPoolsManager::adaptivePoolCreationThreshold, statistics.getHitRatio());
+    EXPECT_EQ(0.0, statistics.getInternalFragmentation());
+
+    usmMemAllocPoolsManager->trim();
+    EXPECT_EQ(1u, usmMemAllocPoolsManager->adaptivePools[bucketIndex].size());
+
+    EXPECT_TRUE(usmMemAllocPoolsManager->freeSVMAlloc(pooledAlloc, true));
+    usmMemAllocPoolsManager->trim();
+    EXPECT_TRUE(usmMemAllocPoolsManager->adaptivePools[bucketIndex].empty());
+    EXPECT_EQ(totalSizeStart, usmMemAllocPoolsManager->totalSize);
+    usmMemAllocPoolsManager->cleanup();
+}
+
+TEST_P(UnifiedMemoryPoolingManagerTest, givenAdaptiveSizingEnabledAndNotEnoughFreeMemoryWhenSizeRangeIsMissedRepeatedlyThenAdaptivePoolIsNotCreated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableUsmPoolsManagerAdaptiveSizing.set(1);
+    EXPECT_TRUE(usmMemAllocPoolsManager->ensureInitialized(svmManager.get()));
+    usmMemAllocPoolsManager->mockFreeMemory = 0u;
+    poolMemoryProperties->alignment = UsmMemAllocPool::chunkAlignment;
+
+    const size_t allocSize = 3 * MemoryConstants::megaByte;
+    const auto bucketIndex = UsmMemAllocPoolsManager::getSizeHistogramBucketIndex(allocSize);
+    for (auto i = 0u; i < 2 * UsmMemAllocPoolsManager::adaptivePoolCreationThreshold; ++i) {
+        EXPECT_EQ(nullptr, usmMemAllocPoolsManager->createUnifiedMemoryAllocation(allocSize, *poolMemoryProperties.get()));
+    }
+    EXPECT_TRUE(usmMemAllocPoolsManager->adaptivePools[bucketIndex].empty());
+    usmMemAllocPoolsManager->cleanup();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,8 @@
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_default.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/memory_info.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -40,6 +42,7 @@ using namespace NEO;
 
 struct MockDrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandlerBind {
     using DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind;
+    using DrmMemoryOperationsHandlerBind::boundLocalMemorySize;
     using DrmMemoryOperationsHandlerBind::evictImpl;
 
     bool useBaseEvictUnused = true;
@@ -473,6 +476,280 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenUsedAllocationInBothSubdevicesWh
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenAllocationsMergedBeforeWhenMergeWithResidencyContainerAgainThenAllocationsAreSkipped) {
+    auto osContext = device->getDefaultEngine().osContext;
+    ResidencyContainer residencyContainer;
+    residencyContainer.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    residencyContainer.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyOperationsCount());
+    auto vmBindCalledAfterFirstMerge = mock->context.vmBindCalled;
+    EXPECT_NE(0u, vmBindCalledAfterFirstMerge);
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(2u, operationHandler->getSkippedResidencyOperationsCount());
+    EXPECT_EQ(vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    for (auto allocation : residencyContainer) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenAllocationMergedInOtherOsContextWhenMergeWithResidencyContainerThenAllocationIsNotSkipped) {
+    auto &engines = device->getAllEngines();
+    ASSERT_LT(1u, engines.size());
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ResidencyContainer residencyContainer{allocation};
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(engines[0].osContext, residencyContainer));
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(engines[1].osContext, residencyContainer));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyOperationsCount());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenAllocationEvictedAfterMergeWhenMergeWithResidencyContainerAgainThenAllocationIsBoundAgain) {
+    auto osContext = device->getDefaultEngine().osContext;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ResidencyContainer residencyContainer{allocation};
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    auto vmBindCalledAfterFirstMerge = mock->context.vmBindCalled;
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->evictWithinOsContext(osContext, *allocation));
+    EXPECT_NE(0u, mock->context.vmUnbindCalled);
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyOperationsCount());
+    EXPECT_LT(vmBindCalledAfterFirstMerge, mock->context.vmBindCalled);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenOtherAllocationEvictedAfterMergeWhenMergeWithResidencyContainerAgainThenMergedAllocationsAreStillSkipped) {
+    auto osContext = device->getDefaultEngine().osContext;
+    ResidencyContainer residencyContainer;
+    residencyContainer.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    residencyContainer.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    auto otherAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    memoryManager->freeGraphicsMemory(otherAllocation);
+    auto vmBindCalledBeforeMerge = mock->context.vmBindCalled;
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(2u, operationHandler->getSkippedResidencyOperationsCount());
+    EXPECT_EQ(vmBindCalledBeforeMerge, mock->context.vmBindCalled);
+    for (auto allocation : residencyContainer) {
+        EXPECT_TRUE(allocation->isBoundInOsContext(osContext->getContextId()));
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenSameHandleImportedTwiceWhenOneAllocationIsFreedThenOtherAllocationIsBoundAgainOnMerge) {
+    auto osContext = device->getDefaultEngine().osContext;
+    mock->outputHandle = 2u;
+    TestedDrmMemoryManager::OsHandleData osHandleData{1u};
+    AllocationProperties properties(device->getRootDeviceIndex(), false, MemoryConstants::pageSize, AllocationType::sharedBuffer, false, {});
+
+    auto allocation = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+    ASSERT_NE(nullptr, allocation);
+    auto otherAllocation = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+    ASSERT_NE(nullptr, otherAllocation);
+    EXPECT_EQ(static_cast<DrmAllocation *>(allocation)->getBO(), static_cast<DrmAllocation *>(otherAllocation)->getBO());
+
+    ResidencyContainer residencyContainer{allocation};
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_FALSE(allocation->isBoundInOsContext(osContext->getContextId()));
+
+    memoryManager->freeGraphicsMemory(otherAllocation);
+    auto vmBindCalledBeforeMerge = mock->context.vmBindCalled;
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyOperationsCount());
+    EXPECT_LT(vmBindCalledBeforeMerge, mock->context.vmBindCalled);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenIncrementalResidencyDisabledWhenMergeWithResidencyContainerAgainThenNoAllocationIsSkipped) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIncrementalResidency.set(0);
+
+    auto osContext = device->getDefaultEngine().osContext;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ResidencyContainer residencyContainer{allocation};
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    EXPECT_EQ(0u, operationHandler->getSkippedResidencyOperationsCount());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenSteadyStateSubmissionLoopWhenMergeWithResidencyContainerThenOnlyFirstSubmissionBindsAllocations) {
+    constexpr size_t numAllocations = 64;
+    constexpr size_t numSubmissions = 1000;
+
+    auto osContext = device->getDefaultEngine().osContext;
+    ResidencyContainer residencyContainer;
+    for (size_t i = 0; i < numAllocations; i++) {
+        residencyContainer.push_back(memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    }
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    auto vmBindCalledAfterFirstSubmission = mock->context.vmBindCalled;
+
+    for (size_t i = 1; i < numSubmissions; i++) {
+        EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    }
+
+    EXPECT_EQ(vmBindCalledAfterFirstSubmission, mock->context.vmBindCalled);
+    EXPECT_EQ(numAllocations * (numSubmissions - 1), operationHandler->getSkippedResidencyOperationsCount());
+
+    for (auto allocation : residencyContainer) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+struct DrmMemoryOperationsHandlerBindWorkingSetTest : public DrmMemoryOperationsHandlerBindTest {
+    void SetUp() override {
+        DrmMemoryOperationsHandlerBindTest::SetUp();
+        debugManager.flags.EnableWorkingSetEviction.set(1);
+        debugManager.flags.WorkingSetEvictionLowWatermark.set(50);
+        debugManager.flags.WorkingSetEvictionHighWatermark.set(100);
+
+        auto ioctlHelper = mock->getIoctlHelper();
+        auto memoryClassSystem = static_cast<uint16_t>(ioctlHelper->getDrmParamValue(DrmParam::memoryClassSystem));
+        auto memoryClassDevice = static_cast<uint16_t>(ioctlHelper->getDrmParamValue(DrmParam::memoryClassDevice));
+        std::vector<MemoryRegion> regionInfo(3);
+        regionInfo[0].region = {memoryClassSystem, 0};
+        regionInfo[0].probedSize = MemoryConstants::gigaByte;
+        regionInfo[1].region = {memoryClassDevice, 0};
+        regionInfo[1].probedSize = localMemorySize;
+        regionInfo[2].region = {memoryClassDevice, 1};
+        regionInfo[2].probedSize = localMemorySize;
+        mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+
+        osContext = device->getDefaultEngine().osContext;
+        auto &localMemAllocs = memoryManager->getLocalMemAllocs(device->getRootDeviceIndex());
+        for (auto i = 0u; i < allocationsCount; i++) {
+            bufferObjects[i] = std::make_unique<BufferObject>(device->getRootDeviceIndex(), mock, CommonConstants::unsupportedPatIndex, static_cast<int>(i + 1), MemoryConstants::pageSize, MemoryManager::maxOsContextCount);
+            BufferObjects bos{bufferObjects[i].get()};
+            drmAllocations[i] = std::make_unique<DrmAllocation>(device->getRootDeviceIndex(), 1u /*num gmms*/, AllocationType::buffer, bos, nullptr, 0u, MemoryConstants::pageSize, MemoryPool::localMemory);
+            allocations[i] = drmAllocations[i].get();
+            localMemAllocs.push_back(allocations[i]);
+        }
+    }
+
+    void TearDown() override {
+        auto &localMemAllocs = memoryManager->getLocalMemAllocs(device->getRootDeviceIndex());
+        for (auto allocation : allocations) {
+            localMemAllocs.erase(std::remove(localMemAllocs.begin(), localMemAllocs.end(), allocation), localMemAllocs.end());
+        }
+        DrmMemoryOperationsHandlerBindTest::TearDown();
+    }
+
+    void submit(GraphicsAllocation *allocation) {
+        ResidencyContainer residencyContainer{allocation};
+        EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->mergeWithResidencyContainer(osContext, residencyContainer));
+    }
+
+    bool isBound(GraphicsAllocation *allocation) {
+        auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+        return bo->getBindInfo()[bo->getOsContextId(osContext)][0];
+    }
+
+    static constexpr uint64_t localMemorySize = 4 * MemoryConstants::pageSize;
+    static constexpr uint32_t allocationsCount = 4u;
+    OsContext *osContext = nullptr;
+    std::unique_ptr<BufferObject> bufferObjects[allocationsCount];
+    std::unique_ptr<DrmAllocation> drmAllocations[allocationsCount];
+    GraphicsAllocation *allocations[allocationsCount] = {};
+};
+
+TEST_F(DrmMemoryOperationsHandlerBindWorkingSetTest, givenWorkingSetEvictionWhenEvictUnusedAllocationsAfterOutOfMemoryThenAllUnusedAllocationsAreEvictedAndOnlyBoundOnesAreCounted) {
+    submit(allocations[2]);
+    submit(allocations[0]);
+    submit(allocations[3]);
+    EXPECT_FALSE(isBound(allocations[1]));
+    EXPECT_EQ(0u, operationHandler->getEvictedAllocationsCount());
+
+    operationHandler->evictUnusedAllocations(false, true);
+
+    for (auto allocation : allocations) {
+        EXPECT_FALSE(isBound(allocation));
+    }
+    EXPECT_EQ((allocationsCount - 1) * osContext->getDeviceBitfield().count(), operationHandler->getEvictedAllocationsCount());
+    EXPECT_EQ(0u, operationHandler->getReboundAllocationsCount());
+    EXPECT_EQ(0u, operationHandler->boundLocalMemorySize[0]);
+
+    submit(allocations[2]);
+
+    EXPECT_TRUE(isBound(allocations[2]));
+    EXPECT_EQ(1u, operationHandler->getReboundAllocationsCount());
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindWorkingSetTest, givenWorkingSetEvictionWhenAllocationsAreBoundAndEvictedThenBoundLocalMemorySizeIsUpdated) {
+    submit(allocations[0]);
+    submit(allocations[1]);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, operationHandler->boundLocalMemorySize[0]);
+
+    submit(allocations[1]);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, operationHandler->boundLocalMemorySize[0]);
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->evictWithinOsContext(osContext, *allocations[0]));
+    EXPECT_EQ(MemoryConstants::pageSize, operationHandler->boundLocalMemorySize[0]);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindWorkingSetTest, givenWorkingSetEvictionDisabledWhenEvictedAllocationIsBoundAgainThenReboundAllocationIsCounted) {
+    debugManager.flags.EnableWorkingSetEviction.set(0);
+
+    submit(allocations[0]);
+    submit(allocations[1]);
+    EXPECT_EQ(0u, operationHandler->getReboundAllocationsCount());
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->evictWithinOsContext(osContext, *allocations[0]));
+    submit(allocations[0]);
+    submit(allocations[1]);
+
+    EXPECT_TRUE(isBound(allocations[0]));
+    EXPECT_EQ(1u, operationHandler->getReboundAllocationsCount());
+    EXPECT_EQ(0u, operationHandler->boundLocalMemorySize[0]);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindWorkingSetTest, givenLocalMemoryUsageAboveHighWatermarkAfterSubmissionThenColdAllocationsAreEvictedUntilLowWatermark) {
+    debugManager.flags.WorkingSetEvictionHighWatermark.set(75);
+
+    submit(allocations[0]);
+    submit(allocations[1]);
+    submit(allocations[2]);
+    EXPECT_EQ(0u, operationHandler->getEvictedAllocationsCount());
+
+    submit(allocations[3]);
+
+    EXPECT_FALSE(isBound(allocations[0]));
+    EXPECT_FALSE(isBound(allocations[1]));
+    EXPECT_TRUE(isBound(allocations[2]));
+    EXPECT_TRUE(isBound(allocations[3]));
+    EXPECT_NE(0u, operationHandler->getEvictedAllocationsCount());
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindWorkingSetTest, givenNoMemoryInfoWhenEvictUnusedAllocationsThenAllUnusedAllocationsAreEvicted) {
+    mock->memoryInfo.reset();
+
+    for (auto allocation : allocations) {
+        submit(allocation);
+    }
+
+    operationHandler->evictUnusedAllocations(false, true);
+
+    for (auto allocation : allocations) {
+        EXPECT_FALSE(isBound(allocation));
+    }
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyWithinOsContextFailsThenMergeWithResidencyContainertReturnsError) {
     struct MockDrmMemoryOperationsHandlerBindResidencyFail : public DrmMemoryOperationsHandlerBind {
         MockDrmMemoryOperationsHandlerBindResidencyFail(RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex)
@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/compiler_interface/linker.h"
+#include "shared/source/kernel/debug_data.h"
+#include "shared/source/program/decoded_program_cache.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_modules_zebin.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+namespace {
+void decodeZebin(ProgramInfo &programInfo, ArrayRef<const uint8_t> zebin) {
+    MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &gfxCoreHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<GfxCoreHelper>();
+    SingleDeviceBinary binary;
+    binary.deviceBinary = zebin;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto decodeError = decodeSingleDeviceBinary<DeviceBinaryFormat::zebin>(programInfo, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
+    ASSERT_EQ(DecodeError::success, decodeError) << decodeErrors;
+}
+} // namespace
+
+TEST(DecodedProgramCacheTests, givenDecodedZebinWithExternalFunctionsWhenSerializedAndDeserializedThenProgramStateIsRestored) {
+    ZebinTestData::ZebinWithExternalFunctionsInfo zebin;
+    ProgramInfo decoded;
+    decodeZebin(decoded, zebin.storage);
+    ASSERT_TRUE(DecodedProgramCache::isCacheable(decoded, zebin.storage));
+
+    auto cachedData = DecodedProgramCache::serialize(decoded, zebin.storage);
+    ProgramInfo restored;
+    ASSERT_TRUE(DecodedProgramCache::deserialize(restored, cachedData, zebin.storage));
+
+    ASSERT_EQ(decoded.kernelInfos.size(), restored.kernelInfos.size());
+    for (auto i = 0u; i < decoded.kernelInfos.size(); i++) {
+        const auto &decodedKernel = *decoded.kernelInfos[i];
+        const auto &restoredKernel = *restored.kernelInfos[i];
+        EXPECT_EQ(decodedKernel.kernelDescriptor.kernelMetadata.kernelName, restoredKernel.kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(0, memcmp(&decodedKernel.kernelDescriptor.kernelAttributes, &restoredKernel.kernelDescriptor.kernelAttributes, sizeof(KernelDescriptor::KernelAttributes)));
+        EXPECT_EQ(decodedKernel.heapInfo.pKernelHeap, restoredKernel.heapInfo.pKernelHeap);
+        EXPECT_EQ(decodedKernel.heapInfo.kernelHeapSize, restoredKernel.heapInfo.kernelHeapSize);
+        EXPECT_EQ(decodedKernel.heapInfo.kernelUnpaddedSize, restoredKernel.heapInfo.kernelUnpaddedSize);
+    }
+
+    ASSERT_EQ(decoded.externalFunctions.size(), restored.externalFunctions.size());
+    for (auto i = 0u; i < decoded.externalFunctions.size(); i++) {
+        EXPECT_EQ(decoded.externalFunctions[i].functionName, restored.externalFunctions[i].functionName);
+        EXPECT_EQ(decoded.externalFunctions[i].barrierCount, restored.externalFunctions[i].barrierCount);
+        EXPECT_EQ(decoded.externalFunctions[i].numGrfRequired, restored.externalFunctions[i].numGrfRequired);
+        EXPECT_EQ(decoded.externalFunctions[i].simdSize, restored.externalFunctions[i].simdSize);
+    }
+
+    ASSERT_NE(nullptr, restored.linkerInput);
+    const auto &decodedLinkerInput = *decoded.linkerInput;
+    const auto &restoredLinkerInput = *restored.linkerInput;
+    EXPECT_TRUE(restoredLinkerInput.isValid());
+    EXPECT_EQ(decodedLinkerInput.getTraits().packed, restoredLinkerInput.getTraits().packed);
+    EXPECT_EQ(decodedLinkerInput.getExportedFunctionsSegmentId(), restoredLinkerInput.getExportedFunctionsSegmentId());
+
+    ASSERT_EQ(decodedLinkerInput.getSymbols().size(), restoredLinkerInput.getSymbols().size());
+    for (const auto &[symbolName, symbol] : decodedLinkerInput.getSymbols()) {
+        auto restoredSymbol = restoredLinkerInput.getSymbols().find(symbolName);
+        ASSERT_NE(restoredLinkerInput.getSymbols().end(), restoredSymbol) << symbolName;
+        EXPECT_EQ(symbol.offset, restoredSymbol->second.offset);
+        EXPECT_EQ(symbol.size, restoredSymbol->second.size);
+        EXPECT_EQ(symbol.segment, restoredSymbol->second.segment);
+        EXPECT_EQ(symbol.instructionSegmentId, restoredSymbol->second.instructionSegmentId);
+    }
+
+    const auto &decodedTextRelocations = decodedLinkerInput.getRelocationsInInstructionSegments();
+    const auto &restoredTextRelocations = restoredLinkerInput.getRelocationsInInstructionSegments();
+    ASSERT_EQ(decodedTextRelocations.size(), restoredTextRelocations.size());
+    for (auto segmentId = 0u; segmentId < decodedTextRelocations.size(); segmentId++) {
+        ASSERT_EQ(decodedTextRelocations[segmentId].size(), restoredTextRelocations[segmentId].size());
+        for (auto i = 0u; i < decodedTextRelocations[segmentId].size(); i++) {
+            EXPECT_EQ(decodedTextRelocations[segmentId][i].symbolName, restoredTextRelocations[segmentId][i].symbolName);
+            EXPECT_EQ(decodedTextRelocations[segmentId][i].offset, restoredTextRelocations[segmentId][i].offset);
+            EXPECT_EQ(decodedTextRelocations[segmentId][i].type, restoredTextRelocations[segmentId][i].type);
+            EXPECT_EQ(decodedTextRelocations[segmentId][i].relocationSegmentName, restoredTextRelocations[segmentId][i].relocationSegmentName);
+        }
+    }
+
+    ASSERT_EQ(1u, restoredLinkerInput.getKernelDependencies().size());
+    EXPECT_EQ(decodedLinkerInput.getKernelDependencies()[0].usedFuncName, restoredLinkerInput.getKernelDependencies()[0].usedFuncName);
+    EXPECT_EQ(decodedLinkerInput.getKernelDependencies()[0].kernelName, restoredLinkerInput.getKernelDependencies()[0].kernelName);
+    ASSERT_EQ(1u, restoredLinkerInput.getFunctionDependencies().size());
+    EXPECT_EQ(decodedLinkerInput.getFunctionDependencies()[0].usedFuncName, restoredLinkerInput.getFunctionDependencies()[0].usedFuncName);
+    EXPECT_EQ(decodedLinkerInput.getFunctionDependencies()[0].callerFuncName, restoredLinkerInput.getFunctionDependencies()[0].callerFuncName);
+}
+
+TEST(DecodedProgramCacheTests, givenKernelWithAllArgumentTypesWhenSerializedAndDeserializedThenKernelDescriptorIsRestored) {
+    std::vector<uint8_t> binary(256, 0U);
+    ProgramInfo programInfo;
+    programInfo.globalConstants.initData = binary.data() + 128;
+    programInfo.globalConstants.size = 64;
+    programInfo.globalConstants.zeroInitSize = 32;
+    programInfo.globalsDeviceToHostNameMap["deviceName"] = "hostName";
+
+    auto kernelInfo = new KernelInfo();
+    programInfo.kernelInfos.push_back(kernelInfo);
+    auto &desc = kernelInfo->kernelDescriptor;
+    desc.kernelMetadata.kernelName = "kernel";
+    desc.kernelMetadata.printfStringsMap[3] = "printf string";
+    desc.kernelAttributes.simdSize = 16;
+    desc.kernelAttributes.crossThreadDataSize = 96;
+    desc.kernelAttributes.flags.usesImages = true;
+    desc.payloadMappings.implicitArgs.globalConstantsSurfaceAddress.stateless = 8;
+
+    desc.payloadMappings.explicitArgs.resize(4);
+    auto &pointerArg = desc.payloadMappings.explicitArgs[0].as<ArgDescPointer>(true);
+    pointerArg.stateless = 16;
+    pointerArg.pointerSize = 8;
+    desc.payloadMappings.explicitArgs[0].getTraits().accessQualifier = KernelArgMetadata::AccessReadOnly;
+    desc.payloadMappings.explicitArgs[1].as<ArgDescImage>(true).metadataPayload.imgWidth = 24;
+    desc.payloadMappings.explicitArgs[1].getExtendedTypeInfo().isMediaBlockImage = true;
+    desc.payloadMappings.explicitArgs[2].as<ArgDescSampler>(true).index = 1;
+    auto &valueArg = desc.payloadMappings.explicitArgs[3].as<ArgDescValue>(true);
+    valueArg.elements.push_back({32, 4, 0, false});
+    valueArg.elements.push_back({40, 4, 4, false});
+    desc.explicitArgsExtendedMetadata.resize(4);
+    desc.explicitArgsExtendedMetadata[1].type = "image2d_t";
+
+    KernelDescriptor::InlineSampler inlineSampler = {};
+    inlineSampler.samplerIndex = 2;
+    inlineSampler.addrMode = KernelDescriptor::InlineSampler::AddrMode::mirror;
+    desc.inlineSamplers.push_back(inlineSampler);
+    desc.generatedSsh.assign(64, 0xAB);
+    kernelInfo->heapInfo.pKernelHeap = binary.data();
+    kernelInfo->heapInfo.kernelHeapSize = 128;
+    kernelInfo->heapInfo.pSsh = desc.generatedSsh.data();
+    kernelInfo->heapInfo.surfaceStateHeapSize = 64;
+    ASSERT_TRUE(DecodedProgramCache::isCacheable(programInfo, binary));
+
+    auto cachedData = DecodedProgramCache::serialize(programInfo, binary);
+    ProgramInfo restored;
+    ASSERT_TRUE(DecodedProgramCache::deserialize(restored, cachedData, binary));
+
+    EXPECT_EQ(programInfo.globalConstants.initData, restored.globalConstants.initData);
+    EXPECT_EQ(64u, restored.globalConstants.size);
+    EXPECT_EQ(32u, restored.globalConstants.zeroInitSize);
+    EXPECT_EQ(nullptr, restored.globalVariables.initData);
+    EXPECT_EQ("hostName", restored.globalsDeviceToHostNameMap["deviceName"]);
+    EXPECT_EQ(nullptr, restored.linkerInput);
+
+    ASSERT_EQ(1u, restored.kernelInfos.size());
+    const auto &restoredKernel = *restored.kernelInfos[0];
+    const auto &restoredDesc = restoredKernel.kernelDescriptor;
+    EXPECT_EQ("kernel", restoredDesc.kernelMetadata.kernelName);
+    EXPECT_EQ("printf string", restoredDesc.kernelMetadata.printfStringsMap.at(3));
+    EXPECT_EQ(16u, restoredDesc.kernelAttributes.simdSize);
+    EXPECT_EQ(96u, restoredDesc.kernelAttributes.crossThreadDataSize);
+    EXPECT_TRUE(restoredDesc.kernelAttributes.flags.usesImages);
+    EXPECT_EQ(8u, restoredDesc.payloadMappings.implicitArgs.globalConstantsSurfaceAddress.stateless);
+
+    ASSERT_EQ(4u, restoredDesc.payloadMappings.explicitArgs.size());
+    const auto &restoredArgs = restoredDesc.payloadMappings.explicitArgs;
+    EXPECT_EQ(16u, restoredArgs[0].as<ArgDescPointer>().stateless);
+    EXPECT_EQ(8u, restoredArgs[0].as<ArgDescPointer>().pointerSize);
+    EXPECT_EQ(KernelArgMetadata::AccessReadOnly, restoredArgs[0].getTraits().getAccessQualifier());
+    EXPECT_EQ(24u, restoredArgs[1].as<ArgDescImage>().metadataPayload.imgWidth);
+    EXPECT_TRUE(restoredArgs[1].getExtendedTypeInfo().isMediaBlockImage);
+    EXPECT_EQ(1u, restoredArgs[2].as<ArgDescSampler>().index);
+    ASSERT_EQ(2u, restoredArgs[3].as<ArgDescValue>().elements.size());
+    EXPECT_EQ(40u, restoredArgs[3].as<ArgDescValue>().elements[1].offset);
+    EXPECT_EQ(4u, restoredArgs[3].as<ArgDescValue>().elements[1].sourceOffset);
+    ASSERT_EQ(4u, restoredDesc.explicitArgsExtendedMetadata.size());
+    EXPECT_EQ("image2d_t", restoredDesc.explicitArgsExtendedMetadata[1].type);
+
+    ASSERT_EQ(1u, restoredDesc.inlineSamplers.size());
+    EXPECT_EQ(2u, restoredDesc.inlineSamplers[0].samplerIndex);
+    EXPECT_EQ(KernelDescriptor::InlineSampler::AddrMode::mirror, restoredDesc.inlineSamplers[0].addrMode);
+
+    EXPECT_EQ(desc.generatedSsh, restoredDesc.generatedSsh);
+    EXPECT_EQ(restoredDesc.generatedSsh.data(), restoredKernel.heapInfo.pSsh);
+    EXPECT_EQ(64u, restoredKernel.heapInfo.surfaceStateHeapSize);
+    EXPECT_EQ(binary.data(), restoredKernel.heapInfo.pKernelHeap);
+    EXPECT_EQ(128u, restoredKernel.heapInfo.kernelHeapSize);
+}
+
+TEST(DecodedProgramCacheTests, givenTruncatedOrExtendedEntryWhenDeserializingThenFalseIsReturnedAndProgramInfoIsNotChanged) {
+    ZebinTestData::ZebinWithExternalFunctionsInfo zebin;
+    ProgramInfo decoded;
+    decodeZebin(decoded, zebin.storage);
+    auto cachedData = DecodedProgramCache::serialize(decoded, zebin.storage);
+
+    for (auto size = 0u; size < cachedData.size(); size++) {
+        ProgramInfo restored;
+        EXPECT_FALSE(DecodedProgramCache::deserialize(restored, ArrayRef<const uint8_t>(cachedData.data(), size), zebin.storage)) << size;
+        EXPECT_TRUE(restored.kernelInfos.empty());
+        EXPECT_EQ(nullptr, restored.linkerInput);
+    }
+
+    cachedData.push_back(0U);
+    ProgramInfo restored;
+    EXPECT_FALSE(DecodedProgramCache::deserialize(restored, cachedData, zebin.storage));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+}
+
+TEST(DecodedProgramCacheTests, givenEntryCreatedForOtherBinaryWhenDeserializingThenFalseIsReturned) {
+    ZebinTestData::ZebinWithExternalFunctionsInfo zebin;
+    ProgramInfo decoded;
+    decodeZebin(decoded, zebin.storage);
+    auto cachedData = DecodedProgramCache::serialize(decoded, zebin.storage);
+
+    ProgramInfo restored;
+    EXPECT_FALSE(DecodedProgramCache::deserialize(restored, cachedData, ArrayRef<const uint8_t>(zebin.storage.data(), zebin.storage.size() - 1)));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+}
+
+TEST(DecodedProgramCacheTests, givenDifferentBinaryIpVersionOrDriverVersionWhenGettingCacheKeyThenKeysAreDifferent) {
+    std::vector<uint8_t> binary(100, 1U);
+    auto baseKey = DecodedProgramCache::getCacheKey(binary, 1u, "1.0");
+    EXPECT_EQ(baseKey, DecodedProgramCache::getCacheKey(binary, 1u, "1.0"));
+    EXPECT_NE(std::string::npos, baseKey.find(DecodedProgramCache::cacheKeySuffix.data()));
+
+    EXPECT_NE(baseKey, DecodedProgramCache::getCacheKey(binary, 2u, "1.0"));
+    EXPECT_NE(baseKey, DecodedProgramCache::getCacheKey(binary, 1u, "1.1"));
+    binary[50] = 2U;
+    EXPECT_NE(baseKey, DecodedProgramCache::getCacheKey(binary, 1u, "1.0"));
+}
+
+TEST(DecodedProgramCacheTests, givenDebugFlagsAffectingDecodingWhenGettingCacheKeyThenKeysAreDifferent) {
+    DebugManagerStateRestore restorer;
+    std::vector<uint8_t> binary(100, 1U);
+    auto baseKey = DecodedProgramCache::getCacheKey(binary, 1u, "1.0");
+
+    debugManager.flags.ZebinAppendElws.set(true);
+    auto appendElwsKey = DecodedProgramCache::getCacheKey(binary, 1u, "1.0");
+    EXPECT_NE(baseKey, appendElwsKey);
+
+    debugManager.flags.ZebinAppendElws.set(false);
+    debugManager.flags.IgnoreZebinUnknownAttributes.set(true);
+    auto ignoreUnknownAttributesKey = DecodedProgramCache::getCacheKey(binary, 1u, "1.0");
+    EXPECT_NE(baseKey, ignoreUnknownAttributesKey);
+    EXPECT_NE(appendElwsKey, ignoreUnknownAttributesKey);
+}
+
+TEST(DecodedProgramCacheTests, givenEntryWithDifferentFormatVersionOrLayoutFingerprintWhenDeserializingThenFalseIsReturned) {
+    ZebinTestData::ZebinWithExternalFunctionsInfo zebin;
+    ProgramInfo decoded;
+    decodeZebin(decoded, zebin.storage);
+    auto cachedData = DecodedProgramCache::serialize(decoded, zebin.storage);
+
+    for (auto headerFieldOffset : {0u, static_cast<uint32_t>(sizeof(uint32_t))}) {
+        auto modifiedData = cachedData;
+        modifiedData[headerFieldOffset] ^= 0xFFU;
+        ProgramInfo restored;
+        EXPECT_FALSE(DecodedProgramCache::deserialize(restored, modifiedData, zebin.storage)) << headerFieldOffset;
+        EXPECT_TRUE(restored.kernelInfos.empty());
+    }
+}
+
+TEST(DecodedProgramCacheTests, givenProgramWithStateNotRepresentableInCacheWhenCheckingIfCacheableThenFalseIsReturned) {
+    std::vector<uint8_t> binary(64, 0U);
+    std::vector<uint8_t> otherMemory(64, 0U);
+    {
+        ProgramInfo programInfo;
+        programInfo.globalVariables.initData = otherMemory.data();
+        programInfo.globalVariables.size = otherMemory.size();
+        EXPECT_FALSE(DecodedProgramCache::isCacheable(programInfo, binary));
+    }
+    {
+        ProgramInfo programInfo;
+        programInfo.kernelInfos.push_back(new KernelInfo());
+        programInfo.kernelInfos[0]->heapInfo.pKernelHeap = binary.data() + 32;
+        programInfo.kernelInfos[0]->heapInfo.kernelHeapSize = 64;
+        EXPECT_FALSE(DecodedProgramCache::isCacheable(programInfo, binary));
+    }
+    {
+        ProgramInfo programInfo;
+        programInfo.kernelInfos.push_back(new KernelInfo());
+        programInfo.kernelInfos[0]->kernelDescriptor.external.debugData = std::make_unique<DebugData>();
+        EXPECT_FALSE(DecodedProgramCache::isCacheable(programInfo, binary));
+    }
+}
+
+TEST(DecodedProgramCacheTests, givenDecodedProgramCacheEnabledWhenDecodingSameZebinTwiceThenSecondDecodeIsLoadedFromCache) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDecodedProgramCache.set(1);
+    MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &gfxCoreHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<GfxCoreHelper>();
+    CompilerCacheMock cache;
+    cache.config.enabled = true;
+
+    ZebinTestData::ZebinWithExternalFunctionsInfo zebin;
+    SingleDeviceBinary binary;
+    binary.deviceBinary = zebin.storage;
+    binary.targetDevice.grfSize = 64;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+
+    ProgramInfo decoded;
+    auto ret = DecodedProgramCache::decodeSingleDeviceBinary(&cache, 0x1234u, decoded, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
+    EXPECT_EQ(DecodeError::success, ret.first);
+    EXPECT_EQ(DeviceBinaryFormat::zebin, ret.second);
+    ASSERT_EQ(1u, cache.cacheInvoked);
+    EXPECT_NE(std::string::npos, cache.cacheBinaryKernelFileHashes[0].find(DecodedProgramCache::cacheKeySuffix.data()));
+
+    ProgramInfo loaded;
+    ret = DecodedProgramCache::decodeSingleDeviceBinary(&cache, 0x1234u, loaded, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
+    EXPECT_EQ(DecodeError::success, ret.first);
+    EXPECT_EQ(DeviceBinaryFormat::zebin, ret.second);
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+
+    EXPECT_EQ(64u, loaded.grfSize);
+    ASSERT_EQ(decoded.kernelInfos.size(), loaded.kernelInfos.size());
+    EXPECT_EQ(decoded.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName, loaded.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName);
+    EXPECT_EQ(decoded.kernelInfos[0]->heapInfo.pKernelHeap, loaded.kernelInfos[0]->heapInfo.pKernelHeap);
+    ASSERT_NE(nullptr, loaded.linkerInput);
+    EXPECT_EQ(decoded.linkerInput->getSymbols().size(), loaded.linkerInput->getSymbols().size());
+
+    ProgramInfo decodedForOtherDevice;
+    ret = DecodedProgramCache::decodeSingleDeviceBinary(&cache, 0x5678u, decodedForOtherDevice, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
+    EXPECT_EQ(DecodeError::success, ret.first);
+    EXPECT_EQ(2u, cache.cacheInvoked);
+}
+
+TEST(DecodedProgramCacheTests, givenDecodedProgramCacheDisabledOrCompilerCacheDisabledWhenDecodingZebinThenCacheIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &gfxCoreHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<GfxCoreHelper>();
+    CompilerCacheMock cache;
+    ZebinTestData::ZebinWithExternalFunctionsInfo zebin;
+    SingleDeviceBinary binary;
+    binary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+
+    for (auto [flagValue, cacheEnabled] : {std::pair{-1, true}, std::pair{0, true}, std::pair{1, false}}) {
+        debugManager.flags.EnableDecodedProgramCache.set(flagValue);
+        cache.config.enabled = cacheEnabled;
+        ProgramInfo programInfo;
+        auto ret = DecodedProgramCache::decodeSingleDeviceBinary(&cache, 0u, programInfo, binary, decodeErrors, decodeWarnings, gfxCoreHelper);
+        EXPECT_EQ(DecodeError::success, ret.first);
+        EXPECT_EQ(2u, programInfo.kernelInfos.size());
+    }
+    EXPECT_EQ(0u, cache.cacheInvoked);
+}
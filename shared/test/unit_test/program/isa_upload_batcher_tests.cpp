@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/blit_helper.h"
+#include "shared/source/program/isa_upload_batcher.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstring>
+#include <memory>
+
+using namespace NEO;
+
+struct IsaUploadBatcherTest : public ::testing::Test {
+    void SetUp() override {
+        device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+        for (uint8_t i = 0u; i < isaSize; i++) {
+            isaA[i] = i;
+            isaB[i] = 0xff - i;
+        }
+    }
+
+    void makeBlitterRequired(MockGraphicsAllocation &allocation) {
+        allocation.overrideMemoryPool(MemoryPool::localMemory);
+        allocation.storageInfo.memoryBanks = 1;
+    }
+
+    static constexpr size_t isaSize = 16;
+    std::unique_ptr<MockDevice> device;
+    std::array<uint8_t, isaSize> isaA = {};
+    std::array<uint8_t, isaSize> isaB = {};
+};
+
+TEST_F(IsaUploadBatcherTest, givenAllocationsAccessibleByCpuWhenAddingIsaThenIsaIsCopiedImmediatelyWithoutBlitter) {
+    uint32_t blitsCount = 0u;
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [&](const Device &, const void *, size_t, const BlitMemoryToAllocationEntries &) {
+            blitsCount++;
+            return BlitOperationResult::success;
+        }};
+
+    std::array<uint8_t, 2 * isaSize> destA = {};
+    std::array<uint8_t, isaSize> destB = {};
+    MockGraphicsAllocation allocationA{destA.data(), destA.size()};
+    MockGraphicsAllocation allocationB{destB.data(), destB.size()};
+
+    IsaUploadBatcher batcher(*device);
+    batcher.add(&allocationA, isaSize, isaA.data(), isaSize);
+    batcher.add(&allocationB, 0u, isaB.data(), isaSize);
+    EXPECT_EQ(0u, batcher.getPendingTransfersCount());
+    EXPECT_EQ(0, memcmp(destA.data() + isaSize, isaA.data(), isaSize));
+    EXPECT_EQ(0, memcmp(destB.data(), isaB.data(), isaSize));
+
+    EXPECT_TRUE(batcher.upload());
+    EXPECT_EQ(0u, blitsCount);
+}
+
+TEST_F(IsaUploadBatcherTest, givenAllocationsRequiringBlitterWhenUploadingThenSingleBlitIsSubmittedForAllKernels) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::cpuAccessDisallowed));
+
+    uint32_t blitsCount = 0u;
+    BlitMemoryToAllocationEntries blittedEntries;
+    std::vector<uint8_t> blittedHostMemory;
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [&](const Device &, const void *hostPtr, size_t hostPtrSize, const BlitMemoryToAllocationEntries &entries) {
+            blitsCount++;
+            blittedEntries = entries;
+            blittedHostMemory.assign(static_cast<const uint8_t *>(hostPtr), static_cast<const uint8_t *>(hostPtr) + hostPtrSize);
+            return BlitOperationResult::success;
+        }};
+
+    std::array<uint8_t, isaSize> destA = {};
+    std::array<uint8_t, isaSize> destB = {};
+    MockGraphicsAllocation allocationA{destA.data(), destA.size()};
+    MockGraphicsAllocation allocationB{destB.data(), destB.size()};
+    makeBlitterRequired(allocationA);
+    makeBlitterRequired(allocationB);
+
+    IsaUploadBatcher batcher(*device);
+    batcher.add(&allocationA, 0u, isaA.data(), isaSize);
+    batcher.add(&allocationB, 0u, isaB.data(), isaSize);
+    EXPECT_EQ(2u, batcher.getPendingTransfersCount());
+    EXPECT_EQ(0u, blitsCount);
+
+    EXPECT_TRUE(batcher.upload());
+    EXPECT_EQ(1u, blitsCount);
+    EXPECT_EQ(0u, batcher.getPendingTransfersCount());
+
+    ASSERT_EQ(2u, blittedEntries.size());
+    EXPECT_EQ(&allocationA, blittedEntries[0].memory);
+    EXPECT_EQ(&allocationB, blittedEntries[1].memory);
+    EXPECT_EQ(0u, blittedEntries[1].hostPtrOffset % MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0, memcmp(blittedHostMemory.data() + blittedEntries[0].hostPtrOffset, isaA.data(), isaSize));
+    EXPECT_EQ(0, memcmp(blittedHostMemory.data() + blittedEntries[1].hostPtrOffset, isaB.data(), isaSize));
+}
+
+TEST_F(IsaUploadBatcherTest, givenConsecutiveRangesOfSameAllocationWhenAddingIsaThenRangesAreMergedAndGapIsZeroFilled) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::cpuAccessDisallowed));
+
+    BlitMemoryToAllocationEntries blittedEntries;
+    std::vector<uint8_t> blittedHostMemory;
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [&](const Device &, const void *hostPtr, size_t hostPtrSize, const BlitMemoryToAllocationEntries &entries) {
+            blittedEntries = entries;
+            blittedHostMemory.assign(static_cast<const uint8_t *>(hostPtr), static_cast<const uint8_t *>(hostPtr) + hostPtrSize);
+            return BlitOperationResult::success;
+        }};
+
+    constexpr size_t gapSize = 8u;
+    std::array<uint8_t, 2 * isaSize + gapSize> dest = {};
+    MockGraphicsAllocation allocation{dest.data(), dest.size()};
+    makeBlitterRequired(allocation);
+
+    IsaUploadBatcher batcher(*device);
+    batcher.add(&allocation, 0u, isaA.data(), isaSize);
+    batcher.add(&allocation, isaSize + gapSize, isaB.data(), isaSize);
+    EXPECT_EQ(1u, batcher.getPendingTransfersCount());
+
+    EXPECT_TRUE(batcher.upload());
+    ASSERT_EQ(1u, blittedEntries.size());
+    EXPECT_EQ(0u, blittedEntries[0].offset);
+    EXPECT_EQ(dest.size(), blittedEntries[0].size);
+
+    std::array<uint8_t, gapSize> zeros = {};
+    auto staged = blittedHostMemory.data() + blittedEntries[0].hostPtrOffset;
+    EXPECT_EQ(0, memcmp(staged, isaA.data(), isaSize));
+    EXPECT_EQ(0, memcmp(staged + isaSize, zeros.data(), gapSize));
+    EXPECT_EQ(0, memcmp(staged + isaSize + gapSize, isaB.data(), isaSize));
+}
+
+TEST_F(IsaUploadBatcherTest, givenBlitFailsWhenUploadingThenIsaIsCopiedOnCpuOncePerAllocation) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::cpuAccessDisallowed));
+
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [&](const Device &, const void *, size_t, const BlitMemoryToAllocationEntries &) {
+            return BlitOperationResult::unsupported;
+        }};
+
+    std::array<uint8_t, isaSize> destA = {};
+    std::array<uint8_t, isaSize> destB = {};
+    MockGraphicsAllocation allocationA{destA.data(), destA.size()};
+    MockGraphicsAllocation allocationB{destB.data(), destB.size()};
+    makeBlitterRequired(allocationA);
+    makeBlitterRequired(allocationB);
+
+    IsaUploadBatcher batcher(*device);
+    batcher.add(&allocationA, 0u, isaA.data(), isaSize);
+    batcher.add(&allocationB, 0u, isaB.data(), isaSize);
+
+    EXPECT_TRUE(batcher.upload());
+    EXPECT_EQ(0, memcmp(destA.data(), isaA.data(), isaSize));
+    EXPECT_EQ(0, memcmp(destB.data(), isaB.data(), isaSize));
+}
+
+TEST_F(IsaUploadBatcherTest, givenBatchingDisabledWhenAddingIsaThenEachKernelIsTransferredImmediately) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::cpuAccessDisallowed));
+    debugManager.flags.EnableBatchedIsaUpload.set(0);
+
+    uint32_t batchedBlitsCount = 0u;
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitsBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [&](const Device &, const void *, size_t, const BlitMemoryToAllocationEntries &) {
+            batchedBlitsCount++;
+            return BlitOperationResult::success;
+        }};
+    uint32_t blitsCount = 0u;
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationFunc> blitBackup{
+        &BlitHelperFunctions::blitMemoryToAllocation, [&](const Device &, GraphicsAllocation *, size_t, const void *, const Vec3<size_t> &) {
+            blitsCount++;
+            return BlitOperationResult::success;
+        }};
+
+    std::array<uint8_t, isaSize> destA = {};
+    std::array<uint8_t, isaSize> destB = {};
+    MockGraphicsAllocation allocationA{destA.data(), destA.size()};
+    MockGraphicsAllocation allocationB{destB.data(), destB.size()};
+    makeBlitterRequired(allocationA);
+    makeBlitterRequired(allocationB);
+
+    IsaUploadBatcher batcher(*device);
+    batcher.add(&allocationA, 0u, isaA.data(), isaSize);
+    batcher.add(&allocationB, 0u, isaB.data(), isaSize);
+    EXPECT_EQ(0u, batcher.getPendingTransfersCount());
+    EXPECT_EQ(2u, blitsCount);
+
+    EXPECT_TRUE(batcher.upload());
+    EXPECT_EQ(0u, batchedBlitsCount);
+}
+
+TEST(BlitHelperTest, givenBlitterNotSupportedWhenBlittingMemoryToAllocationsThenUnsupportedIsReturned) {
+    auto hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.blitterOperationsSupported = false;
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+
+    uint8_t dest[16] = {};
+    uint8_t src[16] = {};
+    MockGraphicsAllocation allocation{dest, sizeof(dest)};
+    BlitMemoryToAllocationEntries entries = {{&allocation, 0u, 0u, sizeof(src)}};
+    EXPECT_EQ(BlitOperationResult::unsupported, BlitHelper::blitMemoryToAllocations(*device, src, sizeof(src), entries));
+}
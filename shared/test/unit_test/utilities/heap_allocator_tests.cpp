@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
@@ -33,8 +34,11 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     using HeapAllocator::allocationAlignment;
     using HeapAllocator::availableSize;
     using HeapAllocator::defragment;
+    using HeapAllocator::freeRangesByAddress;
+    using HeapAllocator::freeRangesBySize;
     using HeapAllocator::pLeftBound;
     using HeapAllocator::pRightBound;
+    using HeapAllocator::useFreeRangeIndex;
 
     uint64_t getFromFreedChunksWithStartAddressHint(const uint64_t requiredStartAddress, size_t size, std::vector<HeapChunk> &freedChunks) {
         if (failGetFromFreedChunksWithStartAddressHintCall) {
@@ -1743,3 +1747,150 @@ TEST(HeapAllocatorTest, whenGetBaseAddressIsCalledThenReturnInitialBaseAddress)
     EXPECT_NE(0u, heapAllocator.allocate(smallChunk));
     EXPECT_EQ(heapBase, heapAllocator.getBaseAddress());
 }
+
+TEST(HeapAllocatorTest, givenDefaultSettingsWhenHeapAllocatorIsCreatedThenFreeRangeIndexIsNotUsed) {
+    HeapAllocatorUnderTest heapAllocator(0x100000llu, 16 * MemoryConstants::megaByte, allocationAlignment, sizeThreshold);
+    EXPECT_FALSE(heapAllocator.useFreeRangeIndex);
+}
+
+TEST(HeapAllocatorTest, givenFreeRangeIndexEnabledWhenFreeingAdjacentChunksThenRangesAreCoalescedImmediately) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorFreeRangeIndex.set(1);
+
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 16 * MemoryConstants::megaByte;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold);
+    EXPECT_TRUE(heapAllocator.useFreeRangeIndex);
+
+    uint64_t ptrs[4] = {};
+    for (auto &ptr : ptrs) {
+        size_t chunkSize = MemoryConstants::pageSize;
+        ptr = heapAllocator.allocate(chunkSize);
+        EXPECT_NE(0u, ptr);
+    }
+    EXPECT_EQ(heapBase + heapSize - 4 * MemoryConstants::pageSize, heapAllocator.getRightBound());
+
+    heapAllocator.free(ptrs[0], MemoryConstants::pageSize);
+    heapAllocator.free(ptrs[2], MemoryConstants::pageSize);
+    EXPECT_EQ(2u, heapAllocator.freeRangesByAddress.size());
+    EXPECT_EQ(2u, heapAllocator.freeRangesBySize.size());
+
+    heapAllocator.free(ptrs[1], MemoryConstants::pageSize);
+    ASSERT_EQ(1u, heapAllocator.freeRangesByAddress.size());
+    EXPECT_EQ(ptrs[2], heapAllocator.freeRangesByAddress.begin()->first);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, heapAllocator.freeRangesByAddress.begin()->second);
+
+    heapAllocator.free(ptrs[3], MemoryConstants::pageSize);
+    EXPECT_TRUE(heapAllocator.freeRangesByAddress.empty());
+    EXPECT_TRUE(heapAllocator.freeRangesBySize.empty());
+    EXPECT_EQ(heapBase + heapSize, heapAllocator.getRightBound());
+    EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+}
+
+TEST(HeapAllocatorTest, givenFreeRangeIndexEnabledWhenAllocatingWithCustomAlignmentThenSmallestAlignedFittingRangeIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorFreeRangeIndex.set(1);
+
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 64 * MemoryConstants::megaByte;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0u);
+
+    const size_t chunkSizes[] = {64 * MemoryConstants::kiloByte, 64 * MemoryConstants::kiloByte, 192 * MemoryConstants::kiloByte,
+                                 64 * MemoryConstants::kiloByte, 128 * MemoryConstants::kiloByte, 64 * MemoryConstants::kiloByte};
+    uint64_t ptrs[6] = {};
+    for (uint32_t i = 0; i < 6; i++) {
+        size_t chunkSize = chunkSizes[i];
+        ptrs[i] = heapAllocator.allocate(chunkSize);
+        EXPECT_NE(0u, ptrs[i]);
+    }
+    heapAllocator.free(ptrs[0], chunkSizes[0]);
+    heapAllocator.free(ptrs[2], chunkSizes[2]);
+    heapAllocator.free(ptrs[4], chunkSizes[4]);
+    EXPECT_EQ(3u, heapAllocator.freeRangesBySize.size());
+
+    size_t sizeToAllocate = 64 * MemoryConstants::kiloByte;
+    EXPECT_EQ(ptrs[0], heapAllocator.allocateWithCustomAlignment(sizeToAllocate, 128 * MemoryConstants::kiloByte));
+    EXPECT_EQ(2u, heapAllocator.freeRangesBySize.size());
+
+    sizeToAllocate = 64 * MemoryConstants::kiloByte;
+    auto ptr = heapAllocator.allocateWithCustomAlignment(sizeToAllocate, 256 * MemoryConstants::kiloByte);
+    EXPECT_EQ(heapBase + 256 * MemoryConstants::kiloByte, ptr);
+    EXPECT_EQ(64 * MemoryConstants::kiloByte, sizeToAllocate);
+
+    ASSERT_EQ(2u, heapAllocator.freeRangesByAddress.size());
+    EXPECT_EQ(128 * MemoryConstants::kiloByte, heapAllocator.freeRangesByAddress[ptrs[2]]);
+    EXPECT_EQ(128 * MemoryConstants::kiloByte, heapAllocator.freeRangesByAddress[ptrs[4]]);
+    EXPECT_EQ(heapSize - 320 * MemoryConstants::kiloByte, heapAllocator.getLeftSize());
+}
+
+TEST(HeapAllocatorTest, givenFreeRangeIndexEnabledWhenAllocatingWithStartAddressHintInFreedRangeThenRangeIsSplit) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorFreeRangeIndex.set(1);
+
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 64 * MemoryConstants::megaByte;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0u);
+
+    size_t chunkSize = 192 * MemoryConstants::kiloByte;
+    auto ptr = heapAllocator.allocate(chunkSize);
+    size_t sentinelSize = 64 * MemoryConstants::kiloByte;
+    EXPECT_NE(0u, heapAllocator.allocate(sentinelSize));
+    heapAllocator.free(ptr, chunkSize);
+
+    size_t sizeToAllocate = 64 * MemoryConstants::kiloByte;
+    const uint64_t requiredStartAddress = ptr + 64 * MemoryConstants::kiloByte;
+    EXPECT_EQ(requiredStartAddress, heapAllocator.allocateWithStartAddressHint(requiredStartAddress, sizeToAllocate));
+
+    ASSERT_EQ(2u, heapAllocator.freeRangesByAddress.size());
+    EXPECT_EQ(64 * MemoryConstants::kiloByte, heapAllocator.freeRangesByAddress[ptr]);
+    EXPECT_EQ(64 * MemoryConstants::kiloByte, heapAllocator.freeRangesByAddress[requiredStartAddress + sizeToAllocate]);
+
+    heapAllocator.free(requiredStartAddress, sizeToAllocate);
+    ASSERT_EQ(1u, heapAllocator.freeRangesByAddress.size());
+    EXPECT_EQ(chunkSize, heapAllocator.freeRangesByAddress[ptr]);
+}
+
+TEST(HeapAllocatorTest, givenFreeRangeIndexEnabledWhenRandomAllocationsAreFreedThenAllocationsDoNotOverlapAndHeapIsFullyCoalesced) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorFreeRangeIndex.set(1);
+
+    std::ranlux24 generator(1);
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 256 * MemoryConstants::megaByte;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold);
+
+    std::map<uint64_t, size_t> liveAllocations;
+    for (uint32_t i = 0; i < 5000; i++) {
+        if (liveAllocations.empty() || generator() % 3 != 0) {
+            size_t sizeToAllocate = (generator() % (2 * sizeThreshold / allocationAlignment) + 1) * allocationAlignment;
+            size_t alignment = allocationAlignment << (generator() % 5);
+            auto ptr = heapAllocator.allocateWithCustomAlignment(sizeToAllocate, alignment);
+            ASSERT_NE(0u, ptr);
+            EXPECT_TRUE(isAligned(ptr, alignment));
+
+            auto next = liveAllocations.lower_bound(ptr);
+            if (next != liveAllocations.end()) {
+                EXPECT_LE(ptr + sizeToAllocate, next->first);
+            }
+            if (next != liveAllocations.begin()) {
+                auto prev = std::prev(next);
+                EXPECT_LE(prev->first + prev->second, ptr);
+            }
+            liveAllocations[ptr] = sizeToAllocate;
+        } else {
+            auto it = liveAllocations.begin();
+            std::advance(it, generator() % liveAllocations.size());
+            heapAllocator.free(it->first, it->second);
+            liveAllocations.erase(it);
+        }
+    }
+
+    for (auto &allocation : liveAllocations) {
+        heapAllocator.free(allocation.first, allocation.second);
+    }
+
+    EXPECT_TRUE(heapAllocator.freeRangesByAddress.empty());
+    EXPECT_TRUE(heapAllocator.freeRangesBySize.empty());
+    EXPECT_EQ(heapAllocator.getLeftBound(), heapAllocator.getRightBound() - heapSize);
+    EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2025 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -99,3 +99,21 @@ TEST_F(IsaPoolAllocatorTest, givenIsaPoolAllocatorWhenRequestForLargeAllocationT
     verifySharedIsaAllocation(allocation, 0, requestAllocationSize);
     isaAllocator.freeSharedIsaAllocation(allocation);
 }
+
+TEST_F(IsaPoolAllocatorTest, givenRequestLargerThanPoolSizeWhenAllocatingThenPoolIsRoundedUpAndRemainingSpaceIsReused) {
+    constexpr size_t sharedIsaAllocationSize = MemoryConstants::pageSize2M * 2;
+    constexpr size_t largeRequestAllocationSize = sharedIsaAllocationSize + MemoryConstants::pageSize;
+    constexpr size_t smallRequestAllocationSize = sharedIsaAllocationSize - 2 * MemoryConstants::pageSize;
+
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    auto largeAllocation = isaAllocator.requestGraphicsAllocationForIsa(false, largeRequestAllocationSize);
+    verifySharedIsaAllocation(largeAllocation, 0, largeRequestAllocationSize);
+    EXPECT_EQ(2 * sharedIsaAllocationSize, largeAllocation->getGraphicsAllocation()->getUnderlyingBufferSize());
+
+    auto smallAllocation = isaAllocator.requestGraphicsAllocationForIsa(false, smallRequestAllocationSize);
+    verifySharedIsaAllocation(smallAllocation, largeRequestAllocationSize, smallRequestAllocationSize);
+    EXPECT_EQ(largeAllocation->getGraphicsAllocation(), smallAllocation->getGraphicsAllocation());
+
+    isaAllocator.freeSharedIsaAllocation(smallAllocation);
+    isaAllocator.freeSharedIsaAllocation(largeAllocation);
+}
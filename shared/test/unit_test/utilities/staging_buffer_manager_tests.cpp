@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -916,4 +916,105 @@ TEST_F(StagingBufferManagerTest, givenStagingBufferWhenFailedChunkBufferWriteWit
     EXPECT_EQ(WaitStatus::ready, ret.waitStatus);
     EXPECT_EQ(remainderCounter, chunkCounter);
     delete[] ptr;
-}
\ No newline at end of file
+}
+
+struct MockStagingBufferCopyWorkers : public StagingBufferCopyWorkers {
+    using StagingBufferCopyWorkers::minPartSize;
+    using StagingBufferCopyWorkers::queuedParts;
+    using StagingBufferCopyWorkers::StagingBufferCopyWorkers;
+    using StagingBufferCopyWorkers::workers;
+};
+
+struct MockStagingBufferManager : public StagingBufferManager {
+    using StagingBufferManager::copyWorkers;
+    using StagingBufferManager::StagingBufferManager;
+};
+
+TEST(StagingBufferCopyWorkersTest, givenThreadsCountWhenCreatingCopyWorkersThenCallingThreadIsCountedAsOneOfThem) {
+    MockStagingBufferCopyWorkers copyWorkers(4u);
+    EXPECT_EQ(4u, copyWorkers.getThreadsCount());
+    EXPECT_EQ(3u, copyWorkers.workers.size());
+}
+
+TEST(StagingBufferCopyWorkersTest, givenCopySmallerThanTwoPartsWhenCopyingThenDataCopiedByCallingThreadOnly) {
+    MockStagingBufferCopyWorkers copyWorkers(4u);
+    copyWorkers.minPartSize = MemoryConstants::pageSize;
+
+    std::vector<uint8_t> src(MemoryConstants::pageSize + 1, 0xAB);
+    std::vector<uint8_t> dst(src.size(), 0u);
+    copyWorkers.copy(dst.data(), src.data(), src.size());
+
+    EXPECT_EQ(src, dst);
+    EXPECT_TRUE(copyWorkers.queuedParts.empty());
+}
+
+TEST(StagingBufferCopyWorkersTest, givenLargeCopyWhenCopyingThenAllPartsCompletedBeforeReturn) {
+    MockStagingBufferCopyWorkers copyWorkers(4u);
+    copyWorkers.minPartSize = MemoryConstants::pageSize;
+
+    constexpr size_t copySize = 16 * MemoryConstants::pageSize + 7;
+    std::vector<uint8_t> src(copySize);
+    for (auto i = 0u; i < copySize; i++) {
+        src[i] = static_cast<uint8_t>(i % 251);
+    }
+    for (auto iteration = 0u; iteration < 10u; iteration++) {
+        std::vector<uint8_t> dst(copySize, 0u);
+        copyWorkers.copy(dst.data(), src.data(), copySize);
+        EXPECT_EQ(src, dst);
+    }
+    EXPECT_TRUE(copyWorkers.queuedParts.empty());
+}
+
+TEST_F(StagingBufferManagerTest, givenStagingBufferCopyThreadsDebugFlagWhenCreatingManagerThenCopyWorkersCreatedOnlyForMoreThanOneThread) {
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    {
+        MockStagingBufferManager manager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields, false);
+        EXPECT_EQ(nullptr, manager.copyWorkers.get());
+    }
+    {
+        debugManager.flags.StagingBufferCopyThreads.set(1);
+        MockStagingBufferManager manager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields, false);
+        EXPECT_EQ(nullptr, manager.copyWorkers.get());
+    }
+    {
+        debugManager.flags.StagingBufferCopyThreads.set(3);
+        MockStagingBufferManager manager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields, false);
+        ASSERT_NE(nullptr, manager.copyWorkers.get());
+        EXPECT_EQ(3u, manager.copyWorkers->getThreadsCount());
+    }
+}
+
+TEST_F(StagingBufferManagerTest, givenCopyWorkersWhenPerformBufferTransferThenDataCopiedCorrectly) {
+    debugManager.flags.StagingBufferSize.set(1024);
+    debugManager.flags.StagingBufferCopyThreads.set(4);
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    stagingBufferManager = std::make_unique<StagingBufferManager>(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields, false);
+
+    constexpr size_t transferSize = 4 * MemoryConstants::megaByte + 512;
+    std::vector<uint8_t> hostData(transferSize);
+    for (auto i = 0u; i < transferSize; i++) {
+        hostData[i] = static_cast<uint8_t>(i % 253);
+    }
+    std::vector<uint8_t> bufferData(transferSize, 0u);
+
+    ChunkTransferBufferFunc chunkWrite = [&](void *stagingBuffer, size_t offset, size_t size) -> int32_t {
+        memcpy(bufferData.data() + offset, stagingBuffer, size);
+        return 0;
+    };
+    auto ret = stagingBufferManager->performBufferTransfer(hostData.data(), 0, transferSize, chunkWrite, csr, false);
+    EXPECT_EQ(0, ret.chunkCopyStatus);
+    EXPECT_EQ(WaitStatus::ready, ret.waitStatus);
+    EXPECT_EQ(hostData, bufferData);
+
+    std::vector<uint8_t> readData(transferSize, 0u);
+    ChunkTransferBufferFunc chunkRead = [&](void *stagingBuffer, size_t offset, size_t size) -> int32_t {
+        memcpy(stagingBuffer, bufferData.data() + offset, size);
+        return 0;
+    };
+    ret = stagingBufferManager->performBufferTransfer(readData.data(), 0, transferSize, chunkRead, csr, true);
+    EXPECT_EQ(0, ret.chunkCopyStatus);
+    EXPECT_EQ(WaitStatus::ready, ret.waitStatus);
+    EXPECT_EQ(hostData, readData);
+}
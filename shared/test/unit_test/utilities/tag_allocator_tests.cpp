@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2025 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,7 +84,9 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::getMagazineIndexForCurrentThread;
     using BaseClass::gfxAllocations;
+    using BaseClass::magazines;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::returnTagToDeferredPool;
@@ -466,6 +468,130 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenMagazinesDisabledByDefaultWhenTagAllocatorIsCreatedThenMagazinesAreNotAllocated) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+    EXPECT_EQ(nullptr, tagAllocator.magazines);
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(node, tagAllocator.getUsedTagsHead());
+    tagAllocator.returnTag(node);
+
+    EXPECT_EQ(0u, tagAllocator.getMagazineHitsCount());
+    EXPECT_EQ(0u, tagAllocator.getMagazineMissesCount());
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenGettingTagsThenMagazineIsRefilledInBatchFromFreeList) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+    ASSERT_NE(nullptr, tagAllocator.magazines);
+    auto &magazine = tagAllocator.magazines[tagAllocator.getMagazineIndexForCurrentThread()];
+
+    auto node0 = tagAllocator.getTag();
+    EXPECT_EQ(1u, tagAllocator.getMagazineMissesCount());
+    EXPECT_EQ(0u, tagAllocator.getMagazineHitsCount());
+    EXPECT_EQ(1u, magazine.nodesCount);
+    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(node0)));
+
+    auto node1 = tagAllocator.getTag();
+    EXPECT_EQ(1u, tagAllocator.getMagazineMissesCount());
+    EXPECT_EQ(1u, tagAllocator.getMagazineHitsCount());
+    EXPECT_EQ(0u, magazine.nodesCount);
+    EXPECT_NE(node0, node1);
+
+    tagAllocator.returnTag(node1);
+    EXPECT_EQ(1u, magazine.nodesCount);
+    EXPECT_EQ(node1, tagAllocator.getTag());
+    EXPECT_EQ(2u, tagAllocator.getMagazineHitsCount());
+
+    tagAllocator.returnTag(node0);
+    tagAllocator.returnTag(node1);
+    EXPECT_EQ(0u, tagAllocator.getCrossThreadReturnsCount());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenMagazineIsRefilledThenOnlyBoundedBatchIsTakenFromFreeList) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+
+    auto node = tagAllocator.getTag();
+
+    size_t freeTagsCount = 0;
+    for (auto freeNode = tagAllocator.freeTags.peekHead(); freeNode != nullptr; freeNode = freeNode->next) {
+        freeTagsCount++;
+    }
+    EXPECT_EQ(8u, freeTagsCount);
+
+    EXPECT_EQ(1u, tagAllocator.magazines[tagAllocator.getMagazineIndexForCurrentThread()].nodesCount);
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node);
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenMagazineOverflowsThenHalfOfItIsDrainedToFreeList) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+    auto &magazine = tagAllocator.magazines[tagAllocator.getMagazineIndexForCurrentThread()];
+
+    std::vector<TagNodeBase *> nodes;
+    for (uint32_t i = 0; i < 5; i++) {
+        nodes.push_back(tagAllocator.getTag());
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(1u, magazine.nodesCount);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        tagAllocator.returnTag(nodes[i]);
+    }
+    EXPECT_EQ(4u, magazine.nodesCount);
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(nodes[0])));
+
+    tagAllocator.returnTag(nodes[3]);
+    EXPECT_EQ(2u, magazine.nodesCount);
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(nodes[0])));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(nodes[1])));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(nodes[2])));
+    EXPECT_EQ(nodes[3], magazine.nodes.peekHead());
+
+    tagAllocator.returnTag(nodes[4]);
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenTagIsReturnedFromOtherThreadThenCrossThreadReturnIsCounted) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 16, deviceBitfield);
+    auto currentMagazineIndex = tagAllocator.getMagazineIndexForCurrentThread();
+
+    auto node = tagAllocator.getTag();
+    auto returningMagazineIndex = currentMagazineIndex;
+    while (returningMagazineIndex == currentMagazineIndex) {
+        std::thread returningThread([&] {
+            returningMagazineIndex = tagAllocator.getMagazineIndexForCurrentThread();
+            if (returningMagazineIndex != currentMagazineIndex) {
+                tagAllocator.returnTag(node);
+            }
+        });
+        returningThread.join();
+    }
+
+    EXPECT_EQ(1u, tagAllocator.getCrossThreadReturnsCount());
+    EXPECT_EQ(1u, tagAllocator.magazines[returningMagazineIndex].nodesCount);
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledAndNotReadyTagWhenReturnedThenMoveToDeferredListAndReleaseOnRefill) {
+    debugManager.flags.TagAllocatorMagazineSize.set(2);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, true, deviceBitfield);
+
+    auto node = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    tagAllocator.returnTag(node);
+    EXPECT_TRUE(tagAllocator.deferredTags.peekContains(*node));
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    node->setDoNotReleaseNodes(false);
+    EXPECT_EQ(node, tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
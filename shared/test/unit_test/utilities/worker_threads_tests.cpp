@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/worker_threads.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+
+using namespace NEO;
+
+namespace {
+uint32_t idleWorkerThreadsCreated = 0u;
+
+struct IdleWorkerThread : public Thread {
+    void join() override {}
+    void detach() override {}
+    void yield() override {}
+};
+
+std::unique_ptr<Thread> createIdleWorkerThread(void *(*func)(void *), void *arg) {
+    idleWorkerThreadsCreated++;
+    return std::make_unique<IdleWorkerThread>();
+}
+} // namespace
+
+TEST(WorkerThreadsTest, whenGettingWorkerThreadsCountThenValueIsClampedToSupportedRange) {
+    EXPECT_EQ(1u, getWorkerThreadsCount(0u));
+    EXPECT_EQ(1u, getWorkerThreadsCount(1u));
+    EXPECT_EQ(5u, getWorkerThreadsCount(5u));
+    EXPECT_EQ(maxWorkerThreadsCount, getWorkerThreadsCount(maxWorkerThreadsCount));
+    EXPECT_EQ(maxWorkerThreadsCount, getWorkerThreadsCount(maxWorkerThreadsCount + 1u));
+    EXPECT_EQ(maxWorkerThreadsCount, getWorkerThreadsCount(1000u));
+}
+
+TEST(WorkerThreadsTest, givenManyRequestedThreadsWhenRunningOnWorkerThreadsThenAdditionalThreadsAreCappedAndAllWorkIsDone) {
+    VariableBackup<decltype(Thread::createFunc)> createFuncBackup{&Thread::createFunc, createIdleWorkerThread};
+    VariableBackup<uint32_t> threadsCreatedBackup{&idleWorkerThreadsCreated, 0u};
+
+    constexpr size_t workItemsCount = 100u;
+    std::atomic<size_t> nextWorkItem{0u};
+    size_t workItemsDone = 0u;
+    runOnWorkerThreads(workItemsCount, [&]() {
+        for (auto workItem = nextWorkItem++; workItem < workItemsCount; workItem = nextWorkItem++) {
+            workItemsDone++;
+        }
+    });
+
+    EXPECT_EQ(maxWorkerThreadsCount - 1u, idleWorkerThreadsCreated);
+    EXPECT_EQ(workItemsCount, workItemsDone);
+}
+
+TEST(WorkerThreadsTest, givenSingleRequestedThreadWhenRunningOnWorkerThreadsThenNoThreadIsCreated) {
+    VariableBackup<decltype(Thread::createFunc)> createFuncBackup{&Thread::createFunc, createIdleWorkerThread};
+    VariableBackup<uint32_t> threadsCreatedBackup{&idleWorkerThreadsCreated, 0u};
+
+    uint32_t calls = 0u;
+    runOnWorkerThreads(1u, [&]() { calls++; });
+
+    EXPECT_EQ(0u, idleWorkerThreadsCreated);
+    EXPECT_EQ(1u, calls);
+}
+
+TEST(WorkerThreadsTest, givenMultipleThreadsWhenRunningOnWorkerThreadsThenFunctionIsExecutedOnEachThread) {
+    std::atomic<uint32_t> calls{0u};
+    runOnWorkerThreads(4u, [&]() { calls++; });
+
+    EXPECT_EQ(4u, calls.load());
+}